@@ -168,6 +168,17 @@ HYPRE_Int HYPRE_AMSSetProjectionFrequency(HYPRE_Solver solver,
                                           projection_frequency);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetReuse(HYPRE_Solver solver,
+                            HYPRE_Int reuse)
+{
+   return hypre_AMSSetReuse((void *) solver,
+                            reuse);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetMaxIter
  *--------------------------------------------------------------------------*/
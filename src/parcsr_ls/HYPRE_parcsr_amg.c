@@ -209,6 +209,46 @@ HYPRE_BoomerAMGGetRedundant( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetRedundant( (void *) solver, redundant ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAgglomThreshold, HYPRE_BoomerAMGSetAgglomFactor
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAgglomThreshold( HYPRE_Solver solver,
+                                   HYPRE_Int    agglom_threshold  )
+{
+   return ( hypre_BoomerAMGSetAgglomThreshold( (void *) solver, agglom_threshold ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAgglomFactor( HYPRE_Solver solver,
+                                HYPRE_Int    agglom_factor  )
+{
+   return ( hypre_BoomerAMGSetAgglomFactor( (void *) solver, agglom_factor ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRepartThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRepartThreshold( HYPRE_Solver solver,
+                                   HYPRE_Real   repart_threshold  )
+{
+   return ( hypre_BoomerAMGSetRepartThreshold( (void *) solver, repart_threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetLocalReordering
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetLocalReordering( HYPRE_Solver solver,
+                                   HYPRE_Int    local_reordering  )
+{
+   return ( hypre_BoomerAMGSetLocalReordering( (void *) solver, local_reordering ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRedundant, HYPRE_BoomerAMGGetRedundant
  *--------------------------------------------------------------------------*/
@@ -549,6 +589,33 @@ HYPRE_BoomerAMGGetFCycle( HYPRE_Solver solver,
    return ( hypre_BoomerAMGGetFCycle( (void *) solver, fcycle ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetKCycle, HYPRE_BoomerAMGSetKCycleTol,
+ * HYPRE_BoomerAMGSetKCycleLevels
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycle( HYPRE_Solver solver,
+                          HYPRE_Int    kcycle  )
+{
+   return ( hypre_BoomerAMGSetKCycle( (void *) solver, kcycle ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleTol( HYPRE_Solver solver,
+                             HYPRE_Real   kcycle_tol  )
+{
+   return ( hypre_BoomerAMGSetKCycleTol( (void *) solver, kcycle_tol ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleLevels( HYPRE_Solver solver,
+                                HYPRE_Int    num_levels,
+                                HYPRE_Int   *levels  )
+{
+   return ( hypre_BoomerAMGSetKCycleLevels( (void *) solver, num_levels, levels ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetConvergeType, HYPRE_BoomerAMGGetConvergeType
  *--------------------------------------------------------------------------*/
@@ -1930,6 +1997,17 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFuseResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFuseResidual (HYPRE_Solver solver,
+                                HYPRE_Int    fuse_residual)
+{
+   return (hypre_BoomerAMGSetFuseResidual ( (void *) solver, fuse_residual ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
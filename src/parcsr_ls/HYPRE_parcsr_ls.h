@@ -580,6 +580,47 @@ HYPRE_Int
 HYPRE_BoomerAMGSetFCycle( HYPRE_Solver solver,
                           HYPRE_Int    fcycle  );
 
+/**
+ * (Optional) Accelerates the coarse-grid corrections on selected levels by
+ * Krylov iterations (K-cycle).  On an accelerated level, up to two cycles
+ * are applied to the coarse-grid residual and combined optimally by one
+ * step of an outer Krylov method.  This allows for more aggressive
+ * coarsening without loss of convergence.  The options are:
+ *
+ *    - 0 : no acceleration (default)
+ *    - 1 : flexible CG, FCG(1), for symmetric positive definite problems
+ *    - 2 : GCR, for nonsymmetric problems
+ *
+ * The accelerated levels are chosen with \e HYPRE_BoomerAMGSetKCycleLevels.
+ * Since the resulting preconditioner is nonlinear, it should be used with a
+ * flexible Krylov method, e.g., FlexGMRES, when AMG is a preconditioner.
+ * Not available in block mode, for partial cycles or with FMG.
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycle( HYPRE_Solver solver,
+                          HYPRE_Int    kcycle  );
+
+/**
+ * (Optional) Defines the K-cycle tolerance: the second cycle on an
+ * accelerated level is skipped if the first one reduces the norm of the
+ * coarse-grid residual by this factor.  The default is 0.25.
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleTol( HYPRE_Solver solver,
+                             HYPRE_Real   kcycle_tol  );
+
+/**
+ * (Optional) Defines the levels (between 1 and the coarsest level) on which
+ * coarse-grid corrections are accelerated when the K-cycle is used.  The
+ * default is all levels except the finest and the coarsest.  Levels that are
+ * agglomerated (see \e HYPRE_BoomerAMGSetAgglomThreshold), and all coarser
+ * ones, are never accelerated.
+ **/
+HYPRE_Int
+HYPRE_BoomerAMGSetKCycleLevels( HYPRE_Solver solver,
+                                HYPRE_Int    num_levels,
+                                HYPRE_Int   *levels  );
+
 /**
  * (Optional) Defines use of an additive V(1,1)-cycle using the
  * classical additive method starting at level 'addlvl'.
@@ -674,6 +715,58 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetRedundant(HYPRE_Solver solver,
                                       HYPRE_Int    redundant);
 
+/**
+ * (Optional) Enables the agglomeration of coarse levels onto fewer processes.
+ * When a coarse level has fewer than agglom_threshold rows per active
+ * process, its rows are moved onto every k-th active process, with k set by
+ * HYPRE_BoomerAMGSetAgglomFactor, and the other processes own no rows on this
+ * and all coarser levels.  This is repeated on the coarser levels.  Not
+ * available in block mode, for systems of PDEs, with interpolation vectors
+ * or when keeping C-points.  Default is 0, i.e. no agglomeration.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold(HYPRE_Solver solver,
+                                            HYPRE_Int    agglom_threshold);
+
+/**
+ * (Optional) Defines the factor by which the number of active processes is
+ * reduced by each agglomeration step (see HYPRE_BoomerAMGSetAgglomThreshold).
+ * Must be at least 2.  Default is 8.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAgglomFactor(HYPRE_Solver solver,
+                                         HYPRE_Int    agglom_factor);
+
+/**
+ * (Optional) Enables the repartitioning of coarse levels.  When the largest
+ * number of nonzeros of a coarse-grid operator on one process exceeds
+ * repart_threshold times the average over all processes, the rows of the
+ * level are redistributed, keeping their order, so that every process holds
+ * about the same number of nonzeros, and the interpolation and restriction
+ * are adjusted accordingly.  The load balance of each level is reported with
+ * the setup statistics.  Has no effect on levels after an agglomeration
+ * (see HYPRE_BoomerAMGSetAgglomThreshold), in block mode, for systems of
+ * PDEs, with interpolation vectors or when keeping C-points.  Values
+ * should be larger than 1.  Default is 0, i.e. no repartitioning.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRepartThreshold(HYPRE_Solver solver,
+                                            HYPRE_Real   repart_threshold);
+
+/**
+ * (Optional) Enables the local reordering of coarse levels.  The rows of
+ * every process on each coarse level are renumbered in reverse
+ * Cuthill-McKee order of the diagonal block of the coarse-grid operator,
+ * which improves the cache locality of the matvecs and smoothing sweeps.
+ * The fine level is used as given; it may be reordered beforehand, e.g.,
+ * along a space-filling curve.  Not available in block mode, for systems
+ * of PDEs, with interpolation vectors or when keeping C-points.
+ *
+ * The following options are available:
+ *
+ *    - 0 : no reordering (default)
+ *    - 1 : reverse Cuthill-McKee
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetLocalReordering(HYPRE_Solver solver,
+                                            HYPRE_Int    local_reordering);
+
 /**
  * (Optional) Defines the number of sweeps for the fine and coarse grid,
  * the up and down cycle.
@@ -738,6 +831,12 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 99 : Gaussian elimination with pivoting (only on coarsest level); the
+ *           LU factors are computed once in the setup and reused
+ *    - 199 : direct solve with the explicit inverse (only on coarsest level);
+ *           the inverse is computed in the setup by Gauss-Jordan elimination
+ *           distributed by rows, and each process only stores its own rows
+ *           of the matrix and of the inverse
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -1204,6 +1303,16 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                           HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) If set to 1, the residual and its restriction to the next
+ * coarser level are computed in a single pass over the matrix rows, without
+ * storing the fine-level residual.  Only used on the host with a single
+ * thread, when R = P^T (restriction type 0) and not in block mode.
+ * Default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFuseResidual(HYPRE_Solver solver,
+                                         HYPRE_Int    fuse_residual);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2015,6 +2124,17 @@ HYPRE_Int HYPRE_AMSSetInteriorNodes(HYPRE_Solver    solver,
 HYPRE_Int HYPRE_AMSSetProjectionFrequency(HYPRE_Solver solver,
                                           HYPRE_Int    projection_frequency);
 
+/**
+ * (Optional) If reuse is nonzero, subsequent calls to HYPRE_AMSSetup() assume
+ * that the matrix has the same sparsity pattern as in the first call and only
+ * its coefficients changed (e.g., in a frequency sweep).  The discrete
+ * gradient, the Nedelec interpolation and the coarse grids and interpolation
+ * operators of the internal AMG solvers are then kept, and only the Galerkin
+ * products and smoother data are recomputed.  The default is 0.
+ **/
+HYPRE_Int HYPRE_AMSSetReuse(HYPRE_Solver solver,
+                            HYPRE_Int    reuse);
+
 /**
  * (Optional) Sets maximum number of iterations, if AMS is used
  * as a solver. To use AMS as a preconditioner, set the maximum
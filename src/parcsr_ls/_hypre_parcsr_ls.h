@@ -78,6 +78,13 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      agglom_factor;
+   MPI_Comm      *agglom_comms;
+   HYPRE_Int      agglom_idle;
+   HYPRE_Real     repart_threshold;
+   HYPRE_Real    *repart_imbalance;
+   HYPRE_Int      local_reordering;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -85,6 +92,10 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      fcycle;
    HYPRE_Int      cycle_type;
+   HYPRE_Int      kcycle;
+   HYPRE_Real     kcycle_tol;
+   HYPRE_Int      kcycle_num_levels;
+   HYPRE_Int     *kcycle_levels;
    HYPRE_Int     *num_grid_sweeps;
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
@@ -186,6 +197,11 @@ typedef struct
    hypre_ParVector   *Rtemp;
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
+   hypre_ParVector  **kcycle_vectors;   /* c1 and A c1 on accelerated levels */
+   HYPRE_Real        *kcycle_coefs;
+   HYPRE_Int          kcycle_num_vectors;
+   hypre_ParCSRResidualRestrictPlan **fuse_res_plans;  /* fused residual-restriction */
+   HYPRE_Int          fuse_res_num_plans;
 
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
@@ -236,6 +252,7 @@ typedef struct
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -259,6 +276,9 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* Compute residual and restriction in one pass */
+   HYPRE_Int fuse_residual;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -334,6 +354,10 @@ typedef struct
 #define hypre_ParAMGDataMaxIter(amg_data) ((amg_data)->max_iter)
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
+#define hypre_ParAMGDataKCycle(amg_data) ((amg_data)->kcycle)
+#define hypre_ParAMGDataKCycleTol(amg_data) ((amg_data)->kcycle_tol)
+#define hypre_ParAMGDataKCycleNumLevels(amg_data) ((amg_data)->kcycle_num_levels)
+#define hypre_ParAMGDataKCycleLevels(amg_data) ((amg_data)->kcycle_levels)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
@@ -430,6 +454,11 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataKCycleVectors(amg_data) ((amg_data)->kcycle_vectors)
+#define hypre_ParAMGDataKCycleCoefs(amg_data) ((amg_data)->kcycle_coefs)
+#define hypre_ParAMGDataKCycleNumVectors(amg_data) ((amg_data)->kcycle_num_vectors)
+#define hypre_ParAMGDataFuseResPlans(amg_data) ((amg_data)->fuse_res_plans)
+#define hypre_ParAMGDataFuseResNumPlans(amg_data) ((amg_data)->fuse_res_num_plans)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -477,10 +506,18 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomThreshold(amg_data) ((amg_data)->agglom_threshold)
+#define hypre_ParAMGDataAgglomFactor(amg_data) ((amg_data)->agglom_factor)
+#define hypre_ParAMGDataAgglomComms(amg_data) ((amg_data)->agglom_comms)
+#define hypre_ParAMGDataAgglomIdle(amg_data) ((amg_data)->agglom_idle)
+#define hypre_ParAMGDataRepartThreshold(amg_data) ((amg_data)->repart_threshold)
+#define hypre_ParAMGDataRepartImbalance(amg_data) ((amg_data)->repart_imbalance)
+#define hypre_ParAMGDataLocalReordering(amg_data) ((amg_data)->local_reordering)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -508,6 +545,7 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFuseResidual(amg_data) ((amg_data)->fuse_residual)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -955,6 +993,7 @@ HYPRE_Int hypre_AMSSetAlphaPoissonMatrix ( void *solver, hypre_ParCSRMatrix *A_P
 HYPRE_Int hypre_AMSSetBetaPoissonMatrix ( void *solver, hypre_ParCSRMatrix *A_G );
 HYPRE_Int hypre_AMSSetInteriorNodes ( void *solver, hypre_ParVector *interior_nodes );
 HYPRE_Int hypre_AMSSetProjectionFrequency ( void *solver, HYPRE_Int projection_frequency );
+HYPRE_Int hypre_AMSSetReuse ( void *solver, HYPRE_Int reuse );
 HYPRE_Int hypre_AMSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver, HYPRE_Int cycle_type );
@@ -980,6 +1019,8 @@ HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G, hy
                                 hypre_ParVector *Gy, hypre_ParVector *Gz, HYPRE_Int dim, hypre_ParCSRMatrix **GPi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
+HYPRE_Int hypre_AMSSetupNumeric ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
+                                  hypre_ParVector *x );
 HYPRE_Int hypre_AMSSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
 HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_type,
@@ -988,6 +1029,7 @@ HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_
                                      HYPRE_Real A0_cheby_fraction, hypre_ParCSRMatrix **A, HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB,
                                      hypre_ParCSRMatrix **P, hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
                                      hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z );
+HYPRE_Int hypre_AMSPixyzCorrection ( void *solver, hypre_ParVector *r, hypre_ParVector *y );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver, HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver, hypre_ParVector *x );
@@ -1127,6 +1169,7 @@ HYPRE_Int HYPRE_AMSSetAlphaPoissonMatrix ( HYPRE_Solver solver, HYPRE_ParCSRMatr
 HYPRE_Int HYPRE_AMSSetBetaPoissonMatrix ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A_beta );
 HYPRE_Int HYPRE_AMSSetInteriorNodes ( HYPRE_Solver solver, HYPRE_ParVector interior_nodes );
 HYPRE_Int HYPRE_AMSSetProjectionFrequency ( HYPRE_Solver solver, HYPRE_Int projection_frequency );
+HYPRE_Int HYPRE_AMSSetReuse ( HYPRE_Solver solver, HYPRE_Int reuse );
 HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
@@ -1177,6 +1220,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_th
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold ( HYPRE_Solver solver, HYPRE_Int agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomFactor ( HYPRE_Solver solver, HYPRE_Int agglom_factor );
+HYPRE_Int HYPRE_BoomerAMGSetRepartThreshold ( HYPRE_Solver solver, HYPRE_Real repart_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetLocalReordering ( HYPRE_Solver solver, HYPRE_Int local_reordering );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -1213,6 +1260,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycle ( HYPRE_Solver solver, HYPRE_Int kcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleTol ( HYPRE_Solver solver, HYPRE_Real kcycle_tol );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleLevels ( HYPRE_Solver solver, HYPRE_Int num_levels,
+                                           HYPRE_Int *levels );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -1353,6 +1404,7 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetFuseResidual ( HYPRE_Solver solver, HYPRE_Int fuse_residual );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -1753,6 +1805,10 @@ HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
+HYPRE_Int hypre_BoomerAMGSetAgglomThreshold ( void *data, HYPRE_Int agglom_threshold );
+HYPRE_Int hypre_BoomerAMGSetAgglomFactor ( void *data, HYPRE_Int agglom_factor );
+HYPRE_Int hypre_BoomerAMGSetRepartThreshold ( void *data, HYPRE_Real repart_threshold );
+HYPRE_Int hypre_BoomerAMGSetLocalReordering ( void *data, HYPRE_Int local_reordering );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
 HYPRE_Int hypre_BoomerAMGGetStrongThreshold ( void *data, HYPRE_Real *strong_threshold );
 HYPRE_Int hypre_BoomerAMGSetStrongThresholdR ( void *data, HYPRE_Real strong_threshold );
@@ -1785,6 +1841,9 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycle ( void *data, HYPRE_Int kcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycleTol ( void *data, HYPRE_Real kcycle_tol );
+HYPRE_Int hypre_BoomerAMGSetKCycleLevels ( void *data, HYPRE_Int num_levels, HYPRE_Int *levels );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -1923,6 +1982,7 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetFuseResidual ( void *data, HYPRE_Int fuse_residual );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1931,9 +1991,21 @@ HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level,
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points,
                                      HYPRE_BigInt *indices );
 
+/* par_amg_agglomerate.c */
+HYPRE_Int hypre_BoomerAMGAgglomerateLevel ( void *amg_vdata, HYPRE_Int level,
+                                            HYPRE_Int *stride_ptr );
+HYPRE_Int hypre_BoomerAMGAgglomerateDestroyComms ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGLevelImbalance ( hypre_ParCSRMatrix *A, HYPRE_Real *imbalance_ptr );
+HYPRE_Int hypre_BoomerAMGRepartitionLevel ( void *amg_vdata, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGReorderLevel ( void *amg_vdata, HYPRE_Int level );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupNumeric ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                        hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGFuseResidualSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGFuseResidualDestroy ( void *amg_vdata );
 
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -2071,6 +2143,12 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A, hypre_IntArray **CF_
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata, hypre_ParVector **F_array,
                                  hypre_ParVector **U_array );
 
+/* par_kcycle.c */
+HYPRE_Int *hypre_BoomerAMGKCycleInitialize ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleCorrect ( void *amg_vdata, HYPRE_Int level, HYPRE_Int stage,
+                                         hypre_ParVector **F_array, hypre_ParVector **U_array );
+
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
                                      HYPRE_BigInt nz, HYPRE_Int P, HYPRE_Int Q, HYPRE_Int R, HYPRE_Int p, HYPRE_Int q, HYPRE_Int r,
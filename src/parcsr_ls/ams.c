@@ -874,6 +874,8 @@ void * hypre_AMSCreate()
    ams_data -> r2  = NULL;
    ams_data -> g2  = NULL;
    ams_data -> zz  = NULL;
+   ams_data -> r3[0] = ams_data -> r3[1] = ams_data -> r3[2] = NULL;
+   ams_data -> g3[0] = ams_data -> g3[1] = ams_data -> g3[2] = NULL;
 
    ams_data -> Pix    = NULL;
    ams_data -> Piy    = NULL;
@@ -890,6 +892,8 @@ void * hypre_AMSCreate()
    ams_data -> A_G0                 = NULL;
    ams_data -> B_G0                 = 0;
    ams_data -> projection_frequency = 5;
+   ams_data -> reuse                = 0;
+   ams_data -> fuse_Pixyz           = 0;
 
    ams_data -> A_l1_norms = NULL;
    ams_data -> A_max_eig_est = 0;
@@ -912,6 +916,7 @@ void * hypre_AMSCreate()
 HYPRE_Int hypre_AMSDestroy(void *solver)
 {
    hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   HYPRE_Int i;
 
    if (!ams_data)
    {
@@ -1009,6 +1014,17 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
    {
       hypre_ParVectorDestroy(ams_data -> zz);
    }
+   for (i = 0; i < 3; i++)
+   {
+      if (ams_data -> r3[i])
+      {
+         hypre_ParVectorDestroy(ams_data -> r3[i]);
+      }
+      if (ams_data -> g3[i])
+      {
+         hypre_ParVectorDestroy(ams_data -> g3[i]);
+      }
+   }
 
    if (ams_data -> G0)
    {
@@ -1255,6 +1271,26 @@ HYPRE_Int hypre_AMSSetProjectionFrequency(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetReuse
+ *
+ * If reuse is nonzero, a new call to hypre_AMSSetup() after the first one
+ * assumes that the matrix has the same sparsity pattern (only its
+ * coefficients changed, as in a frequency sweep). The discrete gradient, the
+ * Nedelec interpolation and the coarse grids of the inner AMG solvers are
+ * then kept, and only the numerical values are recomputed.
+ *
+ * The default is not to reuse anything.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetReuse(void *solver,
+                            HYPRE_Int reuse)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> reuse = reuse;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetMaxIter
  *
@@ -2782,6 +2818,13 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
    HYPRE_Int input_info = 0;
 
+   /* Subsequent setup with the same sparsity pattern */
+   if (ams_data -> reuse && ams_data -> r0 &&
+       !ams_data -> interior_nodes && ams_data -> cycle_type != 9)
+   {
+      return hypre_AMSSetupNumeric(solver, A, b, x);
+   }
+
    ams_data -> A = A;
 
    /* Modifications for problems with zero-conductivity regions */
@@ -3583,6 +3626,165 @@ HYPRE_Int hypre_AMSSetup(void *solver,
       ams_data -> g2 = hypre_ParVectorInDomainOf(ams_data -> Pi);
    }
 
+   /* The additive cycles apply all Pi{x,y,z} corrections to the same residual.
+      If the components share their column map (as the ones constructed in
+      hypre_AMSComputePixyz do), a single halo exchange serves all of them. */
+   ams_data -> fuse_Pixyz = 0;
+   if ((ams_data -> cycle_type == 12 || ams_data -> cycle_type == 14) &&
+       ams_data -> A_Pix && ams_data -> Piy)
+   {
+      hypre_ParCSRMatrix *Pid[3] = {ams_data -> Pix, ams_data -> Piy, ams_data -> Piz};
+      hypre_CSRMatrix *Pix_offd = hypre_ParCSRMatrixOffd(Pid[0]);
+      HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(Pix_offd);
+      HYPRE_Int d, j, same_cmap = 1, all_same_cmap;
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      if (exec == HYPRE_EXEC_DEVICE)
+      {
+         same_cmap = 0;
+      }
+#endif
+
+      for (d = 1; d < 3 && same_cmap; d++)
+      {
+         if (!Pid[d])
+         {
+            continue;
+         }
+         if (hypre_ParCSRMatrixNumRows(Pid[d]) != hypre_ParCSRMatrixNumRows(Pid[0]) ||
+             hypre_ParCSRMatrixNumCols(Pid[d]) != hypre_ParCSRMatrixNumCols(Pid[0]) ||
+             hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(Pid[d])) != num_cols_offd)
+         {
+            same_cmap = 0;
+         }
+         for (j = 0; j < num_cols_offd && same_cmap; j++)
+         {
+            if (hypre_ParCSRMatrixColMapOffd(Pid[d])[j] != hypre_ParCSRMatrixColMapOffd(Pid[0])[j])
+            {
+               same_cmap = 0;
+            }
+         }
+      }
+      hypre_MPI_Allreduce(&same_cmap, &all_same_cmap, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                          hypre_ParCSRMatrixComm(A));
+
+      if (all_same_cmap)
+      {
+         ams_data -> fuse_Pixyz = 1;
+         for (d = 0; d < 3 && Pid[d]; d++)
+         {
+            ams_data -> r3[d] = hypre_ParVectorInDomainOf(Pid[d]);
+            ams_data -> g3[d] = hypre_ParVectorInDomainOf(Pid[d]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetupNumeric
+ *
+ * Numeric part of the AMS setup for a matrix A with the same sparsity
+ * pattern as the one given to the previous hypre_AMSSetup() call.  G and the
+ * Nedelec interpolation matrices do not depend on the coefficients of A and
+ * are kept.  The Galerkin products are recomputed and the inner AMG solvers
+ * are refreshed with hypre_BoomerAMGSetupNumeric(), which keeps their
+ * coarse grids and interpolation operators.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetupNumeric(void *solver,
+                                hypre_ParCSRMatrix *A,
+                                hypre_ParVector *b,
+                                hypre_ParVector *x)
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_ParCSRMatrixMemoryLocation(A) );
+#endif
+
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+
+   hypre_ParCSRMatrix  *interp[5];
+   hypre_ParCSRMatrix **coarse[5];
+   HYPRE_Solver         amg[5];
+   HYPRE_Int            owns[5];
+   HYPRE_Int            i;
+
+   ams_data -> A = A;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+
+   /* Compute the l1 norm of the rows of A */
+   hypre_SeqVectorDestroy(ams_data -> A_l1_norms);
+   ams_data -> A_l1_norms = NULL;
+   if (ams_data -> A_relax_type >= 1 && ams_data -> A_relax_type <= 4)
+   {
+      HYPRE_Real *l1_norm_data = NULL;
+
+      hypre_ParCSRComputeL1Norms(A, ams_data -> A_relax_type, NULL, &l1_norm_data);
+
+      ams_data -> A_l1_norms = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A));
+      hypre_VectorData(ams_data -> A_l1_norms) = l1_norm_data;
+      hypre_SeqVectorInitialize_v2(ams_data -> A_l1_norms,
+                                   hypre_ParCSRMatrixMemoryLocation(A));
+   }
+
+   /* Chebyshev? */
+   if (ams_data -> A_relax_type == 16)
+   {
+      hypre_ParCSRMaxEigEstimateCG(A, 1, 10,
+                                   &ams_data->A_max_eig_est,
+                                   &ams_data->A_min_eig_est);
+   }
+
+   /* Subspace solvers, their interpolations and coarse matrices */
+   interp[0] = ams_data -> G;   coarse[0] = &ams_data -> A_G;
+   amg[0] = ams_data -> B_G;    owns[0] = ams_data -> owns_A_G;
+   interp[1] = ams_data -> Pix; coarse[1] = &ams_data -> A_Pix;
+   amg[1] = ams_data -> B_Pix;  owns[1] = 1;
+   interp[2] = ams_data -> Piy; coarse[2] = &ams_data -> A_Piy;
+   amg[2] = ams_data -> B_Piy;  owns[2] = 1;
+   interp[3] = ams_data -> Piz; coarse[3] = &ams_data -> A_Piz;
+   amg[3] = ams_data -> B_Piz;  owns[3] = 1;
+   interp[4] = ams_data -> Pi;  coarse[4] = &ams_data -> A_Pi;
+   amg[4] = ams_data -> B_Pi;   owns[4] = ams_data -> owns_A_Pi;
+
+   for (i = 0; i < 5; i++)
+   {
+      if (!amg[i])
+      {
+         continue;
+      }
+
+      /* Recompute the coarse matrix unless it was given by the user */
+      if (owns[i])
+      {
+         hypre_ParCSRMatrixDestroy(*coarse[i]);
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+         if (exec == HYPRE_EXEC_DEVICE)
+         {
+            *coarse[i] = hypre_ParCSRMatrixRAPKT(interp[i], A, interp[i], 1);
+         }
+         else
+#endif
+         {
+            hypre_BoomerAMGBuildCoarseOperator(interp[i], A, interp[i], coarse[i]);
+         }
+      }
+
+      /* Make sure that the coarse matrix has no zero rows */
+      if (owns[i] || i == 4)
+      {
+         hypre_ParCSRMatrixFixZeroRows(*coarse[i]);
+      }
+
+      hypre_BoomerAMGSetupNumeric((void *) amg[i], *coarse[i], NULL, NULL);
+   }
+
    return hypre_error_flag;
 }
 
@@ -3602,7 +3804,7 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    HYPRE_Int i, my_id = -1;
    HYPRE_Real r0_norm, r_norm, b_norm, relative_resid = 0, old_resid;
 
-   char cycle[30];
+   char cycle[30], cycle_post[30];
    hypre_ParCSRMatrix *Ai[5], *Pi[5];
    HYPRE_Solver Bi[5];
    HYPRE_PtrToSolverFcn HBi[5];
@@ -3752,6 +3954,16 @@ HYPRE_Int hypre_AMSSolve(void *solver,
       }
    }
 
+   /* Split the cycle around the additive Pi{x,y,z} corrections, which are
+      applied together by hypre_AMSPixyzCorrection() */
+   cycle_post[0] = '\0';
+   if (ams_data -> fuse_Pixyz)
+   {
+      char *op = strstr(cycle, "+3+4+5)");
+      hypre_sprintf(cycle_post, "%s", op + 7);
+      *op = '\0';
+   }
+
    for (i = 0; i < ams_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -3798,6 +4010,27 @@ HYPRE_Int hypre_AMSSolve(void *solver,
                                cycle,
                                z);
 
+      if (ams_data -> fuse_Pixyz)
+      {
+         hypre_AMSPixyzCorrection(ams_data, ams_data -> r0, x);
+         hypre_ParCSRSubspacePrec(ams_data -> A,
+                                  ams_data -> A_relax_type,
+                                  ams_data -> A_relax_times,
+                                  ams_data -> A_l1_norms ? hypre_VectorData(ams_data -> A_l1_norms) : NULL,
+                                  ams_data -> A_relax_weight,
+                                  ams_data -> A_omega,
+                                  ams_data -> A_max_eig_est,
+                                  ams_data -> A_min_eig_est,
+                                  ams_data -> A_cheby_order,
+                                  ams_data -> A_cheby_fraction,
+                                  Ai, Bi, HBi, Pi, ri, gi,
+                                  b, x,
+                                  ams_data -> r0,
+                                  ams_data -> g0,
+                                  cycle_post,
+                                  z);
+      }
+
       /* Compute new residual norms */
       if (ams_data -> maxit > 1)
       {
@@ -3965,6 +4198,153 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSPixyzCorrection
+ *
+ * Apply the additive subspace corrections y += sum_d Pid Bd^{-1} Pid^t r for
+ * the components Pid of Pi{x,y,z}, as in the "+3+4+5" part of cycle types
+ * 12 and 14. The components share their column map, so the restrictions and
+ * the interpolations each need a single halo exchange with the values of all
+ * components interleaved, instead of one exchange per component. Up to the
+ * communication, the operations are identical to those performed by
+ * hypre_ParCSRSubspacePrec().
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSPixyzCorrection(void *solver,
+                                   hypre_ParVector *r,
+                                   hypre_ParVector *y)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+
+   hypre_ParCSRMatrix *P[3], *A[3];
+   HYPRE_Solver B[3];
+   hypre_ParCSRCommPkg *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_CSRMatrix *diag, *offd;
+   hypre_Vector *tmp;
+   hypre_Vector *r_local = hypre_ParVectorLocalVector(r);
+   hypre_Vector *g0_local = hypre_ParVectorLocalVector(ams_data -> g0);
+
+   HYPRE_Complex *tmp_data, *offd_buf, *send_buf, *v_data;
+   HYPRE_Int num_cols_offd, num_sends, send_size;
+   HYPRE_Int i, j, d, n;
+
+   P[0] = ams_data -> Pix;  A[0] = ams_data -> A_Pix;  B[0] = ams_data -> B_Pix;
+   P[1] = ams_data -> Piy;  A[1] = ams_data -> A_Piy;  B[1] = ams_data -> B_Piy;
+   P[2] = ams_data -> Piz;  A[2] = ams_data -> A_Piz;  B[2] = ams_data -> B_Piz;
+   n = P[2] ? 3 : 2;
+
+   comm_pkg = hypre_ParCSRMatrixCommPkg(P[0]);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P[0]));
+
+   tmp = hypre_SeqVectorCreate(num_cols_offd);
+   hypre_SeqVectorInitialize_v2(tmp, HYPRE_MEMORY_HOST);
+   tmp_data = hypre_VectorData(tmp);
+   offd_buf = hypre_CTAlloc(HYPRE_Complex, n * num_cols_offd, HYPRE_MEMORY_HOST);
+   send_buf = hypre_CTAlloc(HYPRE_Complex, n * send_size, HYPRE_MEMORY_HOST);
+
+   /* Restriction: r_d = Pid^t r */
+   for (d = 0; d < n; d++)
+   {
+      offd = hypre_ParCSRMatrixOffd(P[d]);
+      if (num_cols_offd)
+      {
+         if (hypre_ParCSRMatrixOffdT(P[d]))
+         {
+            hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixOffdT(P[d]), r_local, 0.0, tmp);
+         }
+         else
+         {
+            hypre_CSRMatrixMatvecT(1.0, offd, r_local, 0.0, tmp);
+         }
+      }
+      for (j = 0; j < num_cols_offd; j++)
+      {
+         offd_buf[j * n + d] = tmp_data[j];
+      }
+   }
+
+   comm_handle = hypre_ParCSRBlockCommHandleCreate(2, n, comm_pkg, offd_buf, send_buf);
+
+   /* overlapped local computation */
+   for (d = 0; d < n; d++)
+   {
+      diag = hypre_ParCSRMatrixDiag(P[d]);
+      if (hypre_ParCSRMatrixDiagT(P[d]))
+      {
+         hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixDiagT(P[d]),
+                               r_local, 0.0, hypre_ParVectorLocalVector(ams_data -> r3[d]));
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(1.0, diag,
+                                r_local, 0.0, hypre_ParVectorLocalVector(ams_data -> r3[d]));
+      }
+   }
+
+   hypre_ParCSRBlockCommHandleDestroy(comm_handle);
+
+   for (d = 0; d < n; d++)
+   {
+      v_data = hypre_VectorData(hypre_ParVectorLocalVector(ams_data -> r3[d]));
+      for (i = 0; i < send_size; i++)
+      {
+         v_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)] += send_buf[i * n + d];
+      }
+   }
+
+   /* Subspace solves: g_d = Bd^{-1} r_d */
+   for (d = 0; d < n; d++)
+   {
+      hypre_ParVectorSetConstantValues(ams_data -> g3[d], 0.0);
+      hypre_BoomerAMGSolve(B[d], A[d], ams_data -> r3[d], ams_data -> g3[d]);
+   }
+
+   /* Interpolation: y += Pid g_d */
+   for (d = 0; d < n; d++)
+   {
+      v_data = hypre_VectorData(hypre_ParVectorLocalVector(ams_data -> g3[d]));
+      for (i = 0; i < send_size; i++)
+      {
+         send_buf[i * n + d] = v_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+   }
+
+   comm_handle = hypre_ParCSRBlockCommHandleCreate(1, n, comm_pkg, send_buf, offd_buf);
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixDiag(P[0]),
+                         hypre_ParVectorLocalVector(ams_data -> g3[0]), 0.0, g0_local);
+
+   hypre_ParCSRBlockCommHandleDestroy(comm_handle);
+
+   for (d = 0; d < n; d++)
+   {
+      if (d > 0)
+      {
+         hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixDiag(P[d]),
+                               hypre_ParVectorLocalVector(ams_data -> g3[d]), 0.0, g0_local);
+      }
+      if (num_cols_offd)
+      {
+         for (j = 0; j < num_cols_offd; j++)
+         {
+            tmp_data[j] = offd_buf[j * n + d];
+         }
+         hypre_CSRMatrixMatvec(1.0, hypre_ParCSRMatrixOffd(P[d]), tmp, 1.0, g0_local);
+      }
+      hypre_ParVectorAxpy(1.0, ams_data -> g0, y);
+   }
+
+   hypre_SeqVectorDestroy(tmp);
+   hypre_TFree(offd_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSGetNumIterations
  *
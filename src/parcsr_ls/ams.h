@@ -66,6 +66,12 @@ typedef struct
    /* Internal counter to use with projection_frequency in PCG */
    HYPRE_Int solve_counter;
 
+   /* Keep G, Pi and the inner AMG coarse grids in subsequent setups? */
+   HYPRE_Int reuse;
+
+   /* Apply the additive Pi{x,y,z} corrections with one halo exchange? */
+   HYPRE_Int fuse_Pixyz;
+
    /* Solver options */
    HYPRE_Int maxit;
    HYPRE_Real tol;
@@ -103,6 +109,8 @@ typedef struct
 
    /* Temporary vectors */
    hypre_ParVector *r0, *g0, *r1, *g1, *r2, *g2, *zz;
+   /* Temporary vertex vectors for the fused Pi{x,y,z} corrections */
+   hypre_ParVector *r3[3], *g3[3];
 
    /* Output log info */
    HYPRE_Int num_iterations;
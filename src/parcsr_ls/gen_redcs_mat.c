@@ -23,7 +23,7 @@ hypre_seqAMGSetup( hypre_ParAMGData *amg_data,
    /* Par Data Structure variables */
    hypre_ParCSRMatrix **Par_A_array = hypre_ParAMGDataAArray(amg_data);
 
-   MPI_Comm      comm = hypre_ParCSRMatrixComm(Par_A_array[0]);
+   MPI_Comm      comm = hypre_ParCSRMatrixComm(Par_A_array[p_level]);
    MPI_Comm      new_comm, seq_comm;
 
    hypre_ParCSRMatrix   *A_seq = NULL;
@@ -65,14 +65,21 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    cgc_its;
    HYPRE_Int    seq_threshold;
    HYPRE_Int    redundant;
+   HYPRE_Int    agglom_threshold;
+   HYPRE_Int    agglom_factor;
+   HYPRE_Real   repart_threshold;
+   HYPRE_Int    local_reordering;
    HYPRE_Int    rap2;
    HYPRE_Int    keepT;
    HYPRE_Int    modu_rap;
+   HYPRE_Int    fuse_residual;
 
    /* solve params */
    HYPRE_Int    min_iter;
    HYPRE_Int    max_iter;
    HYPRE_Int    fcycle;
+   HYPRE_Int    kcycle;
+   HYPRE_Real   kcycle_tol;
    HYPRE_Int    cycle_type;
 
    HYPRE_Int    converge_type;
@@ -146,6 +153,10 @@ hypre_BoomerAMGCreate()
    min_coarse_size = 0;
    seq_threshold = 0;
    redundant = 0;
+   agglom_threshold = 0;
+   agglom_factor = 8;
+   repart_threshold = 0.0;
+   local_reordering = 0;
    coarsen_cut_factor = 0;
    strong_threshold = 0.25;
    strong_threshold_R = 0.25;
@@ -213,6 +224,8 @@ hypre_BoomerAMGCreate()
    max_iter  = 20;
    fcycle = 0;
    cycle_type = 1;
+   kcycle = 0;
+   kcycle_tol = 0.25;
    converge_type = 0;
    tol = 1.0e-6;
 
@@ -257,6 +270,7 @@ hypre_BoomerAMGCreate()
    rap2 = 0;
    keepT = 0;
    modu_rap = 0;
+   fuse_residual = 0;
 
 #if defined(HYPRE_USING_GPU)
    keepT           =  1;
@@ -348,6 +362,10 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetMaxIter(amg_data, max_iter);
    hypre_BoomerAMGSetCycleType(amg_data, cycle_type);
    hypre_BoomerAMGSetFCycle(amg_data, fcycle);
+   hypre_BoomerAMGSetKCycle(amg_data, kcycle);
+   hypre_BoomerAMGSetKCycleTol(amg_data, kcycle_tol);
+   hypre_ParAMGDataKCycleNumLevels(amg_data) = 0;
+   hypre_ParAMGDataKCycleLevels(amg_data) = NULL;
    hypre_BoomerAMGSetConvergeType(amg_data, converge_type);
    hypre_BoomerAMGSetTol(amg_data, tol);
    hypre_BoomerAMGSetNumSweeps(amg_data, num_sweeps);
@@ -404,6 +422,11 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataKCycleVectors(amg_data) = NULL;
+   hypre_ParAMGDataKCycleCoefs(amg_data) = NULL;
+   hypre_ParAMGDataKCycleNumVectors(amg_data) = 0;
+   hypre_ParAMGDataFuseResPlans(amg_data) = NULL;
+   hypre_ParAMGDataFuseResNumPlans(amg_data) = 0;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -451,6 +474,13 @@ hypre_BoomerAMGCreate()
    /* for redundant coarse grid solve */
    hypre_ParAMGDataSeqThreshold(amg_data) = seq_threshold;
    hypre_ParAMGDataRedundant(amg_data) = redundant;
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+   hypre_ParAMGDataAgglomFactor(amg_data) = agglom_factor;
+   hypre_ParAMGDataRepartThreshold(amg_data) = repart_threshold;
+   hypre_ParAMGDataAgglomComms(amg_data) = NULL;
+   hypre_ParAMGDataAgglomIdle(amg_data) = 0;
+   hypre_ParAMGDataRepartImbalance(amg_data) = NULL;
+   hypre_ParAMGDataLocalReordering(amg_data) = local_reordering;
    hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
    hypre_ParAMGDataACoarse(amg_data) = NULL;
    hypre_ParAMGDataFCoarse(amg_data) = NULL;
@@ -461,6 +491,7 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataGSSetup(amg_data) = 0;
    hypre_ParAMGDataAMat(amg_data) = NULL;
    hypre_ParAMGDataAInv(amg_data) = NULL;
+   hypre_ParAMGDataAPiv(amg_data) = NULL;
    hypre_ParAMGDataBVec(amg_data) = NULL;
    hypre_ParAMGDataCommInfo(amg_data) = NULL;
 
@@ -470,6 +501,7 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataFuseResidual(amg_data)      = fuse_residual;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -705,6 +737,7 @@ hypre_BoomerAMGDestroy( void *data )
    hypre_TFree(hypre_ParAMGDataPBlockArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataPArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataRepartImbalance(amg_data), HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataRtemp(amg_data))
    {
@@ -718,6 +751,10 @@ hypre_BoomerAMGDestroy( void *data )
    {
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
    }
+   hypre_BoomerAMGKCycleDestroy(amg_data);
+   hypre_BoomerAMGFuseResidualDestroy(amg_data);
+   hypre_TFree(hypre_ParAMGDataKCycleLevels(amg_data), HYPRE_MEMORY_HOST);
+   hypre_BoomerAMGAgglomerateDestroyComms(amg_data);
 
    if (hypre_ParAMGDataDofFuncArray(amg_data))
    {
@@ -861,6 +898,7 @@ hypre_BoomerAMGDestroy( void *data )
 
    if (hypre_ParAMGDataAMat(amg_data)) { hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataAInv(amg_data)) { hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST); }
+   if (hypre_ParAMGDataAPiv(amg_data)) { hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataBVec(amg_data)) { hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST); }
    if (hypre_ParAMGDataCommInfo(amg_data)) { hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST); }
 
@@ -1183,6 +1221,98 @@ hypre_BoomerAMGGetRedundant( void *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetAgglomThreshold( void     *data,
+                                   HYPRE_Int agglom_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (agglom_threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetAgglomFactor( void     *data,
+                                HYPRE_Int agglom_factor )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (agglom_factor < 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAgglomFactor(amg_data) = agglom_factor;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRepartThreshold( void       *data,
+                                   HYPRE_Real  repart_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (repart_threshold < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataRepartThreshold(amg_data) = repart_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetLocalReordering( void     *data,
+                                   HYPRE_Int local_reordering )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (local_reordering < 0 || local_reordering > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataLocalReordering(amg_data) = local_reordering;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetCoarsenCutFactor( void       *data,
                                     HYPRE_Int   coarsen_cut_factor )
@@ -1869,6 +1999,89 @@ hypre_BoomerAMGGetFCycle( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetKCycle( void     *data,
+                          HYPRE_Int kcycle )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (kcycle < 0 || kcycle > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataKCycle(amg_data) = kcycle;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetKCycleTol( void      *data,
+                             HYPRE_Real kcycle_tol )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (kcycle_tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataKCycleTol(amg_data) = kcycle_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetKCycleLevels( void      *data,
+                                HYPRE_Int  num_levels,
+                                HYPRE_Int *levels )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+   HYPRE_Int          i;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (num_levels < 0 || (num_levels > 0 && !levels))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_TFree(hypre_ParAMGDataKCycleLevels(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataKCycleLevels(amg_data) = NULL;
+   hypre_ParAMGDataKCycleNumLevels(amg_data) = num_levels;
+
+   if (levels)
+   {
+      hypre_ParAMGDataKCycleLevels(amg_data) = hypre_TAlloc(HYPRE_Int, hypre_max(num_levels, 1),
+                                                            HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_ParAMGDataKCycleLevels(amg_data)[i] = levels[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetConvergeType( void     *data,
                                 HYPRE_Int type  )
@@ -4702,6 +4915,16 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetFuseResidual( void       *data,
+                                HYPRE_Int   fuse_residual)
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   hypre_ParAMGDataFuseResidual(amg_data) = fuse_residual;
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -60,6 +60,13 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      agglom_factor;
+   MPI_Comm      *agglom_comms;
+   HYPRE_Int      agglom_idle;
+   HYPRE_Real     repart_threshold;
+   HYPRE_Real    *repart_imbalance;
+   HYPRE_Int      local_reordering;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -67,6 +74,10 @@ typedef struct
    HYPRE_Int      min_iter;
    HYPRE_Int      fcycle;
    HYPRE_Int      cycle_type;
+   HYPRE_Int      kcycle;
+   HYPRE_Real     kcycle_tol;
+   HYPRE_Int      kcycle_num_levels;
+   HYPRE_Int     *kcycle_levels;
    HYPRE_Int     *num_grid_sweeps;
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
@@ -168,6 +179,11 @@ typedef struct
    hypre_ParVector   *Rtemp;
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
+   hypre_ParVector  **kcycle_vectors;   /* c1 and A c1 on accelerated levels */
+   HYPRE_Real        *kcycle_coefs;
+   HYPRE_Int          kcycle_num_vectors;
+   hypre_ParCSRResidualRestrictPlan **fuse_res_plans;  /* fused residual-restriction */
+   HYPRE_Int          fuse_res_num_plans;
 
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
@@ -218,6 +234,7 @@ typedef struct
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
+   HYPRE_Int  *A_piv;
    HYPRE_Real *b_vec;
    HYPRE_Int  *comm_info;
 
@@ -241,6 +258,9 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* Compute residual and restriction in one pass */
+   HYPRE_Int fuse_residual;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -316,6 +336,10 @@ typedef struct
 #define hypre_ParAMGDataMaxIter(amg_data) ((amg_data)->max_iter)
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
+#define hypre_ParAMGDataKCycle(amg_data) ((amg_data)->kcycle)
+#define hypre_ParAMGDataKCycleTol(amg_data) ((amg_data)->kcycle_tol)
+#define hypre_ParAMGDataKCycleNumLevels(amg_data) ((amg_data)->kcycle_num_levels)
+#define hypre_ParAMGDataKCycleLevels(amg_data) ((amg_data)->kcycle_levels)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
@@ -412,6 +436,11 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataKCycleVectors(amg_data) ((amg_data)->kcycle_vectors)
+#define hypre_ParAMGDataKCycleCoefs(amg_data) ((amg_data)->kcycle_coefs)
+#define hypre_ParAMGDataKCycleNumVectors(amg_data) ((amg_data)->kcycle_num_vectors)
+#define hypre_ParAMGDataFuseResPlans(amg_data) ((amg_data)->fuse_res_plans)
+#define hypre_ParAMGDataFuseResNumPlans(amg_data) ((amg_data)->fuse_res_num_plans)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -459,10 +488,18 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomThreshold(amg_data) ((amg_data)->agglom_threshold)
+#define hypre_ParAMGDataAgglomFactor(amg_data) ((amg_data)->agglom_factor)
+#define hypre_ParAMGDataAgglomComms(amg_data) ((amg_data)->agglom_comms)
+#define hypre_ParAMGDataAgglomIdle(amg_data) ((amg_data)->agglom_idle)
+#define hypre_ParAMGDataRepartThreshold(amg_data) ((amg_data)->repart_threshold)
+#define hypre_ParAMGDataRepartImbalance(amg_data) ((amg_data)->repart_imbalance)
+#define hypre_ParAMGDataLocalReordering(amg_data) ((amg_data)->local_reordering)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
 #define hypre_ParAMGDataAInv(amg_data) ((amg_data)->A_inv)
+#define hypre_ParAMGDataAPiv(amg_data) ((amg_data)->A_piv)
 #define hypre_ParAMGDataBVec(amg_data) ((amg_data)->b_vec)
 #define hypre_ParAMGDataCommInfo(amg_data) ((amg_data)->comm_info)
 
@@ -490,6 +527,7 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataFuseResidual(amg_data) ((amg_data)->fuse_residual)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
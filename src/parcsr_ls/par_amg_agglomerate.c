@@ -0,0 +1,479 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Agglomeration, repartitioning and local reordering of coarse AMG levels
+ *
+ * Once a coarse level has few rows per process, its rows are moved onto every
+ * 'factor'-th process of its communicator.  The other processes own an empty
+ * range of rows of this level and leave it: the level and all coarser ones
+ * live on a sub-communicator of the processes that still own rows (see
+ * hypre_GenerateSubComm), on which the coarsening proceeds, and the idle
+ * processes stop their hierarchy at this level.  This is repeated whenever
+ * the rows per process fall below the threshold again.
+ *
+ * The redistribution is folded into the transfer operators.  With Qt the
+ * identity from the new onto the old row partitioning of the coarse level,
+ *
+ *    A_c <- Qt^T A_c Qt,   P <- P Qt,   R <- Qt^T R,
+ *
+ * so that the cycle is unchanged, and the communication packages of the new
+ * operators, built once here, are the cached transfer patterns.  P and R
+ * stay on the communicator of the finer level, so that the idle processes
+ * still take part in the restriction to and the interpolation from the
+ * agglomerated level, but skip the cycle below it.
+ *
+ * Repartitioning instead keeps all processes active and only moves the cuts
+ * between the row ranges of neighboring processes until every process holds
+ * about the same number of nonzeros of A_c, and local reordering renumbers
+ * the rows of every process for cache locality.  Both renumber A_c, P and R
+ * directly (see hypre_ParCSRMatrixRenumber) in place of the products above.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateGrowTemp
+ *
+ * The temporary vectors of the cycle have the local size of the finest
+ * level, which an agglomerated level may exceed.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAgglomerateGrowTemp( hypre_ParVector *vector,
+                                    HYPRE_Int        size )
+{
+   hypre_Vector          *local_vector;
+   HYPRE_MemoryLocation   memory_location;
+
+   if (!vector)
+   {
+      return;
+   }
+
+   local_vector = hypre_ParVectorLocalVector(vector);
+   if (hypre_VectorSize(local_vector) >= size)
+   {
+      return;
+   }
+
+   memory_location = hypre_VectorMemoryLocation(local_vector);
+   hypre_TFree(hypre_VectorData(local_vector), memory_location);
+   hypre_VectorData(local_vector) = NULL;
+   hypre_VectorSize(local_vector) = size;
+   hypre_SeqVectorInitialize_v2(local_vector, memory_location);
+   hypre_ParVectorActualLocalSize(vector) = size;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateSetComm
+ *
+ * Moves A onto 'comm' and rebuilds its communication package there.  Either
+ * the processes of 'comm' own all rows of A, or 'comm' is
+ * hypre_MPI_COMM_SELF on a process without rows, where the assumed
+ * partition does not apply and the package is empty.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAgglomerateSetComm( hypre_ParCSRMatrix *A,
+                                   MPI_Comm            comm )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   if (hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkg(A));
+      hypre_ParCSRMatrixCommPkg(A) = NULL;
+   }
+   if (hypre_ParCSRMatrixCommPkgT(A))
+   {
+      hypre_MatvecCommPkgDestroy(hypre_ParCSRMatrixCommPkgT(A));
+      hypre_ParCSRMatrixCommPkgT(A) = NULL;
+   }
+   if (hypre_ParCSRMatrixAssumedPartition(A) && hypre_ParCSRMatrixOwnsAssumedPartition(A))
+   {
+      hypre_AssumedPartitionDestroy(hypre_ParCSRMatrixAssumedPartition(A));
+   }
+   hypre_ParCSRMatrixAssumedPartition(A) = NULL;
+
+   hypre_ParCSRMatrixComm(A) = comm;
+   if (comm == hypre_MPI_COMM_SELF)
+   {
+      comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm(comm_pkg)          = comm;
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixCommPkg(A) = comm_pkg;
+   }
+   else
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateLevel
+ *
+ * Agglomerates A_array[level] if the number of rows per process of its
+ * communicator is below the agglomeration threshold.  P_array[level - 1]
+ * and, if used, R_array[level - 1] are redistributed accordingly, and the
+ * temporary vectors of the cycle are enlarged if needed.  A_array[level]
+ * is moved onto the sub-communicator of the processes that keep rows, which
+ * is stored in the AMG data; on the other processes, it is moved onto
+ * hypre_MPI_COMM_SELF and hypre_ParAMGDataAgglomIdle is set, upon which the
+ * setup stops the hierarchy at this level.  'stride_ptr' is multiplied by
+ * the reduction of the number of processes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateLevel( void      *amg_vdata,
+                                 HYPRE_Int  level,
+                                 HYPRE_Int *stride_ptr )
+{
+   hypre_ParAMGData     *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array         = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int             threshold       = hypre_ParAMGDataAgglomThreshold(amg_data);
+   HYPRE_Int             factor          = hypre_ParAMGDataAgglomFactor(amg_data);
+   HYPRE_Int             restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int             max_levels      = hypre_ParAMGDataMaxLevels(amg_data);
+
+   hypre_ParCSRMatrix   *A               = A_array[level];
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_BigInt          global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+
+   hypre_ParCSRMatrix   *Qt, *A_new, *P_new, *R_new;
+   hypre_CSRMatrix      *Qt_diag, *Qt_offd;
+   MPI_Comm              sub_comm;
+   HYPRE_BigInt         *old_starts;
+   HYPRE_BigInt          new_starts[2];
+   HYPRE_Int             num_procs, my_id;
+   HYPRE_Int             leader, last, num_rows, i;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (threshold <= 0 || num_procs < 2 ||
+       global_num_rows >= (HYPRE_BigInt) threshold * (HYPRE_BigInt) num_procs)
+   {
+      return hypre_error_flag;
+   }
+
+   /* the processes my_id with my_id % factor == 0 keep rows */
+   factor = hypre_min(factor, num_procs);
+   leader = my_id - my_id % factor;
+   last   = hypre_min(leader + factor, num_procs);
+
+   /* old row partitioning */
+   old_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&first_row, 1, HYPRE_MPI_BIG_INT,
+                       old_starts, 1, HYPRE_MPI_BIG_INT, comm);
+   old_starts[num_procs] = global_num_rows;
+
+   /* a leader takes the rows of its group, the others keep an empty range */
+   new_starts[0] = (my_id == leader) ? old_starts[leader] : old_starts[last];
+   new_starts[1] = old_starts[last];
+   num_rows      = (HYPRE_Int) (old_starts[my_id + 1] - old_starts[my_id]);
+
+   /*-----------------------------------------------------------------------
+    * Qt: the identity from the new onto the old row partitioning.  On the
+    * leaders, all entries are in the diagonal part; on the other processes,
+    * they are in the off-diagonal part.
+    *-----------------------------------------------------------------------*/
+
+   Qt = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_rows,
+                                 hypre_ParCSRMatrixRowStarts(A), new_starts,
+                                 (my_id == leader) ? 0 : num_rows,
+                                 (my_id == leader) ? num_rows : 0,
+                                 (my_id == leader) ? 0 : num_rows);
+   hypre_ParCSRMatrixInitialize_v2(Qt, HYPRE_MEMORY_HOST);
+   Qt_diag = hypre_ParCSRMatrixDiag(Qt);
+   Qt_offd = hypre_ParCSRMatrixOffd(Qt);
+
+   if (my_id == leader)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         hypre_CSRMatrixI(Qt_diag)[i]    = i;
+         hypre_CSRMatrixJ(Qt_diag)[i]    = (HYPRE_Int) (first_row - new_starts[0]) + i;
+         hypre_CSRMatrixData(Qt_diag)[i] = 1.0;
+         hypre_CSRMatrixI(Qt_offd)[i]    = 0;
+      }
+      hypre_CSRMatrixI(Qt_diag)[num_rows] = num_rows;
+      hypre_CSRMatrixI(Qt_offd)[num_rows] = 0;
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         hypre_CSRMatrixI(Qt_offd)[i]    = i;
+         hypre_CSRMatrixJ(Qt_offd)[i]    = i;
+         hypre_CSRMatrixData(Qt_offd)[i] = 1.0;
+         hypre_CSRMatrixI(Qt_diag)[i]    = 0;
+         hypre_ParCSRMatrixColMapOffd(Qt)[i] = first_row + (HYPRE_BigInt) i;
+      }
+      hypre_CSRMatrixI(Qt_offd)[num_rows] = num_rows;
+      hypre_CSRMatrixI(Qt_diag)[num_rows] = 0;
+   }
+   hypre_TFree(old_starts, HYPRE_MEMORY_HOST);
+
+   hypre_MatvecCommPkgCreate(Qt);
+   hypre_ParCSRMatrixMigrate(Qt, memory_location);
+
+   /*-----------------------------------------------------------------------
+    * Redistribute the coarse-grid operator and the transfer operators
+    *-----------------------------------------------------------------------*/
+
+   A_new = hypre_ParCSRMatrixRAP(Qt, A, Qt);
+   hypre_ParCSRMatrixSetNumNonzeros(A_new);
+   hypre_ParCSRMatrixSetDNumNonzeros(A_new);
+   hypre_ParCSRMatrixDestroy(A);
+   A_array[level] = A_new;
+
+   P_new = hypre_ParCSRMatMat(P_array[level - 1], Qt);
+   if (hypre_ParCSRMatrixCommPkg(P_new) == NULL)
+   {
+      hypre_MatvecCommPkgCreate(P_new);
+   }
+   hypre_ParCSRMatrixDestroy(P_array[level - 1]);
+   P_array[level - 1] = P_new;
+
+   if (restri_type && R_array[level - 1])
+   {
+      R_new = hypre_ParCSRTMatMat(Qt, R_array[level - 1]);
+      if (hypre_ParCSRMatrixCommPkg(R_new) == NULL)
+      {
+         hypre_MatvecCommPkgCreate(R_new);
+      }
+      hypre_ParCSRMatrixDestroy(R_array[level - 1]);
+      R_array[level - 1] = R_new;
+   }
+
+   hypre_ParCSRMatrixDestroy(Qt);
+
+   num_rows = (HYPRE_Int) (new_starts[1] - new_starts[0]);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataVtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataPtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataRtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataZtemp(amg_data), num_rows);
+
+   /*-----------------------------------------------------------------------
+    * The processes without rows leave the agglomerated level
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_ParAMGDataAgglomComms(amg_data))
+   {
+      hypre_ParAMGDataAgglomComms(amg_data) = hypre_TAlloc(MPI_Comm, max_levels,
+                                                           HYPRE_MEMORY_HOST);
+      for (i = 0; i < max_levels; i++)
+      {
+         hypre_ParAMGDataAgglomComms(amg_data)[i] = hypre_MPI_COMM_NULL;
+      }
+   }
+   hypre_GenerateSubComm(comm, my_id == leader, &sub_comm);
+   hypre_ParAMGDataAgglomComms(amg_data)[level] = sub_comm;
+
+   if (my_id == leader)
+   {
+      hypre_BoomerAMGAgglomerateSetComm(A_new, sub_comm);
+   }
+   else
+   {
+      hypre_BoomerAMGAgglomerateSetComm(A_new, hypre_MPI_COMM_SELF);
+      hypre_ParAMGDataAgglomIdle(amg_data) = 1;
+   }
+
+   *stride_ptr *= factor;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateDestroyComms
+ *
+ * Frees the sub-communicators of the agglomerated levels.  Called on
+ * (re)setup and by hypre_BoomerAMGDestroy, once the matrices of the levels
+ * are gone.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateDestroyComms( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm          *comms    = hypre_ParAMGDataAgglomComms(amg_data);
+   HYPRE_Int          i;
+
+   if (comms)
+   {
+      for (i = 0; i < hypre_ParAMGDataNumLevels(amg_data); i++)
+      {
+         if (comms[i] != hypre_MPI_COMM_NULL)
+         {
+            hypre_MPI_Comm_free(&comms[i]);
+         }
+      }
+      hypre_TFree(comms, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataAgglomComms(amg_data) = NULL;
+   hypre_ParAMGDataAgglomIdle(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRenumberLevel
+ *
+ * Moves A_array[level] to the numbering new_rows of its rows with the local
+ * ranges new_starts (see hypre_ParCSRMatrixRenumber), together with the
+ * columns of P_array[level - 1] and, if used, the rows of
+ * R_array[level - 1], and enlarges the temporary vectors of the cycle if
+ * needed.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGRenumberLevel( hypre_ParAMGData *amg_data,
+                              HYPRE_Int         level,
+                              HYPRE_BigInt     *new_rows,
+                              HYPRE_BigInt     *new_starts )
+{
+   hypre_ParCSRMatrix  **A_array     = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix  **P_array     = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix  **R_array     = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int             restri_type = hypre_ParAMGDataRestriction(amg_data);
+
+   hypre_ParCSRMatrix   *A_new, *P_new, *R_new;
+   HYPRE_Int             num_rows;
+
+   /* a process that left the agglomerated level owns no rows of it */
+   if (!hypre_ParAMGDataAgglomIdle(amg_data))
+   {
+      hypre_ParCSRMatrixRenumber(A_array[level], new_rows, new_starts, new_rows, new_starts,
+                                 &A_new);
+      hypre_ParCSRMatrixDestroy(A_array[level]);
+      A_array[level] = A_new;
+   }
+
+   hypre_ParCSRMatrixRenumber(P_array[level - 1], NULL, NULL, new_rows, new_starts, &P_new);
+   hypre_ParCSRMatrixDestroy(P_array[level - 1]);
+   P_array[level - 1] = P_new;
+
+   if (restri_type && R_array[level - 1])
+   {
+      hypre_ParCSRMatrixRenumber(R_array[level - 1], new_rows, new_starts, NULL, NULL, &R_new);
+      hypre_ParCSRMatrixDestroy(R_array[level - 1]);
+      R_array[level - 1] = R_new;
+   }
+
+   num_rows = (HYPRE_Int) (new_starts[1] - new_starts[0]);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataVtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataPtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataRtemp(amg_data), num_rows);
+   hypre_BoomerAMGAgglomerateGrowTemp(hypre_ParAMGDataZtemp(amg_data), num_rows);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGLevelImbalance
+ *
+ * Returns the largest over the average number of nonzeros per process of A
+ * (1 for a perfectly balanced matrix).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGLevelImbalance( hypre_ParCSRMatrix *A,
+                               HYPRE_Real         *imbalance_ptr )
+{
+   MPI_Comm    comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Real  local_nnz, max_nnz, sum_nnz;
+   HYPRE_Int   num_procs;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   local_nnz = (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+                             hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)));
+   hypre_MPI_Allreduce(&local_nnz, &max_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(&local_nnz, &sum_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   *imbalance_ptr = (sum_nnz > 0.0) ? max_nnz * (HYPRE_Real) num_procs / sum_nnz : 1.0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRepartitionLevel
+ *
+ * Repartitions A_array[level] if its load imbalance exceeds the
+ * repartitioning threshold, and records the imbalance found.  The rows keep
+ * their global numbering and are cut into contiguous ranges of about equal
+ * number of nonzeros (hypre_ParCSRMatrixComputeRepartition without
+ * coordinates).  P_array[level - 1] and, if used, R_array[level - 1] are
+ * moved to the new partitioning of the coarse level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRepartitionLevel( void      *amg_vdata,
+                                 HYPRE_Int  level )
+{
+   hypre_ParAMGData     *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix   *A          = hypre_ParAMGDataAArray(amg_data)[level];
+   HYPRE_Real            threshold  = hypre_ParAMGDataRepartThreshold(amg_data);
+   HYPRE_Real           *imbalances = hypre_ParAMGDataRepartImbalance(amg_data);
+
+   HYPRE_BigInt         *new_rows;
+   HYPRE_BigInt          new_starts[2];
+   HYPRE_Real            imbalance;
+
+   hypre_BoomerAMGLevelImbalance(A, &imbalance);
+   if (imbalances)
+   {
+      imbalances[level] = imbalance;
+   }
+   if (threshold <= 0.0 || imbalance <= threshold)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixComputeRepartition(A, 0, NULL, &new_rows, new_starts);
+   hypre_BoomerAMGRenumberLevel(amg_data, level, new_rows, new_starts);
+   hypre_TFree(new_rows, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReorderLevel
+ *
+ * Renumbers the local rows of A_array[level] in reverse Cuthill-McKee order
+ * of its diagonal block (hypre_ParCSRMatrixComputeLocalOrdering), for the
+ * cache locality of the matvecs and smoothing sweeps on this level, and
+ * moves P_array[level - 1] and, if used, R_array[level - 1] accordingly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReorderLevel( void      *amg_vdata,
+                             HYPRE_Int  level )
+{
+   hypre_ParAMGData     *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix   *A        = hypre_ParAMGDataAArray(amg_data)[level];
+
+   HYPRE_BigInt         *new_rows;
+   HYPRE_BigInt          new_starts[2];
+
+   new_starts[0] = hypre_ParCSRMatrixRowStarts(A)[0];
+   new_starts[1] = hypre_ParCSRMatrixRowStarts(A)[1];
+
+   hypre_ParCSRMatrixComputeLocalOrdering(A, 0, NULL, &new_rows);
+   hypre_BoomerAMGRenumberLevel(amg_data, level, new_rows, new_starts);
+   hypre_TFree(new_rows, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
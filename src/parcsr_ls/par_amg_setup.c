@@ -211,6 +211,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       ns = num_grid_sweeps[1];
    HYPRE_Real      wall_time;   /* for debugging instrumentation */
    HYPRE_Int       add_end;
+   HYPRE_Int       agglom_stride = 1;
 
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int       dslu_threshold = hypre_ParAMGDataDSLUThreshold(amg_data);
@@ -454,6 +455,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
+      hypre_BoomerAMGKCycleDestroy(amg_data);
+      hypre_BoomerAMGFuseResidualDestroy(amg_data);
 
       if (hypre_ParAMGDataACoarse(amg_data))
       {
@@ -475,6 +478,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
@@ -607,6 +611,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       CF_marker_array = hypre_CTAlloc(hypre_IntArray*, max_levels, HYPRE_MEMORY_HOST);
    }
 
+   /* sub-communicators of the agglomerated levels of the old hierarchy */
+   hypre_BoomerAMGAgglomerateDestroyComms(amg_data);
+
+   /* load imbalance of each level before repartitioning */
+   hypre_TFree(hypre_ParAMGDataRepartImbalance(amg_data), HYPRE_MEMORY_HOST);
+   if (hypre_ParAMGDataRepartThreshold(amg_data) > 0.0 && num_procs > 1)
+   {
+      hypre_ParAMGDataRepartImbalance(amg_data) = hypre_CTAlloc(HYPRE_Real, max_levels,
+                                                                HYPRE_MEMORY_HOST);
+   }
+
    if (num_C_points_coarse > 0)
    {
       k = 0;
@@ -1490,7 +1505,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                HYPRE_Int *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
                HYPRE_Int **grid_relax_points = hypre_ParAMGDataGridRelaxPoints(amg_data);
                if (grid_relax_type[3] ==  9 || grid_relax_type[3] == 99 ||
-                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+                   grid_relax_type[3] == 19 || grid_relax_type[3] == 98 ||
+                   grid_relax_type[3] == 199)
                {
                   grid_relax_type[3] = grid_relax_type[0];
                   num_grid_sweeps[3] = 1;
@@ -2317,7 +2333,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          HYPRE_Int    **grid_relax_points =
             hypre_ParAMGDataGridRelaxPoints(amg_data);
          if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99
-             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98)
+             || grid_relax_type[3] == 19 || grid_relax_type[3] == 98
+             || grid_relax_type[3] == 199)
          {
             grid_relax_type[3] = grid_relax_type[0];
             num_grid_sweeps[3] = 1;
@@ -2930,6 +2947,36 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRMatrixSetDNumNonzeros(A_H);
          }
          A_array[level] = A_H;
+
+         /* restore the load balance of the coarse level */
+         if (hypre_ParAMGDataRepartThreshold(amg_data) > 0.0 && num_procs > 1 &&
+             agglom_stride == 1 && num_functions == 1 && !interp_vec_variant &&
+             num_C_points_coarse <= 0)
+         {
+            hypre_BoomerAMGRepartitionLevel(amg_data, level);
+            A_H = A_array[level];
+         }
+
+         /* agglomerate the coarse level onto fewer processes; the remaining
+            levels are set up on the communicator of these processes */
+         if (hypre_ParAMGDataAgglomThreshold(amg_data) > 0 && num_procs > 1 &&
+             num_functions == 1 && !interp_vec_variant && num_C_points_coarse <= 0 &&
+             addlvl == -1 && !hypre_ParAMGDataFCycle(amg_data) && level >= smooth_num_levels)
+         {
+            hypre_BoomerAMGAgglomerateLevel(amg_data, level, &agglom_stride);
+            A_H = A_array[level];
+            comm = hypre_ParCSRMatrixComm(A_H);
+            hypre_MPI_Comm_size(comm, &num_procs);
+            hypre_MPI_Comm_rank(comm, &my_id);
+         }
+
+         /* reorder the local rows of the coarse level for cache locality */
+         if (hypre_ParAMGDataLocalReordering(amg_data) &&
+             num_functions == 1 && !interp_vec_variant && num_C_points_coarse <= 0)
+         {
+            hypre_BoomerAMGReorderLevel(amg_data, level);
+            A_H = A_array[level];
+         }
       }
 
       size = ((HYPRE_Real) fine_size ) * .75;
@@ -2943,7 +2990,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 #ifdef HYPRE_USING_DSUPERLU
          max_thresh = hypre_max(max_thresh, dslu_threshold);
 #endif
-         if ( (level == max_levels - 1) || (coarse_size <= (HYPRE_BigInt) max_thresh) )
+         if ( (level == max_levels - 1) || (coarse_size <= (HYPRE_BigInt) max_thresh) ||
+              hypre_ParAMGDataAgglomIdle(amg_data) )
          {
             not_finished_coarsening = 0;
          }
@@ -2951,42 +2999,54 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }  /* end of coarsening loop: while (not_finished_coarsening) */
    HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
 
-   /* redundant coarse grid solve */
-   if ((seq_threshold >= coarse_threshold) &&
-       (coarse_size > (HYPRE_BigInt) coarse_threshold) &&
-       (level != max_levels - 1))
-   {
-      hypre_seqAMGSetup(amg_data, level, coarse_threshold);
-   }
-#ifdef HYPRE_USING_DSUPERLU
-   else if ((dslu_threshold >= coarse_threshold) &&
-            (coarse_size > (HYPRE_BigInt)coarse_threshold) &&
-            (level != max_levels - 1))
+   /* back to the communicator of the finest level after agglomeration */
+   if (agglom_stride > 1)
    {
-      HYPRE_Solver dslu_solver;
-      hypre_SLUDistSetup(&dslu_solver, A_array[level], amg_print_level);
-      hypre_ParAMGDataDSLUSolver(amg_data) = dslu_solver;
+      comm = hypre_ParCSRMatrixComm(A);
+      hypre_MPI_Comm_size(comm, &num_procs);
+      hypre_MPI_Comm_rank(comm, &my_id);
    }
-#endif
-   else if (grid_relax_type[3] == 9  ||
-            grid_relax_type[3] == 99 ||
-            grid_relax_type[3] == 199 ) /*use of Gaussian elimination on coarsest level */
+
+   /* the processes that left an agglomerated level have no coarse grid solve */
+   if (!hypre_ParAMGDataAgglomIdle(amg_data))
    {
-      if (coarse_size <= coarse_threshold)
+      /* redundant coarse grid solve */
+      if ((seq_threshold >= coarse_threshold) &&
+          (coarse_size > (HYPRE_BigInt) coarse_threshold) &&
+          (level != max_levels - 1))
       {
-         hypre_GaussElimSetup(amg_data, level, grid_relax_type[3]);
+         hypre_seqAMGSetup(amg_data, level, coarse_threshold);
       }
-      else
+#ifdef HYPRE_USING_DSUPERLU
+      else if ((dslu_threshold >= coarse_threshold) &&
+               (coarse_size > (HYPRE_BigInt)coarse_threshold) &&
+               (level != max_levels - 1))
       {
-         grid_relax_type[3] = grid_relax_type[1];
+         HYPRE_Solver dslu_solver;
+         hypre_SLUDistSetup(&dslu_solver, A_array[level], amg_print_level);
+         hypre_ParAMGDataDSLUSolver(amg_data) = dslu_solver;
       }
-   }
-   else if (grid_relax_type[3] == 19 ||
-            grid_relax_type[3] == 98)  /*use of Gaussian elimination on coarsest level */
-   {
-      if (coarse_size > coarse_threshold)
+#endif
+      else if (grid_relax_type[3] == 9  ||
+               grid_relax_type[3] == 99 ||
+               grid_relax_type[3] == 199 ) /*use of Gaussian elimination on coarsest level */
       {
-         grid_relax_type[3] = grid_relax_type[1];
+         if (coarse_size <= coarse_threshold)
+         {
+            hypre_GaussElimSetup(amg_data, level, grid_relax_type[3]);
+         }
+         else
+         {
+            grid_relax_type[3] = grid_relax_type[1];
+         }
+      }
+      else if (grid_relax_type[3] == 19 ||
+               grid_relax_type[3] == 98)  /*use of Gaussian elimination on coarsest level */
+      {
+         if (coarse_size > coarse_threshold)
+         {
+            grid_relax_type[3] = grid_relax_type[1];
+         }
       }
    }
    HYPRE_ANNOTATE_REGION_END("%s", "Coarse solve");
@@ -3209,6 +3269,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    for (j = 0; j < num_levels; j++)
    {
+      /* a process that left the agglomerated levels does not relax there */
+      if (hypre_ParAMGDataAgglomIdle(amg_data) && j == num_levels - 1)
+      {
+         break;
+      }
+
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(j);
       HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
 
@@ -3645,7 +3711,354 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    }
 #endif
 
+   hypre_BoomerAMGFuseResidualSetup(amg_data);
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return (hypre_error_flag);
 }
+
+/*****************************************************************************
+ * hypre_BoomerAMGSetupNumeric
+ *
+ * Numeric-only setup for a matrix A that has the same parallel layout as the
+ * fine-grid matrix of a previous hypre_BoomerAMGSetup call (for example, the
+ * same sparsity pattern with new coefficients).  The coarse grids (CF
+ * markers) and the interpolation operators are reused; only the Galerkin
+ * coarse-grid operators and the relaxation data that depend on them are
+ * recomputed.  Options whose setup data cannot be refreshed this way fall
+ * back to a full setup.
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_BoomerAMGSetupNumeric( void               *amg_vdata,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *f,
+                             hypre_ParVector    *u )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_IntArray     **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real          *max_eig_est     = hypre_ParAMGDataMaxEigEst(amg_data);
+   HYPRE_Real          *min_eig_est     = hypre_ParAMGDataMinEigEst(amg_data);
+   hypre_Vector       **cheby_ds        = hypre_ParAMGDataChebyDS(amg_data);
+   HYPRE_Real         **cheby_coefs     = hypre_ParAMGDataChebyCoefs(amg_data);
+   hypre_ParVector     *Vtemp           = hypre_ParAMGDataVtemp(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int            rap2            = hypre_ParAMGDataRAP2(amg_data);
+   HYPRE_Int            keepTranspose   = hypre_ParAMGDataKeepTranspose(amg_data);
+
+   hypre_ParCSRMatrix  *A_H;
+   HYPRE_Real          *l1_norm_data;
+   HYPRE_Int           *CF_marker;
+   HYPRE_Int            num_procs, level, l1_type, last;
+   HYPRE_Int            full_setup, full_setup_any;
+   MPI_Comm             new_comm;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+
+   /* Only a plain Galerkin hierarchy built for the same layout can be refreshed.
+      The previous fine-grid matrix may already be gone, so check the layout
+      against the fine-grid work vector.  Some of the data checked here only
+      exists on some processes (e.g. the redundant coarse solver, which is
+      only set up on the processes that own coarse rows), so the decision is
+      reduced over all processes. */
+   full_setup =
+      !A_array || !Vtemp || num_levels < 1 ||
+      hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParVectorGlobalSize(Vtemp) ||
+      hypre_ParCSRMatrixNumRows(A) != hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) ||
+      hypre_ParAMGDataBlockMode(amg_data) ||
+      hypre_ParAMGDataRestriction(amg_data) ||
+      hypre_ParAMGDataAdditive(amg_data) > -1 ||
+      hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+      hypre_ParAMGDataSimple(amg_data) > -1 ||
+      hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+      hypre_ParAMGDataNonGalTolArray(amg_data) ||
+      hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+      hypre_ParAMGDataSeqThreshold(amg_data) > 0 ||
+      hypre_ParAMGDataRedundant(amg_data) ||
+      hypre_ParAMGDataCoarseSolver(amg_data) ||
+      (hypre_ParAMGDataAgglomThreshold(amg_data) > 0 && num_procs > 1) ||
+      (hypre_ParAMGDataRepartThreshold(amg_data) > 0.0 && num_procs > 1) ||
+      hypre_ParAMGDataLocalReordering(amg_data) ||
+      grid_relax_type[1] == 15 || grid_relax_type[3] == 15;
+#ifdef HYPRE_USING_DSUPERLU
+   full_setup = full_setup ||
+                hypre_ParAMGDataDSLUThreshold(amg_data) > 0 ||
+                hypre_ParAMGDataDSLUSolver(amg_data) != NULL;
+#endif
+   hypre_MPI_Allreduce(&full_setup, &full_setup_any, 1, HYPRE_MPI_INT, hypre_MPI_MAX,
+                       hypre_ParCSRMatrixComm(A));
+   if (full_setup_any)
+   {
+      return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_ParCSRMatrixSetNumNonzeros(A);
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   A_array[0] = A;
+
+   /*-----------------------------------------------------------------------
+    * Coarse-grid operators with the stored interpolation operators
+    *-----------------------------------------------------------------------*/
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "RAP");
+
+      if (rap2)
+      {
+         hypre_ParCSRMatrix *Q;
+
+         if (hypre_ParAMGDataModularizedMatMat(amg_data))
+         {
+            Q = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keepTranspose);
+         }
+         else
+         {
+            Q = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParTMatmul(P_array[level], Q);
+         }
+         if (num_procs > 1)
+         {
+            hypre_MatvecCommPkgCreate(A_H);
+         }
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else if (hypre_ParAMGDataModularizedMatMat(amg_data))
+      {
+         A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                       P_array[level], keepTranspose);
+      }
+      else
+      {
+         hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                              P_array[level], keepTranspose, &A_H);
+      }
+
+      hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data),
+                                         hypre_ParAMGDataADropType(amg_data));
+      if (num_procs > 1 && hypre_ParCSRMatrixCommPkg(A_H) == NULL)
+      {
+         hypre_MatvecCommPkgCreate(A_H);
+      }
+      if (hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+      {
+         hypre_ParCSRMatrixSetNumNonzeros(A_H);
+         hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+      }
+
+      hypre_ParCSRMatrixDestroy(A_array[level + 1]);
+      A_array[level + 1] = A_H;
+
+      HYPRE_ANNOTATE_REGION_END("%s", "RAP");
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Coarsest-level direct solve
+    *-----------------------------------------------------------------------*/
+
+   hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataAPiv(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+   new_comm = hypre_ParAMGDataNewComm(amg_data);
+   if (new_comm != hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_free(&new_comm);
+      hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+   }
+   hypre_ParAMGDataGSSetup(amg_data) = 0;
+
+   if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99 || grid_relax_type[3] == 199)
+   {
+      hypre_GaussElimSetup(amg_data, num_levels - 1, grid_relax_type[3]);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Relaxation data (same choices as in hypre_BoomerAMGSetup)
+    *-----------------------------------------------------------------------*/
+
+   for (level = 0; level < num_levels; level++)
+   {
+      HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
+      HYPRE_ANNOTATE_REGION_BEGIN("%s", "Relaxation");
+
+      last = (level == num_levels - 1);
+      CF_marker = (relax_order && !last) ? hypre_IntArrayData(CF_marker_array[level]) : NULL;
+
+      l1_type = 0;
+      if (!last && (grid_relax_type[1] == 18 || grid_relax_type[2] == 18))
+      {
+         l1_type = 1;
+      }
+      else if (!last && (grid_relax_type[1] == 8 || grid_relax_type[1] == 13 ||
+                         grid_relax_type[1] == 14 || grid_relax_type[2] == 8 ||
+                         grid_relax_type[2] == 13 || grid_relax_type[2] == 14))
+      {
+         l1_type = 4;
+      }
+      else if (last && grid_relax_type[3] == 18)
+      {
+         l1_type = 1;
+      }
+      else if (last && (grid_relax_type[3] == 8 || grid_relax_type[3] == 13 ||
+                        grid_relax_type[3] == 14))
+      {
+         l1_type = 4;
+      }
+      if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 || (last && grid_relax_type[3] == 7))
+      {
+         l1_type = 5;
+         CF_marker = NULL;
+      }
+
+      if (l1_norms)
+      {
+         hypre_SeqVectorDestroy(l1_norms[level]);
+         l1_norms[level] = NULL;
+      }
+      if (l1_type)
+      {
+         l1_norm_data = NULL;
+         hypre_ParCSRComputeL1Norms(A_array[level], l1_type, CF_marker, &l1_norm_data);
+
+         l1_norms[level] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[level]));
+         hypre_VectorData(l1_norms[level]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[level],
+                                      hypre_ParCSRMatrixMemoryLocation(A_array[level]));
+      }
+
+      if (l1_type != 5 && (grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
+                           (last && grid_relax_type[3] == 16)))
+      {
+         HYPRE_Int  scale         = hypre_ParAMGDataChebyScale(amg_data);
+         HYPRE_Int  variant       = hypre_ParAMGDataChebyVariant(amg_data);
+         HYPRE_Int  cheby_order   = hypre_ParAMGDataChebyOrder(amg_data);
+         HYPRE_Int  cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
+         HYPRE_Real cheby_frac    = hypre_ParAMGDataChebyFraction(amg_data);
+         HYPRE_Real max_eig, min_eig = 0;
+         HYPRE_Real *coefs = NULL;
+
+         if (cheby_eig_est)
+         {
+            hypre_ParCSRMaxEigEstimateCG(A_array[level], scale, cheby_eig_est,
+                                         &max_eig, &min_eig);
+         }
+         else
+         {
+            hypre_ParCSRMaxEigEstimate(A_array[level], scale, &max_eig, &min_eig);
+         }
+         max_eig_est[level] = max_eig;
+         min_eig_est[level] = min_eig;
+
+         hypre_TFree(cheby_coefs[level], HYPRE_MEMORY_HOST);
+         hypre_SeqVectorDestroy(cheby_ds[level]);
+
+         cheby_ds[level] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[level]));
+         hypre_VectorVectorStride(cheby_ds[level])   = hypre_ParCSRMatrixNumRows(A_array[level]);
+         hypre_VectorIndexStride(cheby_ds[level])    = 1;
+         hypre_VectorMemoryLocation(cheby_ds[level]) =
+            hypre_ParCSRMatrixMemoryLocation(A_array[level]);
+
+         hypre_ParCSRRelax_Cheby_Setup(A_array[level], max_eig, min_eig, cheby_frac,
+                                       cheby_order, scale, variant, &coefs,
+                                       &hypre_VectorData(cheby_ds[level]));
+         cheby_coefs[level] = coefs;
+      }
+
+      HYPRE_ANNOTATE_REGION_END("%s", "Relaxation");
+      HYPRE_ANNOTATE_MGLEVEL_END(level);
+   }
+
+   hypre_BoomerAMGFuseResidualSetup(amg_data);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFuseResidualSetup
+ *
+ * Builds the plans of the fused residual-restriction for all levels but the
+ * coarsest, with one chunk per thread, if the cycle can use it.  Called at
+ * the end of the (numeric) setup, since the plans depend on the sparsity
+ * patterns of the hierarchy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFuseResidualSetup( void *amg_vdata )
+{
+   hypre_ParAMGData                  *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix               **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix               **P_array    = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int                          num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRResidualRestrictPlan **plans;
+   HYPRE_Int                          level;
+
+   hypre_BoomerAMGFuseResidualDestroy(amg_data);
+
+   /* the fused kernel is host-only and does not cover block or R != P^T cycles */
+   if (!hypre_ParAMGDataFuseResidual(amg_data) || num_levels < 2 ||
+       hypre_ParAMGDataBlockMode(amg_data) || hypre_ParAMGDataRestriction(amg_data) ||
+       hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) != HYPRE_EXEC_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   plans = hypre_CTAlloc(hypre_ParCSRResidualRestrictPlan *, num_levels, HYPRE_MEMORY_HOST);
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (A_array[level] && P_array[level])
+      {
+         hypre_ParCSRResidualRestrictPlanCreate(A_array[level], P_array[level],
+                                                hypre_NumThreads(), &plans[level]);
+      }
+   }
+   hypre_ParAMGDataFuseResPlans(amg_data) = plans;
+   hypre_ParAMGDataFuseResNumPlans(amg_data) = num_levels;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFuseResidualDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFuseResidualDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData                  *amg_data  = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRResidualRestrictPlan **plans     = hypre_ParAMGDataFuseResPlans(amg_data);
+   HYPRE_Int                          num_plans = hypre_ParAMGDataFuseResNumPlans(amg_data);
+   HYPRE_Int                          level;
+
+   if (plans)
+   {
+      for (level = 0; level < num_plans; level++)
+      {
+         hypre_ParCSRResidualRestrictPlanDestroy(plans[level]);
+      }
+      hypre_TFree(plans, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataFuseResPlans(amg_data) = NULL;
+   hypre_ParAMGDataFuseResNumPlans(amg_data) = 0;
+
+   return hypre_error_flag;
+}
@@ -66,6 +66,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    /* Local variables  */
    HYPRE_Int      *lev_counter;
+   HYPRE_Int      *kcycle_stage;
    HYPRE_Int       Solve_err_flag;
    HYPRE_Int       k;
    HYPRE_Int       i, j, jj;
@@ -91,6 +92,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       smooth_num_levels;
    HYPRE_Int       my_id;
    HYPRE_Int       restri_type;
+   hypre_ParCSRResidualRestrictPlan **fuse_res_plans;
    HYPRE_Real      alpha;
    hypre_Vector  **l1_norms = NULL;
    hypre_Vector   *l1_norms_level;
@@ -140,6 +142,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    /* RL */
    restri_type = hypre_ParAMGDataRestriction(amg_data);
 
+   /* plans of the fused residual-restriction, built at setup if it applies */
+   fuse_res_plans = hypre_ParAMGDataFuseResPlans(amg_data);
+
    partial_cycle_coarsest_level = hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data);
    partial_cycle_control = hypre_ParAMGDataPartialCycleControl(amg_data);
 
@@ -152,6 +157,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
 
+   /* levels with Krylov-accelerated coarse-grid corrections (K-cycle) */
+   kcycle_stage = hypre_BoomerAMGKCycleInitialize(amg_data);
+
    if (hypre_ParAMGDataParticipate(amg_data))
    {
       seq_cg = 1;
@@ -354,7 +362,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
-      if (cycle_param == 3 && seq_cg)
+      if (cycle_param == 3 && hypre_ParAMGDataAgglomIdle(amg_data))
+      {
+         /* this process left the agglomerated coarsest levels: nothing to do
+            until the interpolation back to the finer level */
+      }
+      else if (cycle_param == 3 && seq_cg)
       {
          HYPRE_ANNOTATE_REGION_BEGIN("%s", "Coarse solve");
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
@@ -629,53 +642,70 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
-         alpha = -1.0;
-         beta = 1.0;
-
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
-         if (block_mode)
+         if (fuse_res_plans && fuse_res_plans[fine_grid])
          {
-            hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
-            hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
-                                          beta, Vtemp);
+            /* F_coarse = P^T (F_fine - A U_fine) without forming the residual */
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual-Restriction");
+            hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], P_array[fine_grid],
+                                               fuse_res_plans[fine_grid],
+                                               U_array[fine_grid], F_array[fine_grid],
+                                               F_array[coarse_grid]);
+            HYPRE_ANNOTATE_REGION_END("%s", "Residual-Restriction");
          }
          else
          {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
-         }
-         HYPRE_ANNOTATE_REGION_END("%s", "Residual");
+            alpha = -1.0;
+            beta = 1.0;
 
-         alpha = 1.0;
-         beta = 0.0;
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Residual");
+            if (block_mode)
+            {
+               hypre_ParVectorCopy(F_array[fine_grid], Vtemp);
+               hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
+                                             beta, Vtemp);
+            }
+            else
+            {
+               // JSP: avoid unnecessary copy using out-of-place version of SpMV
+               hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
+                                                  beta, F_array[fine_grid], Vtemp);
+            }
+            HYPRE_ANNOTATE_REGION_END("%s", "Residual");
 
-         HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
-         if (block_mode)
-         {
-            hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
-                                           beta, F_array[coarse_grid]);
-         }
-         else
-         {
-            if (restri_type)
+            alpha = 1.0;
+            beta = 0.0;
+
+            HYPRE_ANNOTATE_REGION_BEGIN("%s", "Restriction");
+            if (block_mode)
             {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
+               hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
+                                              beta, F_array[coarse_grid]);
             }
             else
             {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
+               if (restri_type)
+               {
+                  /* RL: no transpose for R */
+                  hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
+                                           beta, F_array[coarse_grid]);
+               }
+               else
+               {
+                  hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
+                                            beta, F_array[coarse_grid]);
+               }
             }
+            HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          }
-         HYPRE_ANNOTATE_REGION_END("%s", "Restriction");
          HYPRE_ANNOTATE_MGLEVEL_END(level);
 
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
          cycle_param = 1;
+         if (kcycle_stage && kcycle_stage[level] >= 0)
+         {
+            kcycle_stage[level] = 0;
+         }
          if (level == num_levels - 1)
          {
             cycle_param = 3;
@@ -687,6 +717,17 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
       }
+      else if (level != 0 && kcycle_stage && kcycle_stage[level] >= 0 &&
+               hypre_BoomerAMGKCycleCorrect(amg_data, level, kcycle_stage[level]++,
+                                            F_array, U_array))
+      {
+         /*---------------------------------------------------------------
+          * K-cycle: visit this level again, with the right-hand side
+          * replaced by the residual of the first coarse-grid correction.
+          *--------------------------------------------------------------*/
+         lev_counter[level] = cycle_type;
+         cycle_param = (level == num_levels - 1) ? 3 : 1;
+      }
       else if (level != 0)
       {
          /*---------------------------------------------------------------
@@ -738,6 +779,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
 
    hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+   hypre_TFree(kcycle_stage, HYPRE_MEMORY_HOST);
    hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
 
    if (smooth_num_levels > 0)
@@ -16,6 +16,241 @@
  *
  *------------------------------------------------------------------------ */
 
+/*-------------------------------------------------------------------------
+ * hypre_GaussElimDistributedInverse
+ *
+ * Computes the rows first_row <= k < first_row + num_rows of inv(A) for a
+ * dense matrix A distributed by rows over comm (A_local holds the local
+ * rows, row by row, and displs the row distribution), without ever
+ * gathering A.  This is Gauss-Jordan elimination with partial pivoting on
+ * [A | I]: for each column k, the pivot is chosen among all the rows not
+ * used yet, the pivot row is broadcast from its owner, and every process
+ * eliminates column k from its own rows with one rank-1 update.  The row
+ * that was the pivot of column k ends up holding row k of inv(A), which is
+ * finally sent to the process that owns row k.  Each process stores
+ * O(n * num_rows) values and does O(n^2 * num_rows) work.
+ *
+ * On return, Ainv holds the local rows of inv(A) by columns (leading
+ * dimension num_rows), as used by the solve of relax type 199.
+ *------------------------------------------------------------------------ */
+
+static HYPRE_Int
+hypre_GaussElimDistributedInverse( MPI_Comm     comm,
+                                   HYPRE_Int   *displs,
+                                   HYPRE_Int    num_rows,
+                                   HYPRE_Int    n,
+                                   HYPRE_Real  *A_local,
+                                   HYPRE_Real  *Ainv )
+{
+   HYPRE_Int    num_procs, my_id, first_row;
+   HYPRE_Int    ld = 2 * n;
+   HYPRE_Real  *R, *prow, *f, *cand, *all_cand;
+   HYPRE_Int   *row_col, *piv_proc, *piv_row, *row_proc, *counts, *starts, *pos;
+   HYPRE_Real  *send_buf, *recv_buf;
+   hypre_MPI_Request *requests;
+   HYPRE_Int    num_requests, i, k, p, q, m, one = 1;
+   HYPRE_Real   minus_one = -1.0, val, piv;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   first_row = displs[my_id];
+
+   /* local rows of [A | I], stored by rows (that is, a column-major
+      ld x num_rows matrix for the BLAS) */
+   R = hypre_CTAlloc(HYPRE_Real, ld * num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = 0; k < n; k++)
+      {
+         R[i * ld + k] = A_local[i * n + k];
+      }
+      R[i * ld + n + first_row + i] = 1.0;
+   }
+
+   prow     = hypre_TAlloc(HYPRE_Real, ld, HYPRE_MEMORY_HOST);
+   f        = hypre_TAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+   cand     = hypre_TAlloc(HYPRE_Real, 2, HYPRE_MEMORY_HOST);
+   all_cand = hypre_TAlloc(HYPRE_Real, 2 * num_procs, HYPRE_MEMORY_HOST);
+   row_col  = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   piv_proc = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   piv_row  = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      row_col[i] = -1;
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      /* local pivot candidate among the rows not used yet */
+      cand[0] = -1.0;
+      cand[1] = -1.0;
+      for (i = 0; i < num_rows; i++)
+      {
+         val = hypre_abs(R[i * ld + k]);
+         if (row_col[i] < 0 && val > cand[0])
+         {
+            cand[0] = val;
+            cand[1] = (HYPRE_Real) i;
+         }
+      }
+      hypre_MPI_Allgather(cand, 2, HYPRE_MPI_REAL, all_cand, 2, HYPRE_MPI_REAL, comm);
+
+      /* the same choice on all processes: the largest value, first process on ties */
+      q = 0;
+      for (p = 1; p < num_procs; p++)
+      {
+         if (all_cand[2 * p] > all_cand[2 * q])
+         {
+            q = p;
+         }
+      }
+      if (all_cand[2 * q] <= 0.0)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Singular coarse grid matrix in relax type 199\n");
+         break;
+      }
+      piv_proc[k] = q;
+
+      if (my_id == q)
+      {
+         i = (HYPRE_Int) all_cand[2 * q + 1];
+         row_col[i] = k;
+         piv_row[k] = i;
+         piv = 1.0 / R[i * ld + k];
+         for (m = k; m < ld; m++)
+         {
+            R[i * ld + m] *= piv;
+         }
+         R[i * ld + k] = 1.0;
+         for (m = k; m < ld; m++)
+         {
+            prow[m] = R[i * ld + m];
+         }
+      }
+      hypre_MPI_Bcast(&prow[k], ld - k, HYPRE_MPI_REAL, q, comm);
+
+      /* eliminate column k from all the other rows: R -= prow f^T */
+      for (i = 0; i < num_rows; i++)
+      {
+         f[i] = (row_col[i] == k) ? 0.0 : R[i * ld + k];
+      }
+      m = ld - k;
+      if (num_rows > 0)
+      {
+         hypre_dger(&m, &num_rows, &minus_one, &prow[k], &one, f, &one, &R[k], &ld);
+      }
+   }
+
+   if (k == n)
+   {
+      /* send the right half of each local row to the owner of its row of inv(A) */
+      counts = hypre_CTAlloc(HYPRE_Int, 2 * num_procs, HYPRE_MEMORY_HOST);
+      starts = hypre_CTAlloc(HYPRE_Int, 2 * (num_procs + 1), HYPRE_MEMORY_HOST);
+      pos      = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      row_proc = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+      for (p = 0; p < num_procs; p++)
+      {
+         for (k = displs[p]; k < displs[p + 1]; k++)
+         {
+            row_proc[k] = p;
+         }
+      }
+
+      /* counts[p]: rows sent to p, counts[num_procs + p]: rows received from p */
+      for (i = 0; i < num_rows; i++)
+      {
+         counts[row_proc[row_col[i]]]++;
+      }
+      for (k = first_row; k < first_row + num_rows; k++)
+      {
+         counts[num_procs + piv_proc[k]]++;
+      }
+      for (p = 0; p < num_procs; p++)
+      {
+         starts[p + 1] = starts[p] + counts[p];
+         starts[num_procs + 2 + p] = starts[num_procs + 1 + p] + counts[num_procs + p];
+      }
+
+      send_buf = hypre_TAlloc(HYPRE_Real, n * num_rows, HYPRE_MEMORY_HOST);
+      recv_buf = hypre_TAlloc(HYPRE_Real, n * num_rows, HYPRE_MEMORY_HOST);
+      requests = hypre_CTAlloc(hypre_MPI_Request, 2 * num_procs, HYPRE_MEMORY_HOST);
+
+      /* rows go out in the order of k, which is also the order the owner expects */
+      for (p = 0; p < num_procs; p++)
+      {
+         pos[p] = starts[p];
+      }
+      for (k = 0; k < n; k++)
+      {
+         if (piv_proc[k] != my_id)
+         {
+            continue;
+         }
+         i = piv_row[k];
+         p = row_proc[k];
+         for (m = 0; m < n; m++)
+         {
+            send_buf[pos[p] * n + m] = R[i * ld + n + m];
+         }
+         pos[p]++;
+      }
+
+      num_requests = 0;
+      for (p = 0; p < num_procs; p++)
+      {
+         if (counts[num_procs + p])
+         {
+            hypre_MPI_Irecv(&recv_buf[starts[num_procs + 1 + p] * n], counts[num_procs + p] * n,
+                            HYPRE_MPI_REAL, p, 0, comm, &requests[num_requests++]);
+         }
+      }
+      for (p = 0; p < num_procs; p++)
+      {
+         if (counts[p])
+         {
+            hypre_MPI_Isend(&send_buf[starts[p] * n], counts[p] * n,
+                            HYPRE_MPI_REAL, p, 0, comm, &requests[num_requests++]);
+         }
+      }
+      hypre_MPI_Waitall(num_requests, requests, hypre_MPI_STATUSES_IGNORE);
+
+      for (p = 0; p < num_procs; p++)
+      {
+         pos[p] = starts[num_procs + 1 + p];
+      }
+      for (k = first_row; k < first_row + num_rows; k++)
+      {
+         p = piv_proc[k];
+         for (m = 0; m < n; m++)
+         {
+            Ainv[m * num_rows + k - first_row] = recv_buf[pos[p] * n + m];
+         }
+         pos[p]++;
+      }
+
+      hypre_TFree(counts,   HYPRE_MEMORY_HOST);
+      hypre_TFree(starts,   HYPRE_MEMORY_HOST);
+      hypre_TFree(pos,      HYPRE_MEMORY_HOST);
+      hypre_TFree(row_proc, HYPRE_MEMORY_HOST);
+      hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(R,        HYPRE_MEMORY_HOST);
+   hypre_TFree(prow,     HYPRE_MEMORY_HOST);
+   hypre_TFree(f,        HYPRE_MEMORY_HOST);
+   hypre_TFree(cand,     HYPRE_MEMORY_HOST);
+   hypre_TFree(all_cand, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_col,  HYPRE_MEMORY_HOST);
+   hypre_TFree(piv_proc, HYPRE_MEMORY_HOST);
+   hypre_TFree(piv_row,  HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
 #ifdef HYPRE_PROFILE
@@ -91,8 +326,7 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       hypre_ParAMGDataBVec(amg_data) = hypre_CTAlloc(HYPRE_Real, global_num_rows, HYPRE_MEMORY_HOST);
 
       A_mat_local_size = global_num_rows * num_rows;
-      A_mat_local = hypre_CTAlloc(HYPRE_Real, A_mat_local_size,                HYPRE_MEMORY_HOST);
-      A_mat       = hypre_CTAlloc(HYPRE_Real, global_num_rows * global_num_rows, HYPRE_MEMORY_HOST);
+      A_mat_local = hypre_CTAlloc(HYPRE_Real, A_mat_local_size, HYPRE_MEMORY_HOST);
 
       /* load local matrix into A_mat_local */
       for (i = 0; i < num_rows; i++)
@@ -111,13 +345,31 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
          }
       }
 
-      hypre_MPI_Allgatherv(A_mat_local, A_mat_local_size, HYPRE_MPI_REAL, A_mat, mat_info,
-                           mat_displs, HYPRE_MPI_REAL, new_comm);
+      if (relax_type == 199)
+      {
+         /* Each process only keeps its own rows of inv(A), so that the solve
+          * is a distributed dense matvec, and A is never gathered. */
+         HYPRE_Real *Ainv = hypre_CTAlloc(HYPRE_Real, num_rows * global_num_rows, HYPRE_MEMORY_HOST);
+
+         hypre_GaussElimDistributedInverse(new_comm, displs, num_rows, global_num_rows,
+                                           A_mat_local, Ainv);
+
+         hypre_ParAMGDataAInv(amg_data) = Ainv;
+      }
+      else
+      {
+         A_mat = hypre_CTAlloc(HYPRE_Real, global_num_rows * global_num_rows, HYPRE_MEMORY_HOST);
+         hypre_MPI_Allgatherv(A_mat_local, A_mat_local_size, HYPRE_MPI_REAL, A_mat, mat_info,
+                              mat_displs, HYPRE_MPI_REAL, new_comm);
+      }
 
       if (relax_type == 99)
       {
          HYPRE_Real *AT_mat = hypre_CTAlloc(HYPRE_Real, global_num_rows * global_num_rows,
                                             HYPRE_MEMORY_HOST);
+         HYPRE_Int  *ipiv   = hypre_TAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
+         HYPRE_Int   info;
+
          for (i = 0; i < global_num_rows; i++)
          {
             for (jj = 0; jj < global_num_rows; jj++)
@@ -125,51 +377,22 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
                AT_mat[i * global_num_rows + jj] = A_mat[i + jj * global_num_rows];
             }
          }
+
+         /* write over A with LU; the factors are reused by every solve */
+         hypre_dgetrf(&global_num_rows, &global_num_rows, AT_mat, &global_num_rows, ipiv, &info);
+         if (info != 0)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Singular coarse grid matrix in relax type 99\n");
+         }
+
          hypre_ParAMGDataAMat(amg_data) = AT_mat;
+         hypre_ParAMGDataAPiv(amg_data) = ipiv;
          hypre_TFree(A_mat, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 9)
       {
          hypre_ParAMGDataAMat(amg_data) = A_mat;
       }
-      else if (relax_type == 199)
-      {
-         HYPRE_Real *AT_mat = hypre_TAlloc(HYPRE_Real, global_num_rows * global_num_rows, HYPRE_MEMORY_HOST);
-         HYPRE_Real *Ainv   = hypre_TAlloc(HYPRE_Real, num_rows * global_num_rows,        HYPRE_MEMORY_HOST);
-         for (i = 0; i < global_num_rows; i++)
-         {
-            for (jj = 0; jj < global_num_rows; jj++)
-            {
-               AT_mat[i * global_num_rows + jj] = A_mat[i + jj * global_num_rows];
-            }
-         }
-         HYPRE_Int *ipiv, info, query = -1, lwork;
-         HYPRE_Real lwork_opt, *work;
-         ipiv = hypre_TAlloc(HYPRE_Int, global_num_rows, HYPRE_MEMORY_HOST);
-         hypre_dgetrf(&global_num_rows, &global_num_rows, AT_mat, &global_num_rows, ipiv, &info);
-         hypre_assert(info == 0);
-         hypre_dgetri(&global_num_rows, AT_mat, &global_num_rows, ipiv, &lwork_opt, &query, &info);
-         hypre_assert(info == 0);
-         lwork = lwork_opt;
-         work = hypre_TAlloc(HYPRE_Real, lwork, HYPRE_MEMORY_HOST);
-         hypre_dgetri(&global_num_rows, AT_mat, &global_num_rows, ipiv, work, &lwork, &info);
-         hypre_assert(info == 0);
-
-         for (i = 0; i < global_num_rows; i++)
-         {
-            for (jj = 0; jj < num_rows; jj++)
-            {
-               Ainv[i * num_rows + jj] = AT_mat[i * global_num_rows + jj + first_row_index];
-            }
-         }
-
-         hypre_TFree(ipiv,   HYPRE_MEMORY_HOST);
-         hypre_TFree(A_mat,  HYPRE_MEMORY_HOST);
-         hypre_TFree(AT_mat, HYPRE_MEMORY_HOST);
-         hypre_TFree(work,   HYPRE_MEMORY_HOST);
-
-         hypre_ParAMGDataAInv(amg_data) = Ainv;
-      }
 
       hypre_ParAMGDataCommInfo(amg_data) = comm_info;
       hypre_ParAMGDataNewComm(amg_data)  = new_comm;
@@ -265,11 +488,11 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
          hypre_TFree(f_data_host, HYPRE_MEMORY_HOST);
       }
 
-      if (relax_type == 9 || relax_type == 99)
+      if (relax_type == 9)
       {
          HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
          HYPRE_Real *A_tmp;
-         HYPRE_Int   i, my_info;
+         HYPRE_Int   i;
 
          A_tmp = hypre_CTAlloc(HYPRE_Real, n_global * n_global, HYPRE_MEMORY_HOST);
          for (i = 0; i < n_global * n_global; i++)
@@ -277,29 +500,28 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
             A_tmp[i] = A_mat[i];
          }
 
-         if (relax_type == 9)
+         hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+
+         for (i = 0; i < n; i++)
          {
-            hypre_gselim(A_tmp, b_vec, n_global, error_flag);
+            u_data_host[i] = b_vec[first_row_index + i];
          }
-         else if (relax_type == 99) /* use pivoting */
-         {
-            HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
-
-            /* write over A with LU */
-            hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
 
-            /* now b_vec = inv(A)*b_vec */
-            hypre_dgetrs("N", &n_global, &one_i, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
+         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
+      }
+      else if (relax_type == 99) /* use pivoting */
+      {
+         HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
+         HYPRE_Int  *A_piv = hypre_ParAMGDataAPiv(amg_data);
+         HYPRE_Int   i, my_info;
 
-            hypre_TFree(piv, HYPRE_MEMORY_HOST);
-         }
+         /* now b_vec = inv(A)*b_vec, with the LU factors from the setup */
+         hypre_dgetrs("N", &n_global, &one_i, A_mat, &n_global, A_piv, b_vec, &n_global, &my_info);
 
          for (i = 0; i < n; i++)
          {
             u_data_host[i] = b_vec[first_row_index + i];
          }
-
-         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
       }
       else if (relax_type == 199)
       {
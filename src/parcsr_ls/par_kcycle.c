@@ -0,0 +1,277 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Krylov acceleration of coarse-grid corrections in the AMG cycle (K-cycle)
+ *
+ * On an accelerated level, the coarse-grid correction is not a single cycle
+ * B r, but the best combination of up to two cycles c1 = B r and c2 = B r2,
+ * with r2 = r - alpha A c1, computed by one flexible CG (FCG(1)) or one GCR
+ * step (Notay and Vassilevski, 2008).  The second cycle is skipped if the
+ * first one already reduces the residual norm by the factor kcycle_tol.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCycleInitialize
+ *
+ * Returns an array that marks the accelerated levels with 0 and all other
+ * levels with -1, or NULL if the K-cycle is not used.  In the cycle, the
+ * entries of the accelerated levels count the visits (see below).
+ *
+ * Agglomerated levels, and all coarser ones, are never accelerated: they
+ * live on a sub-communicator, and the processes that left them stop their
+ * hierarchy there, so that the decisions of the K-cycle would not be taken
+ * by all processes of the finest level alike.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int *
+hypre_BoomerAMGKCycleInitialize( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data    = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int             num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int             num_klevels = hypre_ParAMGDataKCycleNumLevels(amg_data);
+   HYPRE_Int            *klevels     = hypre_ParAMGDataKCycleLevels(amg_data);
+   hypre_ParCSRMatrix  **A_array     = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int            *kcycle_stage;
+   HYPRE_Int             i, level, max_level, num_procs, level_procs;
+
+   if (!hypre_ParAMGDataKCycle(amg_data) || num_levels < 2 ||
+       hypre_ParAMGDataBlockMode(amg_data) || hypre_ParAMGDataFCycle(amg_data) ||
+       hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) >= 0)
+   {
+      return NULL;
+   }
+
+   /* levels below max_level are on the communicator of the finest level */
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A_array[0]), &num_procs);
+   for (max_level = 1; max_level < num_levels; max_level++)
+   {
+      hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A_array[max_level]), &level_procs);
+      if (level_procs < num_procs)
+      {
+         break;
+      }
+   }
+
+   kcycle_stage = hypre_TAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   for (level = 0; level < num_levels; level++)
+   {
+      kcycle_stage[level] = -1;
+   }
+
+   if (klevels)
+   {
+      for (i = 0; i < num_klevels; i++)
+      {
+         if (klevels[i] > 0 && klevels[i] < max_level)
+         {
+            kcycle_stage[klevels[i]] = 0;
+         }
+      }
+   }
+   else
+   {
+      /* default: all levels but the finest and the coarsest */
+      for (level = 1; level < hypre_min(max_level, num_levels - 1); level++)
+      {
+         kcycle_stage[level] = 0;
+      }
+   }
+
+   /* the work vectors of the accelerated levels are kept between cycles */
+   if (!hypre_ParAMGDataKCycleVectors(amg_data))
+   {
+      hypre_ParAMGDataKCycleVectors(amg_data) = hypre_CTAlloc(hypre_ParVector *, 2 * num_levels,
+                                                              HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataKCycleCoefs(amg_data) = hypre_CTAlloc(HYPRE_Real, 2 * num_levels,
+                                                            HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataKCycleNumVectors(amg_data) = 2 * num_levels;
+   }
+
+   return kcycle_stage;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCycleDestroy
+ *
+ * Frees the work vectors of the accelerated levels.  Called on (re)setup,
+ * since the hierarchy may change, and by hypre_BoomerAMGDestroy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGKCycleDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData  *amg_data    = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParVector  **kvectors    = hypre_ParAMGDataKCycleVectors(amg_data);
+   HYPRE_Int          num_vectors = hypre_ParAMGDataKCycleNumVectors(amg_data);
+   HYPRE_Int          i;
+
+   if (kvectors)
+   {
+      for (i = 0; i < num_vectors; i++)
+      {
+         hypre_ParVectorDestroy(kvectors[i]);
+      }
+      hypre_TFree(kvectors, HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataKCycleCoefs(amg_data), HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataKCycleVectors(amg_data) = NULL;
+   hypre_ParAMGDataKCycleCoefs(amg_data) = NULL;
+   hypre_ParAMGDataKCycleNumVectors(amg_data) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGKCycleCorrect
+ *
+ * Called by hypre_BoomerAMGCycle each time a cycle on the accelerated
+ * level 'level' has been completed, with 'stage' the number of earlier
+ * cycles on this level for the current right-hand side.
+ *
+ * After the first cycle, U_array[level] = c1 = B r.  If c1 reduces the
+ * residual enough, U_array[level] is set to the scaled correction and 0 is
+ * returned.  Otherwise, c1 and A c1 are saved, F_array[level] is replaced by
+ * the new residual r2, U_array[level] is zeroed, and 1 is returned to ask
+ * for a second cycle on this level.
+ *
+ * After the second cycle, U_array[level] = c2 = B r2, and U_array[level]
+ * is set to the optimal combination of c1 and c2.  Returns 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGKCycleCorrect( void             *amg_vdata,
+                              HYPRE_Int         level,
+                              HYPRE_Int         stage,
+                              hypre_ParVector **F_array,
+                              hypre_ParVector **U_array )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix  *A        = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParVector     *Vtemp    = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector    **kvectors = hypre_ParAMGDataKCycleVectors(amg_data);
+   HYPRE_Int            kcycle   = hypre_ParAMGDataKCycle(amg_data);
+   HYPRE_Real           tol      = hypre_ParAMGDataKCycleTol(amg_data);
+
+   hypre_ParVector     *f = F_array[level];
+   hypre_ParVector     *u = U_array[level];
+   hypre_ParVector     *c1, *v1;
+   hypre_ParVector     *x[3], *y[3];
+   HYPRE_Real          *kcoefs   = hypre_ParAMGDataKCycleCoefs(amg_data) + 2 * level;
+   HYPRE_Real           res[3];
+   HYPRE_Real           rho1, alpha1, gamma, alpha2, rho2, r_norm2, r2_norm2;
+
+   /* work vectors of this level */
+   if (!kvectors[2 * level])
+   {
+      HYPRE_MemoryLocation memory_location = hypre_ParVectorMemoryLocation(f);
+
+      kvectors[2 * level]     = hypre_ParVectorCreate(hypre_ParVectorComm(f),
+                                                      hypre_ParVectorGlobalSize(f),
+                                                      hypre_ParVectorPartitioning(f));
+      kvectors[2 * level + 1] = hypre_ParVectorCreate(hypre_ParVectorComm(f),
+                                                      hypre_ParVectorGlobalSize(f),
+                                                      hypre_ParVectorPartitioning(f));
+      hypre_ParVectorInitialize_v2(kvectors[2 * level], memory_location);
+      hypre_ParVectorInitialize_v2(kvectors[2 * level + 1], memory_location);
+   }
+   c1 = kvectors[2 * level];
+   v1 = kvectors[2 * level + 1];
+
+   HYPRE_ANNOTATE_REGION_BEGIN("%s", "K-cycle");
+
+   if (stage == 0)
+   {
+      /* c1 = u, v1 = A c1 */
+      hypre_ParVectorCopy(u, c1);
+      hypre_ParCSRMatrixMatvec(1.0, A, c1, 0.0, v1);
+
+      /* FCG: rho1 = (c1, v1), alpha1 = (c1, r);  GCR: rho1 = (v1, v1), alpha1 = (v1, r) */
+      x[0] = x[1] = (kcycle == 2) ? v1 : c1;
+      y[0] = v1;
+      y[1] = f;
+      x[2] = y[2] = f;
+      hypre_ParVectorInnerProds(3, x, y, res);
+      rho1    = res[0];
+      alpha1  = res[1];
+      r_norm2 = res[2];
+
+      if (rho1 == 0.0)
+      {
+         HYPRE_ANNOTATE_REGION_END("%s", "K-cycle");
+         return 0;
+      }
+
+      /* r2 = r - (alpha1/rho1) v1 */
+      hypre_ParVectorAxpy(-alpha1 / rho1, v1, f);
+      r2_norm2 = hypre_ParVectorInnerProd(f, f);
+
+      if (r2_norm2 <= tol * tol * r_norm2)
+      {
+         hypre_ParVectorScale(alpha1 / rho1, u);
+
+         HYPRE_ANNOTATE_REGION_END("%s", "K-cycle");
+         return 0;
+      }
+
+      kcoefs[0] = rho1;
+      kcoefs[1] = alpha1;
+      hypre_ParVectorSetConstantValues(u, 0.0);
+
+      HYPRE_ANNOTATE_REGION_END("%s", "K-cycle");
+      return 1;
+   }
+
+   rho1   = kcoefs[0];
+   alpha1 = kcoefs[1];
+
+   /* v2 = A c2 */
+   hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) =
+      hypre_VectorSize(hypre_ParVectorLocalVector(u));
+   hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, Vtemp);
+
+   /* the reduction is over the communicator of x[0], which has to be a vector
+      of this level: Vtemp lives on the communicator of the finest level */
+   x[0] = v1;
+   x[1] = Vtemp;
+   x[2] = f;
+   if (kcycle == 2)
+   {
+      /* GCR: (v1, v2), (v2, v2), (r2, v2); v2 is orthogonalized against v1 implicitly */
+      y[0] = y[1] = y[2] = Vtemp;
+      hypre_ParVectorInnerProds(3, x, y, res);
+      gamma  = res[0] / rho1;
+      rho2   = res[1] - gamma * res[0];
+      alpha2 = (rho2 != 0.0) ? res[2] / rho2 : 0.0;
+
+      /* u = (alpha1/rho1 - alpha2 gamma) c1 + alpha2 c2 */
+      hypre_ParVectorScale(alpha2, u);
+      hypre_ParVectorAxpy(alpha1 / rho1 - alpha2 * gamma, c1, u);
+   }
+   else
+   {
+      /* FCG: (v1, c2), (v2, c2), (r2, c2) */
+      y[0] = y[1] = y[2] = u;
+      hypre_ParVectorInnerProds(3, x, y, res);
+      gamma  = res[0];
+      rho2   = res[1] - gamma * gamma / rho1;
+      alpha2 = (rho2 != 0.0) ? res[2] / rho2 : 0.0;
+
+      /* u = (alpha1/rho1 - gamma alpha2/rho1) c1 + alpha2 c2 */
+      hypre_ParVectorScale(alpha2, u);
+      hypre_ParVectorAxpy((alpha1 - gamma * alpha2) / rho1, c1, u);
+   }
+
+   HYPRE_ANNOTATE_REGION_END("%s", "K-cycle");
+
+   return 0;
+}
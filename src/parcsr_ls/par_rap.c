@@ -212,10 +212,10 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       send_map_elmts_RT = hypre_ParCSRCommPkgSendMapElmts(comm_pkg_RT);
    }
 
-   hypre_CSRMatrixTranspose(RT_diag, &R_diag, 1);
+   hypre_ParCSRMatrixLocalTransposeKT(RT, keepTranspose, &R_diag, NULL);
    if (num_cols_offd_RT)
    {
-      hypre_CSRMatrixTranspose(RT_offd, &R_offd, 1);
+      hypre_ParCSRMatrixLocalTransposeKT(RT, keepTranspose, NULL, &R_offd);
       R_offd_data = hypre_CSRMatrixData(R_offd);
       R_offd_i    = hypre_CSRMatrixI(R_offd);
       R_offd_j    = hypre_CSRMatrixJ(R_offd);
@@ -2010,11 +2010,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *-----------------------------------------------------------------------*/
 
 
-   if (keepTranspose)
-   {
-      hypre_ParCSRMatrixDiagT(RT) = R_diag;
-   }
-   else
+   if (R_diag != hypre_ParCSRMatrixDiagT(RT))
    {
       hypre_CSRMatrixDestroy(R_diag);
    }
@@ -2022,11 +2018,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    if (num_cols_offd_RT)
    {
-      if (keepTranspose)
-      {
-         hypre_ParCSRMatrixOffdT(RT) = R_offd;
-      }
-      else
+      if (R_offd != hypre_ParCSRMatrixOffdT(RT))
       {
          hypre_CSRMatrixDestroy(R_offd);
       }
@@ -23,6 +23,7 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
                            hypre_ParCSRMatrix *A         )
 {
    MPI_Comm          comm = hypre_ParCSRMatrixComm(A);
+   MPI_Comm          level_comm;
 
    hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
 
@@ -151,6 +152,8 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
    HYPRE_Int add_end;
    HYPRE_Int add_rlx;
    HYPRE_Real add_rlx_wt;
+   HYPRE_Real *repart_imbalance;
+   HYPRE_Real imbalance;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -655,7 +658,9 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       send_buff[2] = - min_rowsum;
       send_buff[3] = max_rowsum;
 
-      hypre_MPI_Reduce(send_buff, gather_buff, 4, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, comm);
+      /* agglomerated levels live on a sub-communicator (with rank 0) */
+      level_comm = block_mode ? comm : hypre_ParCSRMatrixComm(A_array[level]);
+      hypre_MPI_Reduce(send_buff, gather_buff, 4, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, level_comm);
 
       if (my_id == 0)
       {
@@ -951,7 +956,8 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       send_buff[4] = - min_weight;
       send_buff[5] = max_weight;
 
-      hypre_MPI_Reduce(send_buff, gather_buff, 6, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, comm);
+      level_comm = block_mode ? comm : hypre_ParCSRMatrixComm(P_array[level]);
+      hypre_MPI_Reduce(send_buff, gather_buff, 6, HYPRE_MPI_REAL, hypre_MPI_MAX, 0, level_comm);
 
       if (my_id == 0)
       {
@@ -971,6 +977,32 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       }
    }
 
+   /*-----------------------------------------------------
+    *  Load balance of the levels, if repartitioning is on
+    *-----------------------------------------------------*/
+
+   repart_imbalance = hypre_ParAMGDataRepartImbalance(amg_data);
+   if (repart_imbalance && !block_mode)
+   {
+      if (my_id == 0)
+      {
+         hypre_printf("\n\nLoad Balance Information (max/avg nonzeros per process):\n\n");
+         hypre_printf("lev   before    after\n");
+         for (i = 0; i < 21; i++) { hypre_printf("%s", "="); }
+         hypre_printf("\n");
+      }
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_BoomerAMGLevelImbalance(A_array[level], &imbalance);
+         if (my_id == 0)
+         {
+            hypre_printf("%3d  %7.3f  %7.3f\n", level,
+                         (repart_imbalance[level] > 0.0) ? repart_imbalance[level] : imbalance,
+                         imbalance);
+         }
+      }
+   }
+
    total_variables = 0;
    operat_cmplxty = 0;
    for (j = 0; j < hypre_ParAMGDataNumLevels(amg_data); j++)
@@ -1006,6 +1038,11 @@ hypre_BoomerAMGSetupStats( void               *amg_vdata,
       {
          hypre_printf( "  Cycle type (1 = V, 2 = W, etc.):  %d\n\n", cycle_type);
       }
+      if (hypre_ParAMGDataKCycle(amg_data))
+      {
+         hypre_printf( "  K-cycle (1 = FCG, 2 = GCR):  %d, tolerance: %e\n\n",
+                       hypre_ParAMGDataKCycle(amg_data), hypre_ParAMGDataKCycleTol(amg_data));
+      }
 
       if (additive == 0 || mult_additive == 0 || simple == 0)
       {
@@ -1378,6 +1415,11 @@ HYPRE_Int    hypre_BoomerAMGWriteSolverParams(void* data)
       {
          hypre_printf( "  Cycle type (1 = V, 2 = W, etc.):  %d\n\n", cycle_type);
       }
+      if (hypre_ParAMGDataKCycle(amg_data))
+      {
+         hypre_printf( "  K-cycle (1 = FCG, 2 = GCR):  %d, tolerance: %e\n\n",
+                       hypre_ParAMGDataKCycle(amg_data), hypre_ParAMGDataKCycleTol(amg_data));
+      }
       hypre_printf( "  Relaxation Parameters:\n");
       hypre_printf( "   Visiting Grid:                     down   up  coarse\n");
       hypre_printf( "            Number of sweeps:         %4d   %2d  %4d \n",
@@ -175,6 +175,7 @@ HYPRE_Int hypre_AMSSetAlphaPoissonMatrix ( void *solver, hypre_ParCSRMatrix *A_P
 HYPRE_Int hypre_AMSSetBetaPoissonMatrix ( void *solver, hypre_ParCSRMatrix *A_G );
 HYPRE_Int hypre_AMSSetInteriorNodes ( void *solver, hypre_ParVector *interior_nodes );
 HYPRE_Int hypre_AMSSetProjectionFrequency ( void *solver, HYPRE_Int projection_frequency );
+HYPRE_Int hypre_AMSSetReuse ( void *solver, HYPRE_Int reuse );
 HYPRE_Int hypre_AMSSetMaxIter ( void *solver, HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver, HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver, HYPRE_Int cycle_type );
@@ -200,6 +201,8 @@ HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *G, hy
                                 hypre_ParVector *Gy, hypre_ParVector *Gz, HYPRE_Int dim, hypre_ParCSRMatrix **GPi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
+HYPRE_Int hypre_AMSSetupNumeric ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
+                                  hypre_ParVector *x );
 HYPRE_Int hypre_AMSSolve ( void *solver, hypre_ParCSRMatrix *A, hypre_ParVector *b,
                            hypre_ParVector *x );
 HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_type,
@@ -208,6 +211,7 @@ HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0, HYPRE_Int A0_relax_
                                      HYPRE_Real A0_cheby_fraction, hypre_ParCSRMatrix **A, HYPRE_Solver *B, HYPRE_PtrToSolverFcn *HB,
                                      hypre_ParCSRMatrix **P, hypre_ParVector **r, hypre_ParVector **g, hypre_ParVector *x,
                                      hypre_ParVector *y, hypre_ParVector *r0, hypre_ParVector *g0, char *cycle, hypre_ParVector *z );
+HYPRE_Int hypre_AMSPixyzCorrection ( void *solver, hypre_ParVector *r, hypre_ParVector *y );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver, HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver, hypre_ParVector *x );
@@ -347,6 +351,7 @@ HYPRE_Int HYPRE_AMSSetAlphaPoissonMatrix ( HYPRE_Solver solver, HYPRE_ParCSRMatr
 HYPRE_Int HYPRE_AMSSetBetaPoissonMatrix ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A_beta );
 HYPRE_Int HYPRE_AMSSetInteriorNodes ( HYPRE_Solver solver, HYPRE_ParVector interior_nodes );
 HYPRE_Int HYPRE_AMSSetProjectionFrequency ( HYPRE_Solver solver, HYPRE_Int projection_frequency );
+HYPRE_Int HYPRE_AMSSetReuse ( HYPRE_Solver solver, HYPRE_Int reuse );
 HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver, HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
@@ -397,6 +402,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int seq_th
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver, HYPRE_Int *seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver, HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver, HYPRE_Int *redundant );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold ( HYPRE_Solver solver, HYPRE_Int agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomFactor ( HYPRE_Solver solver, HYPRE_Int agglom_factor );
+HYPRE_Int HYPRE_BoomerAMGSetRepartThreshold ( HYPRE_Solver solver, HYPRE_Real repart_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetLocalReordering ( HYPRE_Solver solver, HYPRE_Int local_reordering );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver, HYPRE_Real strong_threshold );
@@ -433,6 +442,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_typ
 HYPRE_Int HYPRE_BoomerAMGSetOldDefault ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetFCycle ( HYPRE_Solver solver, HYPRE_Int fcycle );
 HYPRE_Int HYPRE_BoomerAMGGetFCycle ( HYPRE_Solver solver, HYPRE_Int *fcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycle ( HYPRE_Solver solver, HYPRE_Int kcycle );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleTol ( HYPRE_Solver solver, HYPRE_Real kcycle_tol );
+HYPRE_Int HYPRE_BoomerAMGSetKCycleLevels ( HYPRE_Solver solver, HYPRE_Int num_levels,
+                                           HYPRE_Int *levels );
 HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver, HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver, HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver, HYPRE_Int type );
@@ -573,6 +586,7 @@ HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver, HYPRE_Int nongal
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver, HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver, HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver, HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetFuseResidual ( HYPRE_Solver solver, HYPRE_Int fuse_residual );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver, HYPRE_Int slu_threshold );
 #endif
@@ -973,6 +987,10 @@ HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data, HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data, HYPRE_Int *redundant );
+HYPRE_Int hypre_BoomerAMGSetAgglomThreshold ( void *data, HYPRE_Int agglom_threshold );
+HYPRE_Int hypre_BoomerAMGSetAgglomFactor ( void *data, HYPRE_Int agglom_factor );
+HYPRE_Int hypre_BoomerAMGSetRepartThreshold ( void *data, HYPRE_Real repart_threshold );
+HYPRE_Int hypre_BoomerAMGSetLocalReordering ( void *data, HYPRE_Int local_reordering );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data, HYPRE_Real strong_threshold );
 HYPRE_Int hypre_BoomerAMGGetStrongThreshold ( void *data, HYPRE_Real *strong_threshold );
 HYPRE_Int hypre_BoomerAMGSetStrongThresholdR ( void *data, HYPRE_Real strong_threshold );
@@ -1005,6 +1023,9 @@ HYPRE_Int hypre_BoomerAMGSetSetupType ( void *data, HYPRE_Int setup_type );
 HYPRE_Int hypre_BoomerAMGGetSetupType ( void *data, HYPRE_Int *setup_type );
 HYPRE_Int hypre_BoomerAMGSetFCycle ( void *data, HYPRE_Int fcycle );
 HYPRE_Int hypre_BoomerAMGGetFCycle ( void *data, HYPRE_Int *fcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycle ( void *data, HYPRE_Int kcycle );
+HYPRE_Int hypre_BoomerAMGSetKCycleTol ( void *data, HYPRE_Real kcycle_tol );
+HYPRE_Int hypre_BoomerAMGSetKCycleLevels ( void *data, HYPRE_Int num_levels, HYPRE_Int *levels );
 HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data, HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data, HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data, HYPRE_Int type );
@@ -1143,6 +1164,7 @@ HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data, HYPRE_Int nongalerk_num_t
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data, HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data, HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data, HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetFuseResidual ( void *data, HYPRE_Int fuse_residual );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data, HYPRE_Int slu_threshold );
 #endif
@@ -1151,9 +1173,21 @@ HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level,
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points,
                                      HYPRE_BigInt *indices );
 
+/* par_amg_agglomerate.c */
+HYPRE_Int hypre_BoomerAMGAgglomerateLevel ( void *amg_vdata, HYPRE_Int level,
+                                            HYPRE_Int *stride_ptr );
+HYPRE_Int hypre_BoomerAMGAgglomerateDestroyComms ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGLevelImbalance ( hypre_ParCSRMatrix *A, HYPRE_Real *imbalance_ptr );
+HYPRE_Int hypre_BoomerAMGRepartitionLevel ( void *amg_vdata, HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGReorderLevel ( void *amg_vdata, HYPRE_Int level );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
                                  hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGSetupNumeric ( void *amg_vdata, hypre_ParCSRMatrix *A,
+                                        hypre_ParVector *f, hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGFuseResidualSetup ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGFuseResidualDestroy ( void *amg_vdata );
 
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *f,
@@ -1291,6 +1325,12 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A, hypre_IntArray **CF_
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata, hypre_ParVector **F_array,
                                  hypre_ParVector **U_array );
 
+/* par_kcycle.c */
+HYPRE_Int *hypre_BoomerAMGKCycleInitialize ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGKCycleCorrect ( void *amg_vdata, HYPRE_Int level, HYPRE_Int stage,
+                                         hypre_ParVector **F_array, hypre_ParVector **U_array );
+
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
                                      HYPRE_BigInt nz, HYPRE_Int P, HYPRE_Int Q, HYPRE_Int R, HYPRE_Int p, HYPRE_Int q, HYPRE_Int r,
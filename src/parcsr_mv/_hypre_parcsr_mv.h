@@ -413,6 +413,90 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Transpose plan: everything needed to refresh the values of A^T from a
+ * matrix with the same sparsity pattern as A without rebuilding the
+ * structure of A^T
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;       /* local sizes of A */
+   HYPRE_Int             num_cols;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             diag_nnz;
+   HYPRE_Int             offd_nnz;
+
+   HYPRE_Int            *diag_perm;      /* A_diag entry -> AT_diag entry */
+   HYPRE_Int            *offd_perm;      /* A_offd entry -> send buffer entry */
+   HYPRE_Int            *offd_map;       /* recv buffer entry -> AT_offd entry */
+   hypre_ParCSRCommPkg  *comm_pkg;       /* exchange of the transposed offd entries */
+
+} hypre_ParCSRTransposePlan;
+
+#define hypre_ParCSRTransposePlanNumRows(plan)           ((plan) -> num_rows)
+#define hypre_ParCSRTransposePlanNumCols(plan)           ((plan) -> num_cols)
+#define hypre_ParCSRTransposePlanNumColsOffd(plan)       ((plan) -> num_cols_offd)
+#define hypre_ParCSRTransposePlanDiagNnz(plan)           ((plan) -> diag_nnz)
+#define hypre_ParCSRTransposePlanOffdNnz(plan)           ((plan) -> offd_nnz)
+#define hypre_ParCSRTransposePlanDiagPerm(plan)          ((plan) -> diag_perm)
+#define hypre_ParCSRTransposePlanOffdPerm(plan)          ((plan) -> offd_perm)
+#define hypre_ParCSRTransposePlanOffdMap(plan)           ((plan) -> offd_map)
+#define hypre_ParCSRTransposePlanCommPkg(plan)           ((plan) -> comm_pkg)
+
+/*--------------------------------------------------------------------------
+ * Residual-restriction plan: the row ordering and work space used by
+ * hypre_ParCSRMatrixResidualRestrict for a fixed pair of matrices A and P.
+ *
+ * The local rows are split into num_chunks contiguous ranges, one per
+ * thread.  The rows of chunk t are listed in rows[row_starts[3t] :
+ * row_starts[3t+3]], sorted into the three groups of the overlap schedule
+ * (group g in rows[row_starts[3t+g] : row_starts[3t+g+1]]).  rows is NULL
+ * if there are no off-processor couplings, in which case the rows of each
+ * chunk are visited in their natural order.  With more than one chunk,
+ * chunk t accumulates its contributions to the local coarse points
+ * col_first[t] <= j < col_last[t] in its own window of fc_work, and its
+ * off-processor contributions in its own copy of fc_offd.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;       /* local sizes of A and P */
+   HYPRE_Int             num_coarse;
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_Int             num_cols_offd_P;
+   HYPRE_Int             num_chunks;
+
+   HYPRE_Int            *rows;
+   HYPRE_Int            *row_starts;     /* 3 * num_chunks + 1 */
+   HYPRE_Int            *col_first;      /* coarse window of each chunk */
+   HYPRE_Int            *col_last;
+   HYPRE_Int            *work_starts;    /* window offsets in fc_work */
+
+   HYPRE_Complex        *fc_work;
+   HYPRE_Complex        *fc_offd;        /* num_chunks * num_cols_offd_P */
+   HYPRE_Complex        *u_ext;
+   HYPRE_Complex        *u_buf;
+   HYPRE_Complex        *fc_buf;
+
+} hypre_ParCSRResidualRestrictPlan;
+
+#define hypre_ParCSRResidualRestrictPlanNumRows(plan)        ((plan) -> num_rows)
+#define hypre_ParCSRResidualRestrictPlanNumCoarse(plan)      ((plan) -> num_coarse)
+#define hypre_ParCSRResidualRestrictPlanNumColsOffdA(plan)   ((plan) -> num_cols_offd_A)
+#define hypre_ParCSRResidualRestrictPlanNumColsOffdP(plan)   ((plan) -> num_cols_offd_P)
+#define hypre_ParCSRResidualRestrictPlanNumChunks(plan)      ((plan) -> num_chunks)
+#define hypre_ParCSRResidualRestrictPlanRows(plan)           ((plan) -> rows)
+#define hypre_ParCSRResidualRestrictPlanRowStarts(plan)      ((plan) -> row_starts)
+#define hypre_ParCSRResidualRestrictPlanColFirst(plan)       ((plan) -> col_first)
+#define hypre_ParCSRResidualRestrictPlanColLast(plan)        ((plan) -> col_last)
+#define hypre_ParCSRResidualRestrictPlanWorkStarts(plan)     ((plan) -> work_starts)
+#define hypre_ParCSRResidualRestrictPlanFcWork(plan)         ((plan) -> fc_work)
+#define hypre_ParCSRResidualRestrictPlanFcOffd(plan)         ((plan) -> fc_offd)
+#define hypre_ParCSRResidualRestrictPlanUExt(plan)           ((plan) -> u_ext)
+#define hypre_ParCSRResidualRestrictPlanUBuf(plan)           ((plan) -> u_buf)
+#define hypre_ParCSRResidualRestrictPlanFcBuf(plan)          ((plan) -> fc_buf)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -927,6 +1011,14 @@ HYPRE_Int hypre_ParCSRMatrixTransposeHost ( hypre_ParCSRMatrix *A, hypre_ParCSRM
                                             HYPRE_Int data );
 HYPRE_Int hypre_ParCSRMatrixTransposeDevice ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                               HYPRE_Int data );
+HYPRE_Int hypre_ParCSRTransposePlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
+                                            hypre_ParCSRTransposePlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTransposePlanUpdate ( hypre_ParCSRTransposePlan *plan, hypre_ParCSRMatrix *A,
+                                            hypre_ParCSRMatrix *AT );
+HYPRE_Int hypre_ParCSRTransposePlanDestroy ( hypre_ParCSRTransposePlan *plan );
+HYPRE_Int hypre_ParCSRMatrixLocalTransposeKT ( hypre_ParCSRMatrix *A, HYPRE_Int keep_transpose,
+                                               hypre_CSRMatrix **AT_diag_ptr,
+                                               hypre_CSRMatrix **AT_offd_ptr );
 void hypre_ParCSRMatrixGenSpanningTree ( hypre_ParCSRMatrix *G_csr, HYPRE_Int **indices,
                                          HYPRE_Int G_type );
 void hypre_ParCSRMatrixExtractSubmatrices ( hypre_ParCSRMatrix *A_csr, HYPRE_Int *indices2,
@@ -1076,6 +1168,33 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y, HYPRE_Int *CF_marker, HYPRE_Int fpt );
+HYPRE_Int hypre_ParCSRResidualRestrictPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                                   HYPRE_Int num_chunks,
+                                                   hypre_ParCSRResidualRestrictPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRResidualRestrictPlanDestroy ( hypre_ParCSRResidualRestrictPlan *plan );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                               hypre_ParCSRResidualRestrictPlan *plan,
+                                               hypre_ParVector *u, hypre_ParVector *f, hypre_ParVector *fc );
+
+/* par_csr_repartition.c */
+HYPRE_Int hypre_ParCSRMatrixComputeRepartition ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                                 float *coordinates, HYPRE_BigInt **new_rows_ptr,
+                                                 HYPRE_BigInt *new_starts );
+HYPRE_Int hypre_ParCSRMatrixCreatePermutation ( hypre_ParCSRMatrix *A, HYPRE_BigInt *new_rows,
+                                                HYPRE_BigInt *new_starts, hypre_ParCSRMatrix **Q_ptr );
+HYPRE_Int hypre_ParCSRMatrixRenumber ( hypre_ParCSRMatrix *A, HYPRE_BigInt *new_rows,
+                                       HYPRE_BigInt *new_row_starts, HYPRE_BigInt *new_cols,
+                                       HYPRE_BigInt *new_col_starts, hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParCSRMatrixRepartition ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                          float *coordinates, hypre_ParCSRMatrix **Q_ptr,
+                                          hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParCSRMatrixComputeLocalOrdering ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                                   float *coordinates, HYPRE_BigInt **new_rows_ptr );
+HYPRE_Int hypre_ParCSRMatrixReorderLocal ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                           float *coordinates, hypre_ParCSRMatrix **Q_ptr,
+                                           hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParVectorRepartition ( hypre_ParCSRMatrix *Q, hypre_ParVector *x,
+                                       hypre_ParVector **x_new_ptr );
 
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -1129,6 +1248,11 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProds ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                      HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorUseReproSums ( hypre_ParVector *x );
+HYPRE_Int hypre_ParVectorInnerProdsRepro ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                           HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
@@ -25,6 +25,10 @@ main( HYPRE_Int   argc,
    hypre_ParVector     *x2;
    hypre_ParVector     *y;
    hypre_ParVector     *y2;
+   hypre_ParCSRMatrix  *par_rcm, *Q, *matrices[2];
+   hypre_ParVector     *xb, *yb;
+   HYPRE_Int            num_matvecs = 100, k;
+   HYPRE_Real           local_bytes, bytes, wall_time, max_time;
 
    HYPRE_Int          num_procs, my_id;
    HYPRE_Int      local_size;
@@ -41,6 +45,8 @@ main( HYPRE_Int   argc,
    hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &my_id);
 
+   HYPRE_Init();
+
    hypre_printf(" my_id: %d num_procs: %d\n", my_id, num_procs);
 
    if (my_id == 0)
@@ -59,10 +65,20 @@ main( HYPRE_Int   argc,
       col_starts[2] = 3;
       col_starts[3] = 9;
    */
+   /* even row partitioning, given on process 0 */
    row_starts = NULL;
-   col_starts = NULL;
+   if (my_id == 0)
+   {
+      row_starts = hypre_CTAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_procs; i++)
+      {
+         row_starts[i] = (HYPRE_BigInt) hypre_CSRMatrixNumRows(matrix) * i / num_procs;
+      }
+   }
+   col_starts = row_starts;
    par_matrix = hypre_CSRMatrixToParCSRMatrix(hypre_MPI_COMM_WORLD, matrix,
                                               row_starts, col_starts);
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
    hypre_printf(" converted\n");
 
    matrix1 = hypre_ParCSRMatrixToCSRMatrixAll(par_matrix);
@@ -80,8 +96,8 @@ main( HYPRE_Int   argc,
    global_num_rows = hypre_ParCSRMatrixGlobalNumRows(par_matrix);
 
    col_starts = hypre_ParCSRMatrixColStarts(par_matrix);
-   first_index = col_starts[my_id];
-   local_size = (HYPRE_Int)(col_starts[my_id + 1] - first_index);
+   first_index = col_starts[0];
+   local_size = (HYPRE_Int)(col_starts[1] - first_index);
 
    x = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_cols, col_starts);
    hypre_ParVectorInitialize(x);
@@ -97,8 +113,8 @@ main( HYPRE_Int   argc,
    hypre_ParVectorSetConstantValues(x2, 2.0);
 
    row_starts = hypre_ParCSRMatrixRowStarts(par_matrix);
-   first_index = row_starts[my_id];
-   local_size = (HYPRE_Int)(row_starts[my_id + 1] - first_index);
+   first_index = row_starts[0];
+   local_size = (HYPRE_Int)(row_starts[1] - first_index);
    y = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows, row_starts);
    hypre_ParVectorInitialize(y);
    y_local = hypre_ParVectorLocalVector(y);
@@ -128,6 +144,58 @@ main( HYPRE_Int   argc,
 
    hypre_ParVectorPrint(x2, "transp");
 
+   /*-----------------------------------------------------------
+    * Matvec bandwidth before and after the RCM reordering of the
+    * local rows
+    *-----------------------------------------------------------*/
+
+   hypre_ParCSRMatrixReorderLocal(par_matrix, 0, NULL, &Q, &par_rcm);
+   matrices[0] = par_matrix;
+   matrices[1] = par_rcm;
+   for (k = 0; k < 2 && matrices[k]; k++)
+   {
+      xb = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_cols,
+                                 hypre_ParCSRMatrixColStarts(matrices[k]));
+      hypre_ParVectorInitialize(xb);
+      hypre_ParVectorSetConstantValues(xb, 1.0);
+      yb = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, global_num_rows,
+                                 hypre_ParCSRMatrixRowStarts(matrices[k]));
+      hypre_ParVectorInitialize(yb);
+
+      /* compulsory traffic: matrix entries and indices, x and y */
+      local_bytes = (HYPRE_Real)
+                    ((hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(matrices[k])) +
+                      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(matrices[k]))) *
+                     (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+                     2 * (hypre_ParCSRMatrixNumRows(matrices[k]) + 1) * sizeof(HYPRE_Int) +
+                     (hypre_ParCSRMatrixNumCols(matrices[k]) +
+                      hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(matrices[k])) +
+                      hypre_ParCSRMatrixNumRows(matrices[k])) * sizeof(HYPRE_Complex));
+      hypre_MPI_Allreduce(&local_bytes, &bytes, 1, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                          hypre_MPI_COMM_WORLD);
+
+      hypre_ParCSRMatrixMatvec(1.0, matrices[k], xb, 0.0, yb);
+      hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+      wall_time = hypre_MPI_Wtime();
+      for (i = 0; i < num_matvecs; i++)
+      {
+         hypre_ParCSRMatrixMatvec(1.0, matrices[k], xb, 0.0, yb);
+      }
+      wall_time = (hypre_MPI_Wtime() - wall_time) / num_matvecs;
+      hypre_MPI_Allreduce(&wall_time, &max_time, 1, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                          hypre_MPI_COMM_WORLD);
+
+      if (my_id == 0)
+      {
+         hypre_printf(" matvec %-10s %e s  %8.1f MB/s\n", k ? "(RCM)" : "(original)",
+                      max_time, bytes / max_time / 1.0e6);
+      }
+      hypre_ParVectorDestroy(xb);
+      hypre_ParVectorDestroy(yb);
+   }
+   hypre_ParCSRMatrixDestroy(Q);
+   hypre_ParCSRMatrixDestroy(par_rcm);
+
    hypre_ParCSRMatrixDestroy(par_matrix);
    hypre_ParVectorDestroy(x);
    hypre_ParVectorDestroy(x2);
@@ -136,6 +204,8 @@ main( HYPRE_Int   argc,
    if (my_id == 0) { hypre_CSRMatrixDestroy(matrix); }
    if (matrix1) { hypre_CSRMatrixDestroy(matrix1); }
 
+   HYPRE_Finalize();
+
    /* Finalize MPI */
    hypre_MPI_Finalize();
 
@@ -1827,26 +1827,37 @@ hypre_ParCSRMatrixExtractBExt( hypre_ParCSRMatrix *B,
 }
 
 /*--------------------------------------------------------------------------
- * hypre_ParCSRMatrixTransposeHost
+ * hypre_ParCSRMatrixTransposeHostPlan
+ *
+ * Builds AT = A^T. The local transposes are thread-parallel counting sorts.
+ * The transposed offd entries are shipped to their owners with the column
+ * indices and the values in flight at the same time; while they travel, the
+ * position of every incoming entry in AT_offd is worked out from the row
+ * counts, so that they can be scattered in parallel on arrival.
+ *
+ * If plan is not NULL, the permutations and the exchange pattern are saved
+ * in it, see hypre_ParCSRTransposePlanUpdate.
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
-                                 hypre_ParCSRMatrix **AT_ptr,
-                                 HYPRE_Int            data )
+static HYPRE_Int
+hypre_ParCSRMatrixTransposeHostPlan( hypre_ParCSRMatrix         *A,
+                                     hypre_ParCSRMatrix        **AT_ptr,
+                                     HYPRE_Int                   data,
+                                     hypre_ParCSRTransposePlan  *plan )
 {
    MPI_Comm                 comm     = hypre_ParCSRMatrixComm(A);
    hypre_ParCSRCommPkg     *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    hypre_CSRMatrix         *A_diag   = hypre_ParCSRMatrixDiag(A);
    hypre_CSRMatrix         *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int                num_rows = hypre_ParCSRMatrixNumRows(A);
    HYPRE_Int                num_cols = hypre_ParCSRMatrixNumCols(A);
    HYPRE_BigInt             first_row_index = hypre_ParCSRMatrixFirstRowIndex(A);
    HYPRE_BigInt            *row_starts = hypre_ParCSRMatrixRowStarts(A);
    HYPRE_BigInt            *col_starts = hypre_ParCSRMatrixColStarts(A);
 
    HYPRE_Int                num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
-   HYPRE_Int                num_sends, num_recvs, num_cols_offd_AT;
-   HYPRE_Int                i, j, k, index, counter, j_row;
+   HYPRE_Int                num_sends = 0, num_recvs = 0, num_cols_offd_AT;
+   HYPRE_Int                i, j, k, counter, j_row, num_nnz_tmp;
    HYPRE_BigInt             value;
 
    hypre_ParCSRMatrix      *AT;
@@ -1859,15 +1870,20 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
 
    HYPRE_Int               *AT_tmp_i;
    HYPRE_Int               *AT_tmp_j;
-   HYPRE_BigInt            *AT_big_j = NULL;
-   HYPRE_Complex           *AT_tmp_data;
+   HYPRE_BigInt            *AT_tmp_big_j = NULL;
+   HYPRE_Complex           *AT_tmp_data = NULL;
 
-   HYPRE_Int               *AT_buf_i;
+   HYPRE_Int               *AT_buf_i = NULL;
+   HYPRE_Int               *AT_buf_dst;
+   HYPRE_Int               *AT_buf_map;
    HYPRE_BigInt            *AT_buf_j;
-   HYPRE_Complex           *AT_buf_data;
+   HYPRE_BigInt            *AT_buf_tmp;
+   HYPRE_BigInt            *AT_buf_sorted;
+   HYPRE_Complex           *AT_buf_data = NULL;
 
    HYPRE_Int               *AT_offd_i;
    HYPRE_Int               *AT_offd_j;
+   HYPRE_BigInt            *AT_offd_big_j;
    HYPRE_Complex           *AT_offd_data;
    HYPRE_BigInt            *col_map_offd_AT;
    HYPRE_BigInt             row_starts_AT[2];
@@ -1875,14 +1891,16 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
 
    HYPRE_Int                num_procs, my_id;
 
-   HYPRE_Int               *recv_procs, *send_procs;
-   HYPRE_Int               *recv_vec_starts;
-   HYPRE_Int               *send_map_starts;
-   HYPRE_Int               *send_map_elmts;
+   HYPRE_Int               *recv_procs = NULL, *send_procs = NULL;
+   HYPRE_Int               *recv_vec_starts = NULL;
+   HYPRE_Int               *send_map_starts = NULL;
+   HYPRE_Int               *send_map_elmts = NULL;
    HYPRE_Int               *tmp_recv_vec_starts;
    HYPRE_Int               *tmp_send_map_starts;
+   HYPRE_Int               *offd_perm = NULL;
    hypre_ParCSRCommPkg     *tmp_comm_pkg;
    hypre_ParCSRCommHandle  *comm_handle;
+   hypre_ParCSRCommHandle  *comm_handle_data = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
@@ -1906,9 +1924,26 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       comm_pkg = hypre_ParCSRMatrixCommPkg(A);
    }
 
+   if (plan)
+   {
+      hypre_ParCSRTransposePlanNumRows(plan)     = num_rows;
+      hypre_ParCSRTransposePlanNumCols(plan)     = num_cols;
+      hypre_ParCSRTransposePlanNumColsOffd(plan) = num_cols_offd;
+      hypre_ParCSRTransposePlanDiagNnz(plan)     = hypre_CSRMatrixI(A_diag)[num_rows];
+      hypre_ParCSRTransposePlanOffdNnz(plan)     = hypre_CSRMatrixI(A_offd)[num_rows];
+      hypre_ParCSRTransposePlanDiagPerm(plan)    =
+         hypre_CTAlloc(HYPRE_Int, hypre_ParCSRTransposePlanDiagNnz(plan), HYPRE_MEMORY_HOST);
+      if (num_procs > 1)
+      {
+         offd_perm = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRTransposePlanOffdNnz(plan),
+                                   HYPRE_MEMORY_HOST);
+         hypre_ParCSRTransposePlanOffdPerm(plan) = offd_perm;
+      }
+   }
+
    if (num_procs > 1)
    {
-      hypre_CSRMatrixTranspose (A_offd, &AT_tmp, data);
+      hypre_CSRMatrixTransposePerm(A_offd, &AT_tmp, data, offd_perm);
 
       AT_tmp_i = hypre_CSRMatrixI(AT_tmp);
       AT_tmp_j = hypre_CSRMatrixJ(AT_tmp);
@@ -1925,16 +1960,19 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
       send_map_elmts = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
 
-      AT_buf_i = hypre_CTAlloc(HYPRE_Int, send_map_starts[num_sends], HYPRE_MEMORY_HOST);
-      if (AT_tmp_i[num_cols_offd])
+      AT_buf_i = hypre_CTAlloc(HYPRE_Int, send_map_starts[num_sends] + 1, HYPRE_MEMORY_HOST);
+      num_nnz_tmp = AT_tmp_i[num_cols_offd];
+      if (num_nnz_tmp)
       {
-         AT_big_j = hypre_CTAlloc(HYPRE_BigInt, AT_tmp_i[num_cols_offd], HYPRE_MEMORY_HOST);
+         AT_tmp_big_j = hypre_CTAlloc(HYPRE_BigInt, num_nnz_tmp, HYPRE_MEMORY_HOST);
       }
 
-      for (i = 0; i < AT_tmp_i[num_cols_offd]; i++)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_nnz_tmp; i++)
       {
-         //AT_tmp_j[i] += first_row_index;
-         AT_big_j[i] = (HYPRE_BigInt)AT_tmp_j[i] + first_row_index;
+         AT_tmp_big_j[i] = (HYPRE_BigInt)AT_tmp_j[i] + first_row_index;
       }
 
       for (i = 0; i < num_cols_offd; i++)
@@ -1945,7 +1983,8 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       comm_handle = hypre_ParCSRCommHandleCreate(12, comm_pkg, AT_tmp_i, AT_buf_i);
    }
 
-   hypre_CSRMatrixTranspose(A_diag, &AT_diag, data);
+   hypre_CSRMatrixTransposePerm(A_diag, &AT_diag, data,
+                                plan ? hypre_ParCSRTransposePlanDiagPerm(plan) : NULL);
 
    AT_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols + 1, memory_location);
 
@@ -1957,22 +1996,24 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       tmp_send_map_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
       tmp_recv_vec_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
 
-      tmp_send_map_starts[0] = send_map_starts[0];
+      /* turn the received row counts into offsets in the receive buffer */
       for (i = 0; i < num_sends; i++)
       {
-         tmp_send_map_starts[i + 1] = tmp_send_map_starts[i];
          for (j = send_map_starts[i]; j < send_map_starts[i + 1]; j++)
          {
-            tmp_send_map_starts[i + 1] += AT_buf_i[j];
-            AT_offd_i[send_map_elmts[j] + 1] += AT_buf_i[j];
+            k = AT_buf_i[j];
+            AT_buf_i[j] = counter;
+            counter += k;
+            AT_offd_i[send_map_elmts[j] + 1] += k;
          }
+         tmp_send_map_starts[i + 1] = counter;
       }
+      AT_buf_i[send_map_starts[num_sends]] = counter;
       for (i = 0; i < num_cols; i++)
       {
          AT_offd_i[i + 1] += AT_offd_i[i];
       }
 
-      tmp_recv_vec_starts[0] = recv_vec_starts[0];
       for (i = 0; i < num_recvs; i++)
       {
          tmp_recv_vec_starts[i + 1] = tmp_recv_vec_starts[i];
@@ -1986,112 +2027,154 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
       hypre_ParCSRCommPkgComm(tmp_comm_pkg) = comm;
       hypre_ParCSRCommPkgNumSends(tmp_comm_pkg) = num_sends;
       hypre_ParCSRCommPkgNumRecvs(tmp_comm_pkg) = num_recvs;
-      hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg) = recv_procs;
-      hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg) = send_procs;
       hypre_ParCSRCommPkgRecvVecStarts(tmp_comm_pkg) = tmp_recv_vec_starts;
       hypre_ParCSRCommPkgSendMapStarts(tmp_comm_pkg) = tmp_send_map_starts;
+      if (plan)
+      {
+         /* the plan may outlive the comm pkg of A */
+         hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs,
+                                                                   HYPRE_MEMORY_HOST);
+         hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends,
+                                                                   HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg), recv_procs, HYPRE_Int,
+                       num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg), send_procs, HYPRE_Int,
+                       num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         hypre_ParCSRCommPkgRecvProcs(tmp_comm_pkg) = recv_procs;
+         hypre_ParCSRCommPkgSendProcs(tmp_comm_pkg) = send_procs;
+      }
 
-      AT_buf_j = hypre_CTAlloc(HYPRE_BigInt, tmp_send_map_starts[num_sends], HYPRE_MEMORY_HOST);
-      comm_handle = hypre_ParCSRCommHandleCreate(22, tmp_comm_pkg, AT_big_j,
-                                                 AT_buf_j);
-      hypre_ParCSRCommHandleDestroy(comm_handle);
-      comm_handle = NULL;
-      hypre_TFree(AT_big_j, HYPRE_MEMORY_HOST);
-
+      /* column indices and values travel together */
+      AT_buf_j = hypre_CTAlloc(HYPRE_BigInt, counter, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(22, tmp_comm_pkg, AT_tmp_big_j, AT_buf_j);
       if (data)
       {
-         AT_buf_data = hypre_CTAlloc(HYPRE_Complex, tmp_send_map_starts[num_sends], HYPRE_MEMORY_HOST);
-         comm_handle = hypre_ParCSRCommHandleCreate(2, tmp_comm_pkg, AT_tmp_data,
-                                                    AT_buf_data);
-         hypre_ParCSRCommHandleDestroy(comm_handle);
-         comm_handle = NULL;
+         AT_buf_data = hypre_CTAlloc(HYPRE_Complex, counter, HYPRE_MEMORY_HOST);
+         comm_handle_data = hypre_ParCSRCommHandleCreate(2, tmp_comm_pkg, AT_tmp_data,
+                                                         AT_buf_data);
       }
 
-      hypre_TFree(tmp_recv_vec_starts, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_send_map_starts, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
-      hypre_CSRMatrixDestroy(AT_tmp);
+      /* meanwhile, find the position in AT_offd of every incoming entry */
+      AT_buf_dst = hypre_CTAlloc(HYPRE_Int, send_map_starts[num_sends], HYPRE_MEMORY_HOST);
+      AT_buf_map = hypre_CTAlloc(HYPRE_Int, counter, HYPRE_MEMORY_HOST);
+      for (j = 0; j < send_map_starts[num_sends]; j++)
+      {
+         j_row = send_map_elmts[j];
+         AT_buf_dst[j] = AT_offd_i[j_row];
+         AT_offd_i[j_row] += AT_buf_i[j + 1] - AT_buf_i[j];
+      }
+      for (i = num_cols; i > 0; i--)
+      {
+         AT_offd_i[i] = AT_offd_i[i - 1];
+      }
+      AT_offd_i[0] = 0;
 
-      if (AT_offd_i[num_cols])
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(j, k) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < send_map_starts[num_sends]; j++)
       {
-         AT_offd_j = hypre_CTAlloc(HYPRE_Int, AT_offd_i[num_cols], memory_location);
-         AT_big_j = hypre_CTAlloc(HYPRE_BigInt, AT_offd_i[num_cols], HYPRE_MEMORY_HOST);
-         if (data)
+         for (k = AT_buf_i[j]; k < AT_buf_i[j + 1]; k++)
          {
-            AT_offd_data = hypre_CTAlloc(HYPRE_Complex,  AT_offd_i[num_cols], memory_location);
+            AT_buf_map[k] = AT_buf_dst[j] + k - AT_buf_i[j];
          }
       }
-      else
+      hypre_TFree(AT_buf_dst, HYPRE_MEMORY_HOST);
+      hypre_TFree(AT_buf_i, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+      if (data)
       {
-         AT_offd_j = NULL;
-         AT_offd_data = NULL;
+         hypre_ParCSRCommHandleDestroy(comm_handle_data);
+         comm_handle_data = NULL;
       }
+      hypre_TFree(AT_tmp_big_j, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(AT_tmp);
 
-      counter = 0;
-      for (i = 0; i < num_sends; i++)
+      if (plan)
       {
-         for (j = send_map_starts[i]; j < send_map_starts[i + 1]; j++)
-         {
-            j_row = send_map_elmts[j];
-            index = AT_offd_i[j_row];
-            for (k = 0; k < AT_buf_i[j]; k++)
-            {
-               if (data)
-               {
-                  AT_offd_data[index] = AT_buf_data[counter];
-               }
-               AT_big_j[index++] = AT_buf_j[counter++];
-            }
-            AT_offd_i[j_row] = index;
-         }
+         hypre_ParCSRTransposePlanCommPkg(plan) = tmp_comm_pkg;
       }
-      for (i = num_cols; i > 0; i--)
+      else
       {
-         AT_offd_i[i] = AT_offd_i[i - 1];
+         hypre_TFree(tmp_recv_vec_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(tmp_send_map_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(tmp_comm_pkg, HYPRE_MEMORY_HOST);
       }
-      AT_offd_i[0] = 0;
 
+      AT_offd_big_j = NULL;
       if (counter)
       {
-         hypre_BigQsort0(AT_buf_j, 0, counter - 1);
-         num_cols_offd_AT = 1;
-         value = AT_buf_j[0];
-         for (i = 1; i < counter; i++)
+         AT_offd_j = hypre_CTAlloc(HYPRE_Int, counter, memory_location);
+         AT_offd_big_j = hypre_CTAlloc(HYPRE_BigInt, counter, HYPRE_MEMORY_HOST);
+         if (data)
          {
-            if (value < AT_buf_j[i])
-            {
-               AT_buf_j[num_cols_offd_AT++] = AT_buf_j[i];
-               value = AT_buf_j[i];
-            }
+            AT_offd_data = hypre_CTAlloc(HYPRE_Complex, counter, memory_location);
          }
       }
 
-      if (num_cols_offd_AT)
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < counter; k++)
       {
-         col_map_offd_AT = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_AT, HYPRE_MEMORY_HOST);
+         AT_offd_big_j[AT_buf_map[k]] = AT_buf_j[k];
+         if (data)
+         {
+            AT_offd_data[AT_buf_map[k]] = AT_buf_data[k];
+         }
+      }
+      if (plan)
+      {
+         hypre_ParCSRTransposePlanOffdMap(plan) = AT_buf_map;
       }
       else
       {
-         col_map_offd_AT = NULL;
+         hypre_TFree(AT_buf_map, HYPRE_MEMORY_HOST);
       }
+      hypre_TFree(AT_buf_data, HYPRE_MEMORY_HOST);
 
-      for (i = 0; i < num_cols_offd_AT; i++)
+      if (counter)
       {
-         col_map_offd_AT[i] = AT_buf_j[i];
+         AT_buf_tmp = hypre_TAlloc(HYPRE_BigInt, counter, HYPRE_MEMORY_HOST);
+         hypre_big_merge_sort(AT_buf_j, AT_buf_tmp, counter, &AT_buf_sorted);
+         num_cols_offd_AT = 1;
+         value = AT_buf_sorted[0];
+         for (i = 1; i < counter; i++)
+         {
+            if (value < AT_buf_sorted[i])
+            {
+               value = AT_buf_sorted[i];
+               num_cols_offd_AT++;
+            }
+         }
+
+         col_map_offd_AT = hypre_CTAlloc(HYPRE_BigInt, num_cols_offd_AT, HYPRE_MEMORY_HOST);
+         col_map_offd_AT[0] = AT_buf_sorted[0];
+         for (i = 1, k = 1; i < counter; i++)
+         {
+            if (col_map_offd_AT[k - 1] < AT_buf_sorted[i])
+            {
+               col_map_offd_AT[k++] = AT_buf_sorted[i];
+            }
+         }
+         hypre_TFree(AT_buf_tmp, HYPRE_MEMORY_HOST);
       }
-      hypre_TFree(AT_buf_i, HYPRE_MEMORY_HOST);
       hypre_TFree(AT_buf_j, HYPRE_MEMORY_HOST);
-      if (data)
-      {
-         hypre_TFree(AT_buf_data, HYPRE_MEMORY_HOST);
-      }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < counter; i++)
       {
-         AT_offd_j[i] = hypre_BigBinarySearch(col_map_offd_AT, AT_big_j[i],
+         AT_offd_j[i] = hypre_BigBinarySearch(col_map_offd_AT, AT_offd_big_j[i],
                                               num_cols_offd_AT);
       }
-      hypre_TFree(AT_big_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(AT_offd_big_j, HYPRE_MEMORY_HOST);
    }
 
    AT_offd = hypre_CSRMatrixCreate(num_cols, num_cols_offd_AT, counter);
@@ -2145,6 +2228,215 @@ hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixTransposeHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixTransposeHost( hypre_ParCSRMatrix  *A,
+                                 hypre_ParCSRMatrix **AT_ptr,
+                                 HYPRE_Int            data )
+{
+   return hypre_ParCSRMatrixTransposeHostPlan(A, AT_ptr, data, NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanCreate
+ *
+ * Builds AT = A^T together with a plan that allows refreshing the values of
+ * AT with hypre_ParCSRTransposePlanUpdate when only the values of A change.
+ * An update then costs one permutation of the local entries and a single
+ * exchange of values, instead of the local transposes, the exchanges of the
+ * row counts and column indices, and the rebuild of the offd column map.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanCreate( hypre_ParCSRMatrix          *A,
+                                 hypre_ParCSRMatrix         **AT_ptr,
+                                 hypre_ParCSRTransposePlan  **plan_ptr )
+{
+   hypre_ParCSRTransposePlan *plan;
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Transpose plans are not available on the device\n");
+      return hypre_error_flag;
+   }
+#endif
+
+   plan = hypre_CTAlloc(hypre_ParCSRTransposePlan, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixTransposeHostPlan(A, AT_ptr, 1, plan);
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanUpdate
+ *
+ * Copies the values of A into AT = A^T built by hypre_ParCSRTransposePlanCreate
+ * from a matrix with the same sparsity pattern as A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanUpdate( hypre_ParCSRTransposePlan  *plan,
+                                 hypre_ParCSRMatrix         *A,
+                                 hypre_ParCSRMatrix         *AT )
+{
+   hypre_CSRMatrix      *A_diag       = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd       = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex        *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   HYPRE_Complex        *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   HYPRE_Complex        *AT_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(AT));
+   HYPRE_Complex        *AT_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(AT));
+   HYPRE_Int             num_rows     = hypre_ParCSRMatrixNumRows(A);
+   HYPRE_Int             diag_nnz     = hypre_ParCSRTransposePlanDiagNnz(plan);
+   HYPRE_Int             offd_nnz     = hypre_ParCSRTransposePlanOffdNnz(plan);
+   HYPRE_Int            *diag_perm    = hypre_ParCSRTransposePlanDiagPerm(plan);
+   HYPRE_Int            *offd_perm    = hypre_ParCSRTransposePlanOffdPerm(plan);
+   HYPRE_Int            *offd_map     = hypre_ParCSRTransposePlanOffdMap(plan);
+   hypre_ParCSRCommPkg  *comm_pkg     = hypre_ParCSRTransposePlanCommPkg(plan);
+
+   hypre_ParCSRCommHandle  *comm_handle;
+   HYPRE_Complex           *send_buf, *recv_buf;
+   HYPRE_Int                num_recv, k;
+
+   if (num_rows != hypre_ParCSRTransposePlanNumRows(plan) ||
+       hypre_ParCSRMatrixNumCols(A) != hypre_ParCSRTransposePlanNumCols(plan) ||
+       hypre_CSRMatrixNumCols(A_offd) != hypre_ParCSRTransposePlanNumColsOffd(plan) ||
+       hypre_CSRMatrixI(A_diag)[num_rows] != diag_nnz ||
+       hypre_CSRMatrixI(A_offd)[num_rows] != offd_nnz)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix does not match the transpose plan\n");
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < diag_nnz; k++)
+   {
+      AT_diag_data[diag_perm[k]] = A_diag_data[k];
+   }
+
+   if (comm_pkg)
+   {
+      num_recv = hypre_ParCSRCommPkgSendMapStart(comm_pkg, hypre_ParCSRCommPkgNumSends(comm_pkg));
+      send_buf = hypre_TAlloc(HYPRE_Complex, offd_nnz, HYPRE_MEMORY_HOST);
+      recv_buf = hypre_TAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < offd_nnz; k++)
+      {
+         send_buf[offd_perm[k]] = A_offd_data[k];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg, send_buf, recv_buf);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_recv; k++)
+      {
+         AT_offd_data[offd_map[k]] = recv_buf[k];
+      }
+
+      hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buf, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTransposePlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTransposePlanDestroy( hypre_ParCSRTransposePlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_ParCSRTransposePlanDiagPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanOffdPerm(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRTransposePlanOffdMap(plan), HYPRE_MEMORY_HOST);
+      if (hypre_ParCSRTransposePlanCommPkg(plan))
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRTransposePlanCommPkg(plan));
+      }
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixLocalTransposeKT
+ *
+ * Returns the transposes of the diag and/or offd blocks of A (either pointer
+ * may be NULL). Transposes kept on A by an earlier call with keep_transpose
+ * are reused as long as they match the blocks of A; a matrix carrying kept
+ * transposes is never modified in place, as hypre_ParCSRMatrixMatvecT relies
+ * on them. With keep_transpose, new transposes are stored on A. The caller
+ * destroys the returned matrices unless they are the ones kept on A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixLocalTransposeKT( hypre_ParCSRMatrix  *A,
+                                    HYPRE_Int            keep_transpose,
+                                    hypre_CSRMatrix    **AT_diag_ptr,
+                                    hypre_CSRMatrix    **AT_offd_ptr )
+{
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *AT_diag  = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *AT_offd  = hypre_ParCSRMatrixOffdT(A);
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A_diag);
+
+   if (AT_diag_ptr)
+   {
+      if (!AT_diag ||
+          hypre_CSRMatrixNumRows(AT_diag) != hypre_CSRMatrixNumCols(A_diag) ||
+          hypre_CSRMatrixNumCols(AT_diag) != num_rows ||
+          hypre_CSRMatrixNumNonzeros(AT_diag) != hypre_CSRMatrixI(A_diag)[num_rows])
+      {
+         hypre_CSRMatrixDestroy(AT_diag);
+         hypre_ParCSRMatrixDiagT(A) = NULL;
+         hypre_CSRMatrixTranspose(A_diag, &AT_diag, 1);
+         if (keep_transpose)
+         {
+            hypre_ParCSRMatrixDiagT(A) = AT_diag;
+         }
+      }
+      *AT_diag_ptr = AT_diag;
+   }
+
+   if (AT_offd_ptr)
+   {
+      if (!AT_offd ||
+          hypre_CSRMatrixNumRows(AT_offd) != hypre_CSRMatrixNumCols(A_offd) ||
+          hypre_CSRMatrixNumCols(AT_offd) != num_rows ||
+          hypre_CSRMatrixNumNonzeros(AT_offd) != hypre_CSRMatrixI(A_offd)[num_rows])
+      {
+         hypre_CSRMatrixDestroy(AT_offd);
+         hypre_ParCSRMatrixOffdT(A) = NULL;
+         hypre_CSRMatrixTranspose(A_offd, &AT_offd, 1);
+         if (keep_transpose)
+         {
+            hypre_ParCSRMatrixOffdT(A) = AT_offd;
+         }
+      }
+      *AT_offd_ptr = AT_offd;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixTranspose
  *--------------------------------------------------------------------------*/
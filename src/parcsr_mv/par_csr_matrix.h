@@ -139,6 +139,90 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Transpose plan: everything needed to refresh the values of A^T from a
+ * matrix with the same sparsity pattern as A without rebuilding the
+ * structure of A^T
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;       /* local sizes of A */
+   HYPRE_Int             num_cols;
+   HYPRE_Int             num_cols_offd;
+   HYPRE_Int             diag_nnz;
+   HYPRE_Int             offd_nnz;
+
+   HYPRE_Int            *diag_perm;      /* A_diag entry -> AT_diag entry */
+   HYPRE_Int            *offd_perm;      /* A_offd entry -> send buffer entry */
+   HYPRE_Int            *offd_map;       /* recv buffer entry -> AT_offd entry */
+   hypre_ParCSRCommPkg  *comm_pkg;       /* exchange of the transposed offd entries */
+
+} hypre_ParCSRTransposePlan;
+
+#define hypre_ParCSRTransposePlanNumRows(plan)           ((plan) -> num_rows)
+#define hypre_ParCSRTransposePlanNumCols(plan)           ((plan) -> num_cols)
+#define hypre_ParCSRTransposePlanNumColsOffd(plan)       ((plan) -> num_cols_offd)
+#define hypre_ParCSRTransposePlanDiagNnz(plan)           ((plan) -> diag_nnz)
+#define hypre_ParCSRTransposePlanOffdNnz(plan)           ((plan) -> offd_nnz)
+#define hypre_ParCSRTransposePlanDiagPerm(plan)          ((plan) -> diag_perm)
+#define hypre_ParCSRTransposePlanOffdPerm(plan)          ((plan) -> offd_perm)
+#define hypre_ParCSRTransposePlanOffdMap(plan)           ((plan) -> offd_map)
+#define hypre_ParCSRTransposePlanCommPkg(plan)           ((plan) -> comm_pkg)
+
+/*--------------------------------------------------------------------------
+ * Residual-restriction plan: the row ordering and work space used by
+ * hypre_ParCSRMatrixResidualRestrict for a fixed pair of matrices A and P.
+ *
+ * The local rows are split into num_chunks contiguous ranges, one per
+ * thread.  The rows of chunk t are listed in rows[row_starts[3t] :
+ * row_starts[3t+3]], sorted into the three groups of the overlap schedule
+ * (group g in rows[row_starts[3t+g] : row_starts[3t+g+1]]).  rows is NULL
+ * if there are no off-processor couplings, in which case the rows of each
+ * chunk are visited in their natural order.  With more than one chunk,
+ * chunk t accumulates its contributions to the local coarse points
+ * col_first[t] <= j < col_last[t] in its own window of fc_work, and its
+ * off-processor contributions in its own copy of fc_offd.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;       /* local sizes of A and P */
+   HYPRE_Int             num_coarse;
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_Int             num_cols_offd_P;
+   HYPRE_Int             num_chunks;
+
+   HYPRE_Int            *rows;
+   HYPRE_Int            *row_starts;     /* 3 * num_chunks + 1 */
+   HYPRE_Int            *col_first;      /* coarse window of each chunk */
+   HYPRE_Int            *col_last;
+   HYPRE_Int            *work_starts;    /* window offsets in fc_work */
+
+   HYPRE_Complex        *fc_work;
+   HYPRE_Complex        *fc_offd;        /* num_chunks * num_cols_offd_P */
+   HYPRE_Complex        *u_ext;
+   HYPRE_Complex        *u_buf;
+   HYPRE_Complex        *fc_buf;
+
+} hypre_ParCSRResidualRestrictPlan;
+
+#define hypre_ParCSRResidualRestrictPlanNumRows(plan)        ((plan) -> num_rows)
+#define hypre_ParCSRResidualRestrictPlanNumCoarse(plan)      ((plan) -> num_coarse)
+#define hypre_ParCSRResidualRestrictPlanNumColsOffdA(plan)   ((plan) -> num_cols_offd_A)
+#define hypre_ParCSRResidualRestrictPlanNumColsOffdP(plan)   ((plan) -> num_cols_offd_P)
+#define hypre_ParCSRResidualRestrictPlanNumChunks(plan)      ((plan) -> num_chunks)
+#define hypre_ParCSRResidualRestrictPlanRows(plan)           ((plan) -> rows)
+#define hypre_ParCSRResidualRestrictPlanRowStarts(plan)      ((plan) -> row_starts)
+#define hypre_ParCSRResidualRestrictPlanColFirst(plan)       ((plan) -> col_first)
+#define hypre_ParCSRResidualRestrictPlanColLast(plan)        ((plan) -> col_last)
+#define hypre_ParCSRResidualRestrictPlanWorkStarts(plan)     ((plan) -> work_starts)
+#define hypre_ParCSRResidualRestrictPlanFcWork(plan)         ((plan) -> fc_work)
+#define hypre_ParCSRResidualRestrictPlanFcOffd(plan)         ((plan) -> fc_offd)
+#define hypre_ParCSRResidualRestrictPlanUExt(plan)           ((plan) -> u_ext)
+#define hypre_ParCSRResidualRestrictPlanUBuf(plan)           ((plan) -> u_buf)
+#define hypre_ParCSRResidualRestrictPlanFcBuf(plan)          ((plan) -> fc_buf)
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
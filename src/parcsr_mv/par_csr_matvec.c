@@ -872,3 +872,541 @@ hypre_ParCSRMatrixMatvec_FF( HYPRE_Complex       alpha,
 
    return ierr;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrictRows
+ *
+ * For each row i = rows[ii] (or i = ii if rows is NULL), first <= ii < last,
+ * computes r_i = f_i - (A u)_i and accumulates p_ij * r_i into
+ * fc_local[j - fc_first] (diag part of P) or fc_offd[j] (offd part of P).
+ * u_ext holds the off-processor values of u.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixResidualRestrictRows( hypre_CSRMatrix *A_diag,
+                                        hypre_CSRMatrix *A_offd,
+                                        hypre_CSRMatrix *P_diag,
+                                        hypre_CSRMatrix *P_offd,
+                                        HYPRE_Complex   *u_local,
+                                        HYPRE_Complex   *u_ext,
+                                        HYPRE_Complex   *f_local,
+                                        HYPRE_Complex   *fc_local,
+                                        HYPRE_Int        fc_first,
+                                        HYPRE_Complex   *fc_offd,
+                                        HYPRE_Int        first,
+                                        HYPRE_Int        last,
+                                        HYPRE_Int       *rows )
+{
+   HYPRE_Int     *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int     *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int     *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int     *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int     *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int     *P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Complex *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int     *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int     *P_offd_j    = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Complex *P_offd_data = hypre_CSRMatrixData(P_offd);
+
+   HYPRE_Int      ii, i, jj, jj_end;
+   HYPRE_Complex  r;
+
+   for (ii = first; ii < last; ii++)
+   {
+      i = rows ? rows[ii] : ii;
+
+      r = f_local[i];
+      jj_end = A_diag_i[i + 1];
+      for (jj = A_diag_i[i]; jj < jj_end; jj++)
+      {
+         r -= A_diag_data[jj] * u_local[A_diag_j[jj]];
+      }
+      jj_end = A_offd_i[i + 1];
+      for (jj = A_offd_i[i]; jj < jj_end; jj++)
+      {
+         r -= A_offd_data[jj] * u_ext[A_offd_j[jj]];
+      }
+
+      /* bounds are hoisted since the stores below may alias P */
+      jj_end = P_diag_i[i + 1];
+      for (jj = P_diag_i[i]; jj < jj_end; jj++)
+      {
+         fc_local[P_diag_j[jj] - fc_first] += P_diag_data[jj] * r;
+      }
+      jj_end = P_offd_i[i + 1];
+      for (jj = P_offd_i[i]; jj < jj_end; jj++)
+      {
+         fc_offd[P_offd_j[jj]] += P_offd_data[jj] * r;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRResidualRestrictPlanCreate
+ *
+ * Sorts the rows of each chunk into the three groups of the overlap
+ * schedule of hypre_ParCSRMatrixResidualRestrict:
+ *   1: no A_offd entries, some P_offd entries (before u_ext arrives)
+ *   2: some A_offd entries                    (after u_ext arrives)
+ *   3: neither                                (during the P^T exchange)
+ * and allocates the work space.  The plan stays valid as long as the
+ * sparsity patterns of A and P do not change.  The chunks are independent
+ * of the number of threads used later, so the results only depend on
+ * num_chunks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRResidualRestrictPlanCreate( hypre_ParCSRMatrix                *A,
+                                        hypre_ParCSRMatrix                *P,
+                                        HYPRE_Int                          num_chunks,
+                                        hypre_ParCSRResidualRestrictPlan **plan_ptr )
+{
+   hypre_ParCSRResidualRestrictPlan *plan;
+   hypre_ParCSRCommPkg              *A_comm_pkg;
+   hypre_ParCSRCommPkg              *P_comm_pkg;
+
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *P_diag   = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix *P_offd   = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *P_diag_i = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Int       *P_offd_i = hypre_CSRMatrixI(P_offd);
+
+   HYPRE_Int        num_rows        = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int        num_coarse      = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+
+   HYPRE_Int       *rows, *row_starts, *col_first, *col_last, *work_starts;
+   HYPRE_Int        t, g, i, jj, ns, ne, num_offd_rows;
+   HYPRE_Int        pos[3];
+
+   *plan_ptr = NULL;
+
+   if (hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(P) ||
+       num_rows != hypre_CSRMatrixNumRows(P_diag) || num_chunks < 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible sizes in ResidualRestrictPlanCreate!\n");
+      return hypre_error_flag;
+   }
+
+   A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   if (!A_comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+   if (!P_comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(P);
+      P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+   }
+
+   num_chunks = hypre_max(1, hypre_min(num_chunks, num_rows));
+
+   row_starts  = hypre_CTAlloc(HYPRE_Int, 3 * num_chunks + 1, HYPRE_MEMORY_HOST);
+   col_first   = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   col_last    = hypre_CTAlloc(HYPRE_Int, num_chunks, HYPRE_MEMORY_HOST);
+   work_starts = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+
+   num_offd_rows = 0;
+   for (t = 0; t < num_chunks; t++)
+   {
+      hypre_partition1D(num_rows, num_chunks, t, &ns, &ne);
+
+      /* group sizes, and the coarse points reached by the chunk */
+      pos[0] = pos[1] = pos[2] = 0;
+      col_first[t] = num_coarse;
+      col_last[t]  = 0;
+      for (i = ns; i < ne; i++)
+      {
+         if (A_offd_i[i + 1] > A_offd_i[i])
+         {
+            pos[1]++;
+         }
+         else if (P_offd_i[i + 1] > P_offd_i[i])
+         {
+            pos[0]++;
+         }
+         else
+         {
+            pos[2]++;
+         }
+         for (jj = P_diag_i[i]; jj < P_diag_i[i + 1]; jj++)
+         {
+            col_first[t] = hypre_min(col_first[t], P_diag_j[jj]);
+            col_last[t]  = hypre_max(col_last[t], P_diag_j[jj] + 1);
+         }
+      }
+      if (col_first[t] >= col_last[t])
+      {
+         col_first[t] = col_last[t] = 0;
+      }
+
+      for (g = 0; g < 3; g++)
+      {
+         row_starts[3 * t + g + 1] = row_starts[3 * t + g] + pos[g];
+      }
+      work_starts[t + 1] = work_starts[t] + col_last[t] - col_first[t];
+      num_offd_rows += pos[0] + pos[1];
+   }
+
+   /* no off-processor couplings: rows are visited in order, without a list */
+   rows = NULL;
+   if (num_offd_rows > 0)
+   {
+      rows = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      for (t = 0; t < num_chunks; t++)
+      {
+         hypre_partition1D(num_rows, num_chunks, t, &ns, &ne);
+         for (g = 0; g < 3; g++)
+         {
+            pos[g] = row_starts[3 * t + g];
+         }
+         for (i = ns; i < ne; i++)
+         {
+            if (A_offd_i[i + 1] > A_offd_i[i])
+            {
+               rows[pos[1]++] = i;
+            }
+            else if (P_offd_i[i + 1] > P_offd_i[i])
+            {
+               rows[pos[0]++] = i;
+            }
+            else
+            {
+               rows[pos[2]++] = i;
+            }
+         }
+      }
+   }
+
+   plan = hypre_CTAlloc(hypre_ParCSRResidualRestrictPlan, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRResidualRestrictPlanNumRows(plan)      = num_rows;
+   hypre_ParCSRResidualRestrictPlanNumCoarse(plan)    = num_coarse;
+   hypre_ParCSRResidualRestrictPlanNumColsOffdA(plan) = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRResidualRestrictPlanNumColsOffdP(plan) = num_cols_offd_P;
+   hypre_ParCSRResidualRestrictPlanNumChunks(plan)    = num_chunks;
+   hypre_ParCSRResidualRestrictPlanRows(plan)         = rows;
+   hypre_ParCSRResidualRestrictPlanRowStarts(plan)    = row_starts;
+   hypre_ParCSRResidualRestrictPlanColFirst(plan)     = col_first;
+   hypre_ParCSRResidualRestrictPlanColLast(plan)      = col_last;
+   hypre_ParCSRResidualRestrictPlanWorkStarts(plan)   = work_starts;
+
+   /* a single chunk accumulates directly into fc */
+   hypre_ParCSRResidualRestrictPlanFcWork(plan) = (num_chunks > 1) ?
+                                                  hypre_TAlloc(HYPRE_Complex, work_starts[num_chunks],
+                                                               HYPRE_MEMORY_HOST) : NULL;
+   hypre_ParCSRResidualRestrictPlanFcOffd(plan) =
+      hypre_TAlloc(HYPRE_Complex, num_chunks * num_cols_offd_P, HYPRE_MEMORY_HOST);
+   hypre_ParCSRResidualRestrictPlanUExt(plan) =
+      hypre_TAlloc(HYPRE_Complex, hypre_CSRMatrixNumCols(A_offd), HYPRE_MEMORY_HOST);
+   hypre_ParCSRResidualRestrictPlanUBuf(plan) =
+      hypre_TAlloc(HYPRE_Complex,
+                   hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, hypre_ParCSRCommPkgNumSends(A_comm_pkg)),
+                   HYPRE_MEMORY_HOST);
+   hypre_ParCSRResidualRestrictPlanFcBuf(plan) =
+      hypre_TAlloc(HYPRE_Complex,
+                   hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, hypre_ParCSRCommPkgNumSends(P_comm_pkg)),
+                   HYPRE_MEMORY_HOST);
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRResidualRestrictPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRResidualRestrictPlanDestroy( hypre_ParCSRResidualRestrictPlan *plan )
+{
+   if (plan)
+   {
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanRows(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanRowStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanColFirst(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanColLast(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanWorkStarts(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanFcWork(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanFcOffd(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanUExt(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanUBuf(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRResidualRestrictPlanFcBuf(plan), HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrict
+ *
+ * Fused residual and restriction, fc = P^T (f - A u), computed row by row
+ * so that the fine-level residual is never stored.  The halo exchange of u
+ * is overlapped with the rows that do not touch A_offd, and the reverse
+ * exchange of the off-processor contributions to fc is overlapped with the
+ * rows that do not touch P_offd.
+ *
+ * The chunks of the plan are processed by the threads in parallel.  Their
+ * partial sums are added up in chunk order, so the result does not depend
+ * on the number of threads.  If plan is NULL, a plan with one chunk per
+ * thread is built for this call only.
+ *
+ * Host memory and single vectors only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrict( hypre_ParCSRMatrix               *A,
+                                    hypre_ParCSRMatrix               *P,
+                                    hypre_ParCSRResidualRestrictPlan *plan,
+                                    hypre_ParVector                  *u,
+                                    hypre_ParVector                  *f,
+                                    hypre_ParVector                  *fc )
+{
+   hypre_ParCSRResidualRestrictPlan *tmp_plan = NULL;
+   hypre_ParCSRCommPkg              *A_comm_pkg;
+   hypre_ParCSRCommPkg              *P_comm_pkg;
+   hypre_ParCSRCommHandle           *comm_handle;
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *P_diag = hypre_ParCSRMatrixDiag(P);
+   hypre_CSRMatrix *P_offd = hypre_ParCSRMatrixOffd(P);
+
+   HYPRE_Complex   *u_local  = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex   *f_local  = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex   *fc_local = hypre_VectorData(hypre_ParVectorLocalVector(fc));
+
+   HYPRE_Int        num_chunks, num_coarse, num_cols_offd_P, num_sends;
+   HYPRE_Int       *rows, *row_starts, *col_first, *col_last, *work_starts;
+   HYPRE_Complex   *fc_work, *fc_offd, *u_ext, *u_buf, *fc_buf;
+   HYPRE_Complex    sum;
+   HYPRE_Int        i, k, t;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   if (hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(P) ||
+       hypre_ParVectorGlobalSize(fc) != hypre_ParCSRMatrixGlobalNumCols(P))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible sizes in ResidualRestrict!\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   if (!plan)
+   {
+      hypre_ParCSRResidualRestrictPlanCreate(A, P, hypre_NumThreads(), &tmp_plan);
+      plan = tmp_plan;
+      if (!plan)
+      {
+         HYPRE_ANNOTATE_FUNC_END;
+         return hypre_error_flag;
+      }
+   }
+   else if (hypre_ParCSRResidualRestrictPlanNumRows(plan) != hypre_CSRMatrixNumRows(A_diag) ||
+            hypre_ParCSRResidualRestrictPlanNumCoarse(plan) != hypre_CSRMatrixNumCols(P_diag) ||
+            hypre_ParCSRResidualRestrictPlanNumColsOffdA(plan) != hypre_CSRMatrixNumCols(A_offd) ||
+            hypre_ParCSRResidualRestrictPlanNumColsOffdP(plan) != hypre_CSRMatrixNumCols(P_offd))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "ResidualRestrict plan does not match A and P!\n");
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   A_comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   P_comm_pkg      = hypre_ParCSRMatrixCommPkg(P);
+   num_chunks      = hypre_ParCSRResidualRestrictPlanNumChunks(plan);
+   num_coarse      = hypre_ParCSRResidualRestrictPlanNumCoarse(plan);
+   num_cols_offd_P = hypre_ParCSRResidualRestrictPlanNumColsOffdP(plan);
+   rows            = hypre_ParCSRResidualRestrictPlanRows(plan);
+   row_starts      = hypre_ParCSRResidualRestrictPlanRowStarts(plan);
+   col_first       = hypre_ParCSRResidualRestrictPlanColFirst(plan);
+   col_last        = hypre_ParCSRResidualRestrictPlanColLast(plan);
+   work_starts     = hypre_ParCSRResidualRestrictPlanWorkStarts(plan);
+   fc_work         = hypre_ParCSRResidualRestrictPlanFcWork(plan);
+   fc_offd         = hypre_ParCSRResidualRestrictPlanFcOffd(plan);
+   u_ext           = hypre_ParCSRResidualRestrictPlanUExt(plan);
+   u_buf           = hypre_ParCSRResidualRestrictPlanUBuf(plan);
+   fc_buf          = hypre_ParCSRResidualRestrictPlanFcBuf(plan);
+
+   /* start the halo exchange of u */
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   num_sends = hypre_ParCSRCommPkgNumSends(A_comm_pkg);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, num_sends); k++)
+   {
+      u_buf[k] = u_local[hypre_ParCSRCommPkgSendMapElmt(A_comm_pkg, k)];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(1, A_comm_pkg, HYPRE_MEMORY_HOST, u_buf,
+                                                 HYPRE_MEMORY_HOST, u_ext);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   if (num_chunks == 1)
+   {
+      for (i = 0; i < num_coarse; i++)
+      {
+         fc_local[i] = 0.0;
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t, i) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      HYPRE_Complex *fc_t      = (num_chunks > 1) ? fc_work + work_starts[t] : fc_local;
+      HYPRE_Int      fc_t_first = (num_chunks > 1) ? col_first[t] : 0;
+
+      if (num_chunks > 1)
+      {
+         for (i = work_starts[t]; i < work_starts[t + 1]; i++)
+         {
+            fc_work[i] = 0.0;
+         }
+      }
+      for (i = t * num_cols_offd_P; i < (t + 1) * num_cols_offd_P; i++)
+      {
+         fc_offd[i] = 0.0;
+      }
+
+      hypre_ParCSRMatrixResidualRestrictRows(A_diag, A_offd, P_diag, P_offd, u_local, u_ext,
+                                             f_local, fc_t, fc_t_first,
+                                             fc_offd + t * num_cols_offd_P,
+                                             row_starts[3 * t], row_starts[3 * t + 1], rows);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      HYPRE_Complex *fc_t      = (num_chunks > 1) ? fc_work + work_starts[t] : fc_local;
+      HYPRE_Int      fc_t_first = (num_chunks > 1) ? col_first[t] : 0;
+
+      hypre_ParCSRMatrixResidualRestrictRows(A_diag, A_offd, P_diag, P_offd, u_local, u_ext,
+                                             f_local, fc_t, fc_t_first,
+                                             fc_offd + t * num_cols_offd_P,
+                                             row_starts[3 * t + 1], row_starts[3 * t + 2], rows);
+   }
+
+   /* all contributions to fc_offd are in: add them up in the first copy */
+   if (num_chunks > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(k, t, sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_cols_offd_P; k++)
+      {
+         sum = fc_offd[k];
+         for (t = 1; t < num_chunks; t++)
+         {
+            sum += fc_offd[t * num_cols_offd_P + k];
+         }
+         fc_offd[k] = sum;
+      }
+   }
+
+   /* start the reverse exchange */
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   comm_handle = hypre_ParCSRCommHandleCreate_v2(2, P_comm_pkg, HYPRE_MEMORY_HOST, fc_offd,
+                                                 HYPRE_MEMORY_HOST, fc_buf);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_chunks; t++)
+   {
+      HYPRE_Complex *fc_t      = (num_chunks > 1) ? fc_work + work_starts[t] : fc_local;
+      HYPRE_Int      fc_t_first = (num_chunks > 1) ? col_first[t] : 0;
+
+      hypre_ParCSRMatrixResidualRestrictRows(A_diag, A_offd, P_diag, P_offd, u_local, u_ext,
+                                             f_local, fc_t, fc_t_first,
+                                             fc_offd + t * num_cols_offd_P,
+                                             row_starts[3 * t + 2], row_starts[3 * t + 3], rows);
+   }
+
+   /* add up the windows of the chunks, in chunk order */
+   if (num_chunks > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i, t, sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_coarse; i++)
+      {
+         sum = 0.0;
+         for (t = 0; t < num_chunks; t++)
+         {
+            if (i >= col_first[t] && i < col_last[t])
+            {
+               sum += fc_work[work_starts[t] + i - col_first[t]];
+            }
+         }
+         fc_local[i] = sum;
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   -= hypre_MPI_Wtime();
+#endif
+
+   /* the send map may list a coarse point more than once */
+   num_sends = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+   for (k = 0; k < hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends); k++)
+   {
+      fc_local[hypre_ParCSRCommPkgSendMapElmt(P_comm_pkg, k)] += fc_buf[k];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRResidualRestrictPlanDestroy(tmp_plan);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,1270 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Load-balancing repartitioning and local reordering of ParCSR matrices
+ *
+ * Every row gets a key: its position along a Hilbert space-filling curve
+ * through the bounding box of the given coordinates, or its global index if
+ * there are no coordinates.  The rows are then cut into contiguous key ranges
+ * of about equal weight (number of nonzeros) and renumbered process by
+ * process in key order.
+ *
+ * The renumbering is applied through the permutation matrix Q with
+ * Q(i, new(i)) = 1, whose rows follow the old and whose columns follow the
+ * new row partitioning:
+ *
+ *    A_new = Q^T A Q,   x_new = Q^T x,   x = Q x_new.
+ *
+ * A local reordering keeps the partitioning and only renumbers the rows of
+ * every process for cache locality, along the Hilbert curve through the
+ * local bounding box or in reverse Cuthill-McKee order of the diagonal
+ * block.  It is applied through Q in the same way.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/* bits per coordinate of the space-filling curve key (at most 62 bits) */
+#define hypre_REPARTITION_KEY_BITS(ndim) ((ndim) > 2 ? 20 : 31)
+
+/*--------------------------------------------------------------------------
+ * hypre_RepartitionSwap, hypre_RepartitionQsort
+ *
+ * Sorts the (key, tie-break) pairs in v lexicographically and permutes w
+ * along.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RepartitionSwap( hypre_longlongint *v,
+                       HYPRE_Int         *w,
+                       HYPRE_Int          i,
+                       HYPRE_Int          j )
+{
+   hypre_longlongint  tv;
+   HYPRE_Int          tw;
+
+   tv = v[2 * i];     v[2 * i]     = v[2 * j];     v[2 * j]     = tv;
+   tv = v[2 * i + 1]; v[2 * i + 1] = v[2 * j + 1]; v[2 * j + 1] = tv;
+   tw = w[i];         w[i]         = w[j];         w[j]         = tw;
+}
+
+static void
+hypre_RepartitionQsort( hypre_longlongint *v,
+                        HYPRE_Int         *w,
+                        HYPRE_Int          left,
+                        HYPRE_Int          right )
+{
+   HYPRE_Int i, last;
+
+   if (left >= right)
+   {
+      return;
+   }
+   hypre_RepartitionSwap(v, w, left, (left + right) / 2);
+   last = left;
+   for (i = left + 1; i <= right; i++)
+   {
+      if ( v[2 * i] < v[2 * left] ||
+           (v[2 * i] == v[2 * left] && v[2 * i + 1] < v[2 * left + 1]) )
+      {
+         hypre_RepartitionSwap(v, w, ++last, i);
+      }
+   }
+   hypre_RepartitionSwap(v, w, left, last);
+   hypre_RepartitionQsort(v, w, left, last - 1);
+   hypre_RepartitionQsort(v, w, last + 1, right);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RepartitionHilbertKey
+ *
+ * Position of the integer point X (ndim coordinates of 'bits' bits each)
+ * along the Hilbert curve (J. Skilling, AIP Conf. Proc. 707, 2004).
+ * X is overwritten.
+ *--------------------------------------------------------------------------*/
+
+static hypre_longlongint
+hypre_RepartitionHilbertKey( HYPRE_Int           ndim,
+                             HYPRE_Int           bits,
+                             hypre_ulonglongint *X )
+{
+   hypre_ulonglongint  M = ((hypre_ulonglongint) 1) << (bits - 1);
+   hypre_ulonglongint  P, Q, t;
+   hypre_ulonglongint  key = 0;
+   HYPRE_Int           i, b;
+
+   /* inverse undo of the excess work */
+   for (Q = M; Q > 1; Q >>= 1)
+   {
+      P = Q - 1;
+      for (i = 0; i < ndim; i++)
+      {
+         if (X[i] & Q)
+         {
+            X[0] ^= P;
+         }
+         else
+         {
+            t = (X[0] ^ X[i]) & P;
+            X[0] ^= t;
+            X[i] ^= t;
+         }
+      }
+   }
+
+   /* Gray encode */
+   for (i = 1; i < ndim; i++)
+   {
+      X[i] ^= X[i - 1];
+   }
+   t = 0;
+   for (Q = M; Q > 1; Q >>= 1)
+   {
+      if (X[ndim - 1] & Q)
+      {
+         t ^= Q - 1;
+      }
+   }
+   for (i = 0; i < ndim; i++)
+   {
+      X[i] ^= t;
+   }
+
+   /* interleave the transposed bits */
+   for (b = bits - 1; b >= 0; b--)
+   {
+      for (i = 0; i < ndim; i++)
+      {
+         key = (key << 1) | ((X[i] >> b) & 1);
+      }
+   }
+
+   return (hypre_longlongint) key;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RepartitionCurveKeys
+ *
+ * Hilbert curve keys of the num_rows points in coordinates (coord_dim
+ * values per point, ndim of them used) within the bounding box cmin, cmax.
+ * The keys are stored in keys[2 * i].
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RepartitionCurveKeys( HYPRE_Int          num_rows,
+                            HYPRE_Int          coord_dim,
+                            HYPRE_Int          ndim,
+                            float             *coordinates,
+                            HYPRE_Real        *cmin,
+                            HYPRE_Real        *cmax,
+                            hypre_longlongint *keys )
+{
+   HYPRE_Int           bits = hypre_REPARTITION_KEY_BITS(ndim);
+   hypre_ulonglongint  X[3];
+   HYPRE_Real          scale;
+   HYPRE_Int           i, d;
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         scale = cmax[d] - cmin[d];
+         X[d] = (scale > 0.0) ?
+                (hypre_ulonglongint) ((coordinates[i * coord_dim + d] - cmin[d]) / scale *
+                                      (HYPRE_Real) ((((hypre_ulonglongint) 1) << bits) - 1)) : 0;
+      }
+      keys[2 * i] = hypre_RepartitionHilbertKey(ndim, bits, X);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixComputeRepartition
+ *
+ * Computes a row partitioning of A balanced in the number of nonzeros.  If
+ * coordinates are given (coord_dim values per local row, stored row by row
+ * as for hypre_BoomerAMGSetCoordinates), the rows are ordered along a
+ * space-filling curve, which keeps neighboring rows together; rows with the
+ * same coordinates, e.g., the unknowns of one node, stay on one process.
+ * Otherwise the global row order is kept and only the cuts are moved.
+ *
+ * On output, new_rows[i] is the new global index of local row i (allocated
+ * here), and new_starts[0:1] is the local range of rows of the new
+ * partitioning.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixComputeRepartition( hypre_ParCSRMatrix  *A,
+                                      HYPRE_Int            coord_dim,
+                                      float               *coordinates,
+                                      HYPRE_BigInt       **new_rows_ptr,
+                                      HYPRE_BigInt        *new_starts )
+{
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int             num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+
+   HYPRE_Int            *diag_i, *offd_i;
+   HYPRE_Int             ndim;
+   HYPRE_Real           *cmin, *cmax;
+
+   hypre_longlongint    *keys, *recv_keys;
+   HYPRE_Int            *order, *recv_order;
+   HYPRE_Real           *wsum, *wcut, *target;
+   hypre_longlongint    *lo, *hi, mid;
+   hypre_longlongint     max_key, global_max_key;
+   HYPRE_Real            total;
+   HYPRE_Int             active;
+
+   HYPRE_Int            *send_counts, *recv_counts;
+   HYPRE_Int            *send_starts, *recv_starts;
+   HYPRE_BigInt         *send_rows, *recv_rows;
+   HYPRE_Int             num_new, num_requests;
+   HYPRE_BigInt          num_new_big, new_first;
+   hypre_MPI_Request    *requests;
+   hypre_MPI_Status     *status;
+
+   HYPRE_BigInt         *new_rows;
+   HYPRE_Int             num_procs, i, j, k, d, lb, ub, m;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   new_rows = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Keys, sorted locally; ties are broken by the old global index
+    *-----------------------------------------------------------------------*/
+
+   ndim = (coordinates) ? hypre_min(coord_dim, 3) : 0;
+   keys = hypre_TAlloc(hypre_longlongint, 2 * num_rows, HYPRE_MEMORY_HOST);
+   order = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   if (ndim > 0)
+   {
+      cmin = hypre_TAlloc(HYPRE_Real, 2 * ndim, HYPRE_MEMORY_HOST);
+      cmax = hypre_TAlloc(HYPRE_Real, 2 * ndim, HYPRE_MEMORY_HOST);
+      for (d = 0; d < ndim; d++)
+      {
+         cmin[d] = HYPRE_REAL_MAX;
+         cmax[d] = -HYPRE_REAL_MAX;
+      }
+      for (i = 0; i < num_rows; i++)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            cmin[d] = hypre_min(cmin[d], (HYPRE_Real) coordinates[i * coord_dim + d]);
+            cmax[d] = hypre_max(cmax[d], (HYPRE_Real) coordinates[i * coord_dim + d]);
+         }
+      }
+      hypre_MPI_Allreduce(cmin, cmin + ndim, ndim, HYPRE_MPI_REAL, hypre_MPI_MIN, comm);
+      hypre_MPI_Allreduce(cmax, cmax + ndim, ndim, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+      hypre_RepartitionCurveKeys(num_rows, coord_dim, ndim, coordinates,
+                                 cmin + ndim, cmax + ndim, keys);
+      hypre_TFree(cmin, HYPRE_MEMORY_HOST);
+      hypre_TFree(cmax, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         keys[2 * i] = (hypre_longlongint) (first_row + i);
+      }
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      keys[2 * i + 1] = (hypre_longlongint) (first_row + i);
+      order[i] = i;
+   }
+   hypre_RepartitionQsort(keys, order, 0, num_rows - 1);
+
+   /* weights: number of nonzeros per row, summed up in key order */
+   diag_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(diag_i, hypre_CSRMatrixI(A_diag), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, memory_location);
+   hypre_TMemcpy(offd_i, hypre_CSRMatrixI(A_offd), HYPRE_Int, num_rows + 1,
+                 HYPRE_MEMORY_HOST, memory_location);
+
+   wsum = hypre_TAlloc(HYPRE_Real, num_rows + 1, HYPRE_MEMORY_HOST);
+   wsum[0] = 0.0;
+   for (i = 0; i < num_rows; i++)
+   {
+      j = order[i];
+      wsum[i + 1] = wsum[i] + (HYPRE_Real) hypre_max(1, diag_i[j + 1] - diag_i[j] +
+                                                       offd_i[j + 1] - offd_i[j]);
+   }
+   hypre_TFree(diag_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_i, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Cuts: the smallest key lo[k] with a weight of at least k/num_procs of
+    * the total below it, found by simultaneous bisection of all cuts
+    *-----------------------------------------------------------------------*/
+
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   if (num_procs > 1)
+   {
+      max_key = (num_rows > 0) ? keys[2 * (num_rows - 1)] : 0;
+      hypre_MPI_Allreduce(&max_key, &global_max_key, 1, hypre_MPI_LONG_LONG_INT,
+                          hypre_MPI_MAX, comm);
+      hypre_MPI_Allreduce(&wsum[num_rows], &total, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+      lo     = hypre_TAlloc(hypre_longlongint, num_procs, HYPRE_MEMORY_HOST);
+      hi     = hypre_TAlloc(hypre_longlongint, num_procs, HYPRE_MEMORY_HOST);
+      target = hypre_TAlloc(HYPRE_Real, num_procs, HYPRE_MEMORY_HOST);
+      wcut   = hypre_TAlloc(HYPRE_Real, 2 * num_procs, HYPRE_MEMORY_HOST);
+      for (k = 1; k < num_procs; k++)
+      {
+         lo[k] = 0;
+         hi[k] = global_max_key + 1;
+         target[k] = total * (HYPRE_Real) k / (HYPRE_Real) num_procs;
+      }
+
+      active = 1;
+      while (active)
+      {
+         /* local weight below the midpoints */
+         for (k = 1; k < num_procs; k++)
+         {
+            mid = lo[k] + (hi[k] - lo[k]) / 2;
+            lb = 0;
+            ub = num_rows;
+            while (lb < ub)
+            {
+               m = (lb + ub) / 2;
+               if (keys[2 * m] < mid) { lb = m + 1; }
+               else { ub = m; }
+            }
+            wcut[k] = wsum[lb];
+         }
+         hypre_MPI_Allreduce(wcut + 1, wcut + num_procs + 1, num_procs - 1, HYPRE_MPI_REAL,
+                             hypre_MPI_SUM, comm);
+
+         active = 0;
+         for (k = 1; k < num_procs; k++)
+         {
+            if (hi[k] - lo[k] > 1)
+            {
+               mid = lo[k] + (hi[k] - lo[k]) / 2;
+               if (wcut[num_procs + k] >= target[k]) { hi[k] = mid; }
+               else { lo[k] = mid; }
+               active = active || (hi[k] - lo[k] > 1);
+            }
+         }
+      }
+
+      /* the rows with keys in [hi[k], hi[k+1]) go to process k */
+      for (i = 0, k = 0; i < num_rows; i++)
+      {
+         while (k < num_procs - 1 && keys[2 * i] >= hi[k + 1])
+         {
+            k++;
+         }
+         send_counts[k]++;
+      }
+      hypre_TFree(lo, HYPRE_MEMORY_HOST);
+      hypre_TFree(hi, HYPRE_MEMORY_HOST);
+      hypre_TFree(target, HYPRE_MEMORY_HOST);
+      hypre_TFree(wcut, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      send_counts[0] = num_rows;
+   }
+   hypre_TFree(wsum, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Send the (key, old index) pairs to their new processes, which number
+    * them in key order and return the new indices
+    *-----------------------------------------------------------------------*/
+
+   recv_counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Alltoall(send_counts, 1, HYPRE_MPI_INT, recv_counts, 1, HYPRE_MPI_INT, comm);
+
+   send_starts = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_procs + 1, HYPRE_MEMORY_HOST);
+   send_starts[0] = recv_starts[0] = 0;
+   num_requests = 0;
+   for (k = 0; k < num_procs; k++)
+   {
+      send_starts[k + 1] = send_starts[k] + send_counts[k];
+      recv_starts[k + 1] = recv_starts[k] + recv_counts[k];
+      num_requests += (send_counts[k] > 0) + (recv_counts[k] > 0);
+   }
+   num_new = recv_starts[num_procs];
+
+   requests  = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   status    = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+   recv_keys = hypre_TAlloc(hypre_longlongint, 2 * num_new, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (k = 0; k < num_procs; k++)
+   {
+      if (recv_counts[k])
+      {
+         hypre_MPI_Irecv(&recv_keys[2 * recv_starts[k]], 2 * recv_counts[k],
+                         hypre_MPI_LONG_LONG_INT, k, 0, comm, &requests[j++]);
+      }
+   }
+   for (k = 0; k < num_procs; k++)
+   {
+      if (send_counts[k])
+      {
+         hypre_MPI_Isend(&keys[2 * send_starts[k]], 2 * send_counts[k],
+                         hypre_MPI_LONG_LONG_INT, k, 0, comm, &requests[j++]);
+      }
+   }
+   hypre_MPI_Waitall(num_requests, requests, status);
+
+   num_new_big = (HYPRE_BigInt) num_new;
+   hypre_MPI_Scan(&num_new_big, &new_first, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   new_first -= num_new_big;
+   new_starts[0] = new_first;
+   new_starts[1] = new_first + num_new_big;
+
+   recv_order = hypre_TAlloc(HYPRE_Int, num_new, HYPRE_MEMORY_HOST);
+   recv_rows  = hypre_TAlloc(HYPRE_BigInt, num_new, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_new; i++)
+   {
+      recv_order[i] = i;
+   }
+   hypre_RepartitionQsort(recv_keys, recv_order, 0, num_new - 1);
+   for (i = 0; i < num_new; i++)
+   {
+      recv_rows[recv_order[i]] = new_first + (HYPRE_BigInt) i;
+   }
+
+   send_rows = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (k = 0; k < num_procs; k++)
+   {
+      if (send_counts[k])
+      {
+         hypre_MPI_Irecv(&send_rows[send_starts[k]], send_counts[k],
+                         HYPRE_MPI_BIG_INT, k, 1, comm, &requests[j++]);
+      }
+   }
+   for (k = 0; k < num_procs; k++)
+   {
+      if (recv_counts[k])
+      {
+         hypre_MPI_Isend(&recv_rows[recv_starts[k]], recv_counts[k],
+                         HYPRE_MPI_BIG_INT, k, 1, comm, &requests[j++]);
+      }
+   }
+   hypre_MPI_Waitall(num_requests, requests, status);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      new_rows[order[i]] = send_rows[i];
+   }
+
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_order, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   *new_rows_ptr = new_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixCreatePermutation
+ *
+ * Creates the permutation matrix Q with Q(i, new_rows[i]) = 1 for the local
+ * rows i of A.  The rows of Q have the row partitioning of A, the columns
+ * the partitioning given by new_starts.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixCreatePermutation( hypre_ParCSRMatrix  *A,
+                                     HYPRE_BigInt        *new_rows,
+                                     HYPRE_BigInt        *new_starts,
+                                     hypre_ParCSRMatrix **Q_ptr )
+{
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_BigInt          global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int             num_rows        = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+
+   hypre_ParCSRMatrix   *Q;
+   hypre_CSRMatrix      *Q_diag, *Q_offd;
+   HYPRE_Int            *Q_diag_i, *Q_diag_j, *Q_offd_i, *Q_offd_j;
+   HYPRE_Real           *Q_diag_data, *Q_offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_Int             num_cols_offd, i, jd, jo;
+
+   num_cols_offd = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (new_rows[i] < new_starts[0] || new_rows[i] >= new_starts[1])
+      {
+         num_cols_offd++;
+      }
+   }
+
+   Q = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_rows,
+                                hypre_ParCSRMatrixRowStarts(A), new_starts,
+                                num_cols_offd, num_rows - num_cols_offd, num_cols_offd);
+   hypre_ParCSRMatrixInitialize_v2(Q, HYPRE_MEMORY_HOST);
+   Q_diag      = hypre_ParCSRMatrixDiag(Q);
+   Q_offd      = hypre_ParCSRMatrixOffd(Q);
+   Q_diag_i    = hypre_CSRMatrixI(Q_diag);
+   Q_diag_j    = hypre_CSRMatrixJ(Q_diag);
+   Q_diag_data = hypre_CSRMatrixData(Q_diag);
+   Q_offd_i    = hypre_CSRMatrixI(Q_offd);
+   Q_offd_j    = hypre_CSRMatrixJ(Q_offd);
+   Q_offd_data = hypre_CSRMatrixData(Q_offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(Q);
+
+   jo = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (new_rows[i] < new_starts[0] || new_rows[i] >= new_starts[1])
+      {
+         col_map_offd[jo++] = new_rows[i];
+      }
+   }
+   hypre_BigQsort0(col_map_offd, 0, num_cols_offd - 1);
+
+   jd = jo = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      Q_diag_i[i] = jd;
+      Q_offd_i[i] = jo;
+      if (new_rows[i] < new_starts[0] || new_rows[i] >= new_starts[1])
+      {
+         Q_offd_j[jo] = hypre_BigBinarySearch(col_map_offd, new_rows[i], num_cols_offd);
+         Q_offd_data[jo++] = 1.0;
+      }
+      else
+      {
+         Q_diag_j[jd] = (HYPRE_Int) (new_rows[i] - new_starts[0]);
+         Q_diag_data[jd++] = 1.0;
+      }
+   }
+   Q_diag_i[num_rows] = jd;
+   Q_offd_i[num_rows] = jo;
+
+   hypre_MatvecCommPkgCreate(Q);
+   hypre_ParCSRMatrixMigrate(Q, memory_location);
+
+   *Q_ptr = Q;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRenumber
+ *
+ * Creates A_new with row i of A moved to global row new_rows[i] and column j
+ * renumbered to new_cols[j], where new_rows and new_cols hold the new
+ * indices of the local rows and of the local range of columns, and the new
+ * local ranges are new_row_starts and new_col_starts.  A NULL new_row_starts
+ * (new_col_starts) keeps the row (column) numbering of A; new_rows (new_cols)
+ * is then ignored.  For the permutation Q of
+ * hypre_ParCSRMatrixCreatePermutation, (new_rows, new_starts) for both the
+ * rows and the columns gives Q^T A Q, (new_rows, new_starts) for the columns
+ * only gives A Q, and for the rows only Q^T A.
+ *
+ * Unlike a matrix product, this neither adds explicit zeros nor reorders
+ * the entries of a row.  When rows and columns share the numbering, the
+ * diagonal entry is stored first.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRenumber( hypre_ParCSRMatrix  *A,
+                            HYPRE_BigInt        *new_rows,
+                            HYPRE_BigInt        *new_row_starts,
+                            HYPRE_BigInt        *new_cols,
+                            HYPRE_BigInt        *new_col_starts,
+                            hypre_ParCSRMatrix **A_new_ptr )
+{
+   MPI_Comm              comm            = hypre_ParCSRMatrixComm(A);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_BigInt          global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt          global_num_cols = hypre_ParCSRMatrixGlobalNumCols(A);
+   HYPRE_BigInt          first_row       = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt          first_col       = hypre_ParCSRMatrixFirstColDiag(A);
+   HYPRE_Int             renumber_rows   = (new_row_starts != NULL);
+   HYPRE_Int             renumber_cols   = (new_col_starts != NULL);
+   HYPRE_Int             diag_first      = (new_row_starts == new_col_starts);
+
+   hypre_ParCSRMatrix   *A_host, *A_new;
+   hypre_CSRMatrix      *A_diag, *A_offd, *A_ext, *A_new_diag, *A_new_offd;
+   HYPRE_Int            *A_diag_i, *A_diag_j, *A_offd_i, *A_offd_j;
+   HYPRE_Complex        *A_diag_data, *A_offd_data;
+   HYPRE_Int             num_rows, num_cols_offd;
+   hypre_ParCSRCommPkg  *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int             num_sends;
+   HYPRE_BigInt         *send_buf, *new_cols_offd, *col_map_offd;
+
+   HYPRE_BigInt         *all_starts;
+   HYPRE_Int            *dest, *send_counts, *recv_counts;
+   HYPRE_Int            *send_starts, *recv_starts;
+   HYPRE_BigInt         *send_ints, *recv_ints;
+   HYPRE_Complex        *send_data, *recv_data;
+   hypre_MPI_Request    *requests;
+   hypre_MPI_Status     *status;
+   HYPRE_Int             num_requests;
+
+   HYPRE_Int             num_new, nnz_new, num_cols_offd_new;
+   HYPRE_Int            *ext_i;
+   HYPRE_BigInt         *ext_j, *col_map_offd_new;
+   HYPRE_Complex        *ext_data;
+   HYPRE_BigInt          row;
+   HYPRE_Int             num_procs, i, j, k, lb, ub, m, len, pos, ci, cd;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (!renumber_rows)
+   {
+      new_row_starts = hypre_ParCSRMatrixRowStarts(A);
+   }
+   if (!renumber_cols)
+   {
+      new_col_starts = hypre_ParCSRMatrixColStarts(A);
+   }
+
+   /* work on the host */
+   A_host = A;
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      A_host = hypre_ParCSRMatrixClone_v2(A, 1, HYPRE_MEMORY_HOST);
+   }
+   A_diag        = hypre_ParCSRMatrixDiag(A_host);
+   A_offd        = hypre_ParCSRMatrixOffd(A_host);
+   A_diag_i      = hypre_CSRMatrixI(A_diag);
+   A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   A_diag_data   = hypre_CSRMatrixData(A_diag);
+   A_offd_i      = hypre_CSRMatrixI(A_offd);
+   A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   A_offd_data   = hypre_CSRMatrixData(A_offd);
+   num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   col_map_offd  = hypre_ParCSRMatrixColMapOffd(A_host);
+
+   /*-----------------------------------------------------------------------
+    * New indices of the off-processor columns
+    *-----------------------------------------------------------------------*/
+
+   new_cols_offd = col_map_offd;
+   if (renumber_cols)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A_host);
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A_host);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A_host);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_buf = hypre_TAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                              HYPRE_MEMORY_HOST);
+      for (j = 0; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); j++)
+      {
+         send_buf[j] = new_cols[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+      new_cols_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, send_buf, new_cols_offd);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Pack the rows by new owner: (new row, length, columns) and values
+    *-----------------------------------------------------------------------*/
+
+   all_starts = hypre_TAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&new_row_starts[0], 1, HYPRE_MPI_BIG_INT, all_starts, 1, HYPRE_MPI_BIG_INT,
+                       comm);
+   all_starts[num_procs] = global_num_rows;
+
+   dest        = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   send_counts = hypre_CTAlloc(HYPRE_Int, 2 * num_procs, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_TAlloc(HYPRE_Int, 2 * num_procs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      /* the last process whose range starts at or before the new row */
+      row = renumber_rows ? new_rows[i] : first_row + i;
+      lb = 0;
+      ub = num_procs - 1;
+      while (lb < ub)
+      {
+         m = (lb + ub + 1) / 2;
+         if (all_starts[m] <= row) { lb = m; }
+         else { ub = m - 1; }
+      }
+      dest[i] = lb;
+      len = (A_diag_i[i + 1] - A_diag_i[i]) + (A_offd_i[i + 1] - A_offd_i[i]);
+      send_counts[2 * lb]     += 2 + len;
+      send_counts[2 * lb + 1] += len;
+   }
+   hypre_TFree(all_starts, HYPRE_MEMORY_HOST);
+   hypre_MPI_Alltoall(send_counts, 2, HYPRE_MPI_INT, recv_counts, 2, HYPRE_MPI_INT, comm);
+
+   send_starts = hypre_TAlloc(HYPRE_Int, 2 * (num_procs + 1), HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, 2 * (num_procs + 1), HYPRE_MEMORY_HOST);
+   send_starts[0] = send_starts[1] = recv_starts[0] = recv_starts[1] = 0;
+   num_requests = 0;
+   for (k = 0; k < num_procs; k++)
+   {
+      send_starts[2 * k + 2] = send_starts[2 * k]     + send_counts[2 * k];
+      send_starts[2 * k + 3] = send_starts[2 * k + 1] + send_counts[2 * k + 1];
+      recv_starts[2 * k + 2] = recv_starts[2 * k]     + recv_counts[2 * k];
+      recv_starts[2 * k + 3] = recv_starts[2 * k + 1] + recv_counts[2 * k + 1];
+      num_requests += 2 * ((send_counts[2 * k] > 0) + (recv_counts[2 * k] > 0));
+   }
+
+   send_ints = hypre_TAlloc(HYPRE_BigInt, send_starts[2 * num_procs], HYPRE_MEMORY_HOST);
+   send_data = hypre_TAlloc(HYPRE_Complex, send_starts[2 * num_procs + 1], HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_procs; k++)
+   {
+      send_counts[2 * k]     = send_starts[2 * k];
+      send_counts[2 * k + 1] = send_starts[2 * k + 1];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      k  = dest[i];
+      ci = send_counts[2 * k];
+      cd = send_counts[2 * k + 1];
+      send_ints[ci++] = renumber_rows ? new_rows[i] : first_row + i;
+      send_ints[ci++] = (A_diag_i[i + 1] - A_diag_i[i]) + (A_offd_i[i + 1] - A_offd_i[i]);
+      for (j = A_diag_i[i]; j < A_diag_i[i + 1]; j++)
+      {
+         send_ints[ci++] = renumber_cols ? new_cols[A_diag_j[j]] : first_col + A_diag_j[j];
+         send_data[cd++] = A_diag_data[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i + 1]; j++)
+      {
+         send_ints[ci++] = new_cols_offd[A_offd_j[j]];
+         send_data[cd++] = A_offd_data[j];
+      }
+      send_counts[2 * k]     = ci;
+      send_counts[2 * k + 1] = cd;
+   }
+   hypre_TFree(dest, HYPRE_MEMORY_HOST);
+   if (new_cols_offd != col_map_offd)
+   {
+      hypre_TFree(new_cols_offd, HYPRE_MEMORY_HOST);
+   }
+   if (A_host != A)
+   {
+      hypre_ParCSRMatrixDestroy(A_host);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Exchange the rows
+    *-----------------------------------------------------------------------*/
+
+   recv_ints = hypre_TAlloc(HYPRE_BigInt, recv_starts[2 * num_procs], HYPRE_MEMORY_HOST);
+   recv_data = hypre_TAlloc(HYPRE_Complex, recv_starts[2 * num_procs + 1], HYPRE_MEMORY_HOST);
+   requests  = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   status    = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (k = 0; k < num_procs; k++)
+   {
+      if (recv_counts[2 * k])
+      {
+         hypre_MPI_Irecv(&recv_ints[recv_starts[2 * k]], recv_counts[2 * k],
+                         HYPRE_MPI_BIG_INT, k, 0, comm, &requests[j++]);
+         hypre_MPI_Irecv(&recv_data[recv_starts[2 * k + 1]], recv_counts[2 * k + 1],
+                         HYPRE_MPI_COMPLEX, k, 1, comm, &requests[j++]);
+      }
+   }
+   for (k = 0; k < num_procs; k++)
+   {
+      if (send_starts[2 * k + 2] > send_starts[2 * k])
+      {
+         hypre_MPI_Isend(&send_ints[send_starts[2 * k]], send_starts[2 * k + 2] - send_starts[2 * k],
+                         HYPRE_MPI_BIG_INT, k, 0, comm, &requests[j++]);
+         hypre_MPI_Isend(&send_data[send_starts[2 * k + 1]],
+                         send_starts[2 * k + 3] - send_starts[2 * k + 1],
+                         HYPRE_MPI_COMPLEX, k, 1, comm, &requests[j++]);
+      }
+   }
+   hypre_MPI_Waitall(num_requests, requests, status);
+
+   hypre_TFree(send_ints, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Assemble the new local rows with global column indices, diagonal
+    * first if requested, and split them into the diagonal and off-diagonal
+    * parts
+    *-----------------------------------------------------------------------*/
+
+   num_new = (HYPRE_Int) (new_row_starts[1] - new_row_starts[0]);
+   nnz_new = recv_starts[2 * num_procs + 1];
+   ext_i    = hypre_CTAlloc(HYPRE_Int, num_new + 1, HYPRE_MEMORY_HOST);
+   ext_j    = hypre_TAlloc(HYPRE_BigInt, nnz_new, HYPRE_MEMORY_HOST);
+   ext_data = hypre_TAlloc(HYPRE_Complex, nnz_new, HYPRE_MEMORY_HOST);
+
+   for (ci = 0; ci < recv_starts[2 * num_procs]; ci += 2 + len)
+   {
+      len = (HYPRE_Int) recv_ints[ci + 1];
+      ext_i[recv_ints[ci] - new_row_starts[0] + 1] = len;
+   }
+   for (i = 0; i < num_new; i++)
+   {
+      ext_i[i + 1] += ext_i[i];
+   }
+
+   for (ci = 0, cd = 0; ci < recv_starts[2 * num_procs]; ci += 2 + len, cd += len)
+   {
+      row = recv_ints[ci];
+      len = (HYPRE_Int) recv_ints[ci + 1];
+      pos = ext_i[row - new_row_starts[0]];
+      for (j = 0; j < len; j++)
+      {
+         ext_j[pos + j]    = recv_ints[ci + 2 + j];
+         ext_data[pos + j] = recv_data[cd + j];
+         if (diag_first && j > 0 && ext_j[pos + j] == row)
+         {
+            ext_j[pos + j]    = ext_j[pos];
+            ext_data[pos + j] = ext_data[pos];
+            ext_j[pos]        = row;
+            ext_data[pos]     = recv_data[cd + j];
+         }
+      }
+   }
+   hypre_TFree(recv_ints, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_starts, HYPRE_MEMORY_HOST);
+
+   A_ext = hypre_CSRMatrixCreate(num_new, global_num_cols, nnz_new);
+   hypre_CSRMatrixMemoryLocation(A_ext) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(A_ext)    = ext_i;
+   hypre_CSRMatrixBigJ(A_ext) = ext_j;
+   hypre_CSRMatrixData(A_ext) = ext_data;
+   hypre_CSRMatrixSplit(A_ext, new_col_starts[0], new_col_starts[1] - 1, 0, NULL,
+                        &num_cols_offd_new, &col_map_offd_new, &A_new_diag, &A_new_offd);
+   hypre_CSRMatrixDestroy(A_ext);
+
+   A_new = hypre_ParCSRMatrixCreate(comm, global_num_rows, global_num_cols,
+                                    new_row_starts, new_col_starts, num_cols_offd_new, 0, 0);
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(A_new));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(A_new));
+   hypre_ParCSRMatrixDiag(A_new)       = A_new_diag;
+   hypre_ParCSRMatrixOffd(A_new)       = A_new_offd;
+   hypre_ParCSRMatrixColMapOffd(A_new) = col_map_offd_new;
+
+   hypre_MatvecCommPkgCreate(A_new);
+   hypre_ParCSRMatrixSetNumNonzeros(A_new);
+   hypre_ParCSRMatrixSetDNumNonzeros(A_new);
+   hypre_ParCSRMatrixMigrate(A_new, memory_location);
+
+   *A_new_ptr = A_new;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRepartition
+ *
+ * Repartitions A as in hypre_ParCSRMatrixComputeRepartition (coordinates
+ * may be NULL).  Returns the permutation matrix Q and A_new = Q^T A Q.
+ * Vectors are moved to the new layout with hypre_ParVectorRepartition and
+ * back with hypre_ParCSRMatrixMatvec(1.0, Q, x_new, 0.0, x).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRepartition( hypre_ParCSRMatrix  *A,
+                               HYPRE_Int            coord_dim,
+                               float               *coordinates,
+                               hypre_ParCSRMatrix **Q_ptr,
+                               hypre_ParCSRMatrix **A_new_ptr )
+{
+   HYPRE_BigInt        *new_rows;
+   HYPRE_BigInt         new_starts[2];
+
+   if (!Q_ptr)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+   if (!A_new_ptr)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+   *Q_ptr     = NULL;
+   *A_new_ptr = NULL;
+
+   if (!A || hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumCols(A))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixComputeRepartition(A, coord_dim, coordinates, &new_rows, new_starts);
+   hypre_ParCSRMatrixCreatePermutation(A, new_rows, new_starts, Q_ptr);
+   hypre_ParCSRMatrixRenumber(A, new_rows, new_starts, new_rows, new_starts, A_new_ptr);
+   hypre_TFree(new_rows, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RepartitionLocalRCM
+ *
+ * Reverse Cuthill-McKee ordering of the graph of the square matrix A: on
+ * output, perm[k] is the row placed at position k.  Every connected
+ * component starts from a pseudo-peripheral node, found by restarting from
+ * a node of least degree in the last level of the level structure for as
+ * long as the structure gets deeper (George and Liu).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RepartitionLocalRCM( hypre_CSRMatrix *A,
+                           HYPRE_Int       *perm )
+{
+   HYPRE_Int   n   = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int  *A_i = hypre_CSRMatrixI(A);
+   HYPRE_Int  *A_j = hypre_CSRMatrixJ(A);
+
+   HYPRE_Int  *degree, *by_degree, *count, *mark;
+   HYPRE_Int   max_degree, num, next, root, stamp, depth, new_depth;
+   HYPRE_Int   head, tail, level_start, level_end, first;
+   HYPRE_Int   i, j, k, t;
+
+   degree = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   max_degree = 0;
+   for (i = 0; i < n; i++)
+   {
+      degree[i]  = A_i[i + 1] - A_i[i];
+      max_degree = hypre_max(max_degree, degree[i]);
+   }
+
+   /* the rows by increasing degree, the candidates for the roots */
+   count     = hypre_CTAlloc(HYPRE_Int, max_degree + 2, HYPRE_MEMORY_HOST);
+   by_degree = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      count[degree[i] + 1]++;
+   }
+   for (k = 0; k <= max_degree; k++)
+   {
+      count[k + 1] += count[k];
+   }
+   for (i = 0; i < n; i++)
+   {
+      by_degree[count[degree[i]]++] = i;
+   }
+   hypre_TFree(count, HYPRE_MEMORY_HOST);
+
+   /* mark[i] < 0: numbered; otherwise the last search that reached i */
+   mark  = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   stamp = 0;
+   num   = 0;
+   next  = 0;
+   while (num < n)
+   {
+      while (mark[by_degree[next]] < 0)
+      {
+         next++;
+      }
+      root = by_degree[next];
+
+      /* pseudo-peripheral root; perm[num:] serves as the queue */
+      depth = 0;
+      while (1)
+      {
+         stamp++;
+         head = num;
+         tail = num;
+         perm[tail++] = root;
+         mark[root] = stamp;
+         new_depth = 0;
+         level_start = head;
+         while (head < tail)
+         {
+            level_start = head;
+            level_end   = tail;
+            new_depth++;
+            while (head < level_end)
+            {
+               i = perm[head++];
+               for (j = A_i[i]; j < A_i[i + 1]; j++)
+               {
+                  k = A_j[j];
+                  if (mark[k] >= 0 && mark[k] != stamp)
+                  {
+                     mark[k] = stamp;
+                     perm[tail++] = k;
+                  }
+               }
+            }
+         }
+         if (new_depth <= depth)
+         {
+            break;
+         }
+         depth = new_depth;
+         for (t = level_start; t < tail; t++)
+         {
+            if (degree[perm[t]] < degree[root] || t == level_start)
+            {
+               root = perm[t];
+            }
+         }
+      }
+
+      /* Cuthill-McKee numbering, the neighbors by increasing degree */
+      head = num;
+      tail = num;
+      perm[tail++] = root;
+      mark[root] = -1;
+      while (head < tail)
+      {
+         i = perm[head++];
+         first = tail;
+         for (j = A_i[i]; j < A_i[i + 1]; j++)
+         {
+            k = A_j[j];
+            if (mark[k] >= 0)
+            {
+               mark[k] = -1;
+               for (t = tail++; t > first && degree[perm[t - 1]] > degree[k]; t--)
+               {
+                  perm[t] = perm[t - 1];
+               }
+               perm[t] = k;
+            }
+         }
+      }
+      num = tail;
+   }
+
+   /* reverse */
+   for (i = 0; i < n / 2; i++)
+   {
+      t = perm[i];
+      perm[i] = perm[n - 1 - i];
+      perm[n - 1 - i] = t;
+   }
+
+   hypre_TFree(degree, HYPRE_MEMORY_HOST);
+   hypre_TFree(by_degree, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RepartitionLocalOrderingValid
+ *
+ * A local ordering needs a square matrix whose diagonal block on this
+ * process is square, i.e. the rows and columns are partitioned alike.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RepartitionLocalOrderingValid( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix  *A_diag = hypre_ParCSRMatrixDiag(A);
+
+   return (hypre_ParCSRMatrixGlobalNumRows(A) == hypre_ParCSRMatrixGlobalNumCols(A) &&
+           hypre_ParCSRMatrixFirstRowIndex(A) == hypre_ParCSRMatrixFirstColDiag(A) &&
+           hypre_CSRMatrixNumRows(A_diag) == hypre_CSRMatrixNumCols(A_diag));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixComputeLocalOrdering
+ *
+ * Computes a new order of the local rows of the square matrix A for cache
+ * locality, leaving the row partitioning unchanged.  If coordinates are
+ * given (as in hypre_ParCSRMatrixComputeRepartition), the rows are ordered
+ * along a Hilbert curve through their local bounding box; otherwise the
+ * reverse Cuthill-McKee ordering of the diagonal block is used.
+ *
+ * On output, new_rows[i] is the new global index of local row i (allocated
+ * here); the permutation and the new matrix are formed as for a
+ * repartitioning, with hypre_ParCSRMatrixRowStarts(A) as new_starts.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixComputeLocalOrdering( hypre_ParCSRMatrix  *A,
+                                        HYPRE_Int            coord_dim,
+                                        float               *coordinates,
+                                        HYPRE_BigInt       **new_rows_ptr )
+{
+   hypre_CSRMatrix      *A_diag    = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int             num_rows  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_BigInt          first_row = hypre_ParCSRMatrixFirstRowIndex(A);
+
+   hypre_CSRMatrix      *A_diag_host;
+   HYPRE_BigInt         *new_rows;
+   HYPRE_Int            *order;
+   hypre_longlongint    *keys;
+   HYPRE_Real            cmin[3], cmax[3];
+   HYPRE_Int             ndim, i, d;
+
+   *new_rows_ptr = NULL;
+
+   if (!hypre_RepartitionLocalOrderingValid(A))
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   order = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   ndim = (coordinates) ? hypre_min(coord_dim, 3) : 0;
+   if (ndim > 0)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         cmin[d] = HYPRE_REAL_MAX;
+         cmax[d] = -HYPRE_REAL_MAX;
+      }
+      for (i = 0; i < num_rows; i++)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            cmin[d] = hypre_min(cmin[d], (HYPRE_Real) coordinates[i * coord_dim + d]);
+            cmax[d] = hypre_max(cmax[d], (HYPRE_Real) coordinates[i * coord_dim + d]);
+         }
+      }
+
+      /* ties are broken by the old index */
+      keys = hypre_TAlloc(hypre_longlongint, 2 * num_rows, HYPRE_MEMORY_HOST);
+      hypre_RepartitionCurveKeys(num_rows, coord_dim, ndim, coordinates, cmin, cmax, keys);
+      for (i = 0; i < num_rows; i++)
+      {
+         keys[2 * i + 1] = (hypre_longlongint) i;
+         order[i] = i;
+      }
+      hypre_RepartitionQsort(keys, order, 0, num_rows - 1);
+      hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   }
+   else if (num_rows > 0)
+   {
+      A_diag_host = A_diag;
+      if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A_diag)) != hypre_MEMORY_HOST)
+      {
+         A_diag_host = hypre_CSRMatrixClone_v2(A_diag, 0, HYPRE_MEMORY_HOST);
+      }
+      hypre_RepartitionLocalRCM(A_diag_host, order);
+      if (A_diag_host != A_diag)
+      {
+         hypre_CSRMatrixDestroy(A_diag_host);
+      }
+   }
+
+   new_rows = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      new_rows[order[i]] = first_row + (HYPRE_BigInt) i;
+   }
+   hypre_TFree(order, HYPRE_MEMORY_HOST);
+
+   *new_rows_ptr = new_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReorderLocal
+ *
+ * Reorders the local rows of A as in hypre_ParCSRMatrixComputeLocalOrdering
+ * (coordinates may be NULL).  Returns the permutation matrix Q and
+ * A_new = Q^T A Q; vectors are moved as for hypre_ParCSRMatrixRepartition.
+ * If the rows and columns of A are not partitioned alike on every process,
+ * an error is set and Q and A_new are NULL.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReorderLocal( hypre_ParCSRMatrix  *A,
+                                HYPRE_Int            coord_dim,
+                                float               *coordinates,
+                                hypre_ParCSRMatrix **Q_ptr,
+                                hypre_ParCSRMatrix **A_new_ptr )
+{
+   HYPRE_BigInt        *new_rows;
+   HYPRE_BigInt         new_starts[2];
+   HYPRE_Int            valid, all_valid;
+
+   if (!Q_ptr)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+   if (!A_new_ptr)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+   *Q_ptr     = NULL;
+   *A_new_ptr = NULL;
+
+   if (!A)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* The check is local, but the permutation below is collective */
+   valid = hypre_RepartitionLocalOrderingValid(A);
+   hypre_MPI_Allreduce(&valid, &all_valid, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+   if (!all_valid)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   new_starts[0] = hypre_ParCSRMatrixRowStarts(A)[0];
+   new_starts[1] = hypre_ParCSRMatrixRowStarts(A)[1];
+
+   hypre_ParCSRMatrixComputeLocalOrdering(A, coord_dim, coordinates, &new_rows);
+   hypre_ParCSRMatrixCreatePermutation(A, new_rows, new_starts, Q_ptr);
+   hypre_ParCSRMatrixRenumber(A, new_rows, new_starts, new_rows, new_starts, A_new_ptr);
+   hypre_TFree(new_rows, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorRepartition
+ *
+ * Creates x_new = Q^T x on the new partitioning of the permutation Q.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorRepartition( hypre_ParCSRMatrix  *Q,
+                            hypre_ParVector     *x,
+                            hypre_ParVector    **x_new_ptr )
+{
+   hypre_ParVector  *x_new;
+
+   x_new = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(Q),
+                                 hypre_ParCSRMatrixGlobalNumCols(Q),
+                                 hypre_ParCSRMatrixColStarts(Q));
+   hypre_ParVectorInitialize_v2(x_new, hypre_ParVectorMemoryLocation(x));
+   hypre_ParCSRMatrixMatvecT(1.0, Q, x, 0.0, x_new);
+
+   *x_new_ptr = x_new;
+
+   return hypre_error_flag;
+}
@@ -239,7 +239,6 @@ hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A,
    hypre_ParCSRCommPkg *comm_pkg_A = NULL;
 
    hypre_CSRMatrix *A_diag  = hypre_ParCSRMatrixDiag(A);
-   hypre_CSRMatrix *A_offd  = hypre_ParCSRMatrixOffd(A);
    hypre_CSRMatrix *B_diag  = hypre_ParCSRMatrixDiag(B);
    hypre_CSRMatrix *B_offd  = hypre_ParCSRMatrixOffd(B);
    hypre_CSRMatrix *AT_diag = NULL;
@@ -287,7 +286,7 @@ hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A,
 
    /*if (num_cols_diag_A == num_cols_diag_B) allsquare = 1;*/
 
-   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 1);
+   hypre_ParCSRMatrixLocalTransposeKT(A, keep_transpose, &AT_diag, NULL);
 
    if (num_procs == 1)
    {
@@ -295,11 +294,7 @@ hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A,
       C_offd = hypre_CSRMatrixCreate(num_cols_diag_A, 0, 0);
       hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
       hypre_CSRMatrixNumRownnz(C_offd) = 0;
-      if (keep_transpose)
-      {
-         A->diagT = AT_diag;
-      }
-      else
+      if (AT_diag != hypre_ParCSRMatrixDiagT(A))
       {
          hypre_CSRMatrixDestroy(AT_diag);
       }
@@ -322,7 +317,7 @@ hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A,
       HYPRE_Int *send_map_elmts_A;
       void      *request;
 
-      hypre_CSRMatrixTranspose(A_offd, &AT_offd, 1);
+      hypre_ParCSRMatrixLocalTransposeKT(A, keep_transpose, NULL, &AT_offd);
 
       C_int_diag = hypre_CSRMatrixMultiplyHost(AT_offd, B_diag);
       C_int_offd = hypre_CSRMatrixMultiplyHost(AT_offd, B_offd);
@@ -352,20 +347,12 @@ hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A,
       C_tmp_diag = hypre_CSRMatrixMultiplyHost(AT_diag, B_diag);
       C_tmp_offd = hypre_CSRMatrixMultiplyHost(AT_diag, B_offd);
 
-      if (keep_transpose)
-      {
-         A->diagT = AT_diag;
-      }
-      else
+      if (AT_diag != hypre_ParCSRMatrixDiagT(A))
       {
          hypre_CSRMatrixDestroy(AT_diag);
       }
 
-      if (keep_transpose)
-      {
-         A->offdT = AT_offd;
-      }
-      else
+      if (AT_offd != hypre_ParCSRMatrixOffdT(A))
       {
          hypre_CSRMatrixDestroy(AT_offd);
       }
@@ -712,7 +699,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       hypre_ParCSRMatrixOffd(Q) = Q_offd;
       hypre_ParCSRMatrixColMapOffd(Q) = col_map_offd_Q;
 
-      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      hypre_ParCSRMatrixLocalTransposeKT(R, keep_transpose, &RT_diag, NULL);
       C_tmp_diag = hypre_CSRMatrixMultiplyHost(RT_diag, Q_diag);
       if (num_cols_offd_Q)
       {
@@ -720,22 +707,19 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       }
       else
       {
-         C_tmp_offd = hypre_CSRMatrixClone(Q_offd, 1);
-         hypre_CSRMatrixNumRows(C_tmp_offd) = num_cols_diag_R;
+         /* R_diag need not be square, so C_tmp_offd is not a copy of Q_offd */
+         C_tmp_offd = hypre_CSRMatrixCreate(num_cols_diag_R, 0, 0);
+         hypre_CSRMatrixInitialize_v2(C_tmp_offd, 0, hypre_CSRMatrixMemoryLocation(Q_offd));
       }
 
-      if (keep_transpose)
-      {
-         R->diagT = RT_diag;
-      }
-      else
+      if (RT_diag != hypre_ParCSRMatrixDiagT(R))
       {
          hypre_CSRMatrixDestroy(RT_diag);
       }
 
       if (num_cols_offd_R)
       {
-         hypre_CSRMatrixTranspose(R_offd, &RT_offd, 1);
+         hypre_ParCSRMatrixLocalTransposeKT(R, keep_transpose, NULL, &RT_offd);
          C_int_diag = hypre_CSRMatrixMultiplyHost(RT_offd, Q_diag);
          C_int_offd = hypre_CSRMatrixMultiplyHost(RT_offd, Q_offd);
 
@@ -760,11 +744,7 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
       {
          hypre_CSRMatrixDestroy(C_int_diag);
          hypre_CSRMatrixDestroy(C_int_offd);
-         if (keep_transpose)
-         {
-            R->offdT = RT_offd;
-         }
-         else
+         if (RT_offd != hypre_ParCSRMatrixOffdT(R))
          {
             hypre_CSRMatrixDestroy(RT_offd);
          }
@@ -850,15 +830,11 @@ hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R,
    else
    {
       Q_diag = hypre_CSRMatrixMultiplyHost(A_diag, P_diag);
-      hypre_CSRMatrixTranspose(R_diag, &RT_diag, 1);
+      hypre_ParCSRMatrixLocalTransposeKT(R, keep_transpose, &RT_diag, NULL);
       C_diag = hypre_CSRMatrixMultiplyHost(RT_diag, Q_diag);
       C_offd = hypre_CSRMatrixCreate(num_cols_diag_R, 0, 0);
       hypre_CSRMatrixInitialize_v2(C_offd, 0, hypre_CSRMatrixMemoryLocation(C_diag));
-      if (keep_transpose)
-      {
-         R->diagT = RT_diag;
-      }
-      else
+      if (RT_diag != hypre_ParCSRMatrixDiagT(R))
       {
          hypre_CSRMatrixDestroy(RT_diag);
       }
@@ -408,7 +408,16 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
 
    HYPRE_Real result = 0.0;
-   HYPRE_Real local_result = hypre_SeqVectorInnerProd(x_local, y_local);
+   HYPRE_Real local_result;
+
+   if (hypre_ParVectorUseReproSums(x))
+   {
+      hypre_ParVectorInnerProdsRepro(1, &x, &y, &result);
+
+      return result;
+   }
+
+   local_result = hypre_SeqVectorInnerProd(x_local, y_local);
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
@@ -422,6 +431,101 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProds
+ *
+ * result[j] = <x[j], y[j]>, j = 0, ..., k-1, with a single global reduction
+ * for all k inner products.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProds( HYPRE_Int         k,
+                           hypre_ParVector **x,
+                           hypre_ParVector **y,
+                           HYPRE_Real       *result )
+{
+   MPI_Comm    comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Real *local_result;
+   HYPRE_Int   j;
+
+   if (hypre_ParVectorUseReproSums(x[0]))
+   {
+      return hypre_ParVectorInnerProdsRepro(k, x, y, result);
+   }
+
+   local_result = hypre_TAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      local_result[j] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[j]),
+                                                 hypre_ParVectorLocalVector(y[j]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorUseReproSums
+ *
+ * Returns 1 if inner products with x should use reproducible summation,
+ * i.e., if it was requested with HYPRE_SetReproducibleSums and x lives on
+ * the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorUseReproSums( hypre_ParVector *x )
+{
+   return ( hypre_GetReproducibleSums() &&
+            hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation(x)) == HYPRE_EXEC_HOST );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdsRepro
+ *
+ * result[j] = <x[j], y[j]>, j = 0, ..., k-1, computed with exact summation
+ * across threads and MPI tasks, so that the results are bitwise identical
+ * for any parallel decomposition.  All k sums share one global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdsRepro( HYPRE_Int         k,
+                                hypre_ParVector **x,
+                                hypre_ParVector **y,
+                                HYPRE_Real       *result )
+{
+   MPI_Comm        comm = hypre_ParVectorComm(x[0]);
+   hypre_ReproSum *acc;
+   HYPRE_Int       j;
+
+   acc = hypre_TAlloc(hypre_ReproSum, k, HYPRE_MEMORY_HOST);
+   for (j = 0; j < k; j++)
+   {
+      hypre_ReproSumInit(&acc[j]);
+      hypre_SeqVectorInnerProdRepro(hypre_ParVectorLocalVector(x[j]),
+                                    hypre_ParVectorLocalVector(y[j]), &acc[j]);
+   }
+
+   hypre_ReproSumAllreduce(acc, k, comm);
+
+   for (j = 0; j < k; j++)
+   {
+      result[j] = hypre_ReproSumValue(&acc[j]);
+   }
+   hypre_TFree(acc, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorElmdivpy
  * y = y + x ./ b [MATLAB Notation]
@@ -57,6 +57,21 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    HYPRE_Real *local_result;
    HYPRE_Int i;
    hypre_Vector **y_local;
+
+   if (hypre_ParVectorUseReproSums(x))
+   {
+      hypre_ParVector **x_k = hypre_TAlloc(hypre_ParVector *, k, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < k; i++)
+      {
+         x_k[i] = x;
+      }
+      hypre_ParVectorInnerProdsRepro(k, x_k, y, result);
+      hypre_TFree(x_k, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    y_local = hypre_TAlloc(hypre_Vector *, k, HYPRE_MEMORY_HOST);
 
    for (i = 0; i < k; i++)
@@ -102,6 +117,32 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    HYPRE_Real *local_result, *result;
    HYPRE_Int i;
    hypre_Vector **z_local;
+
+   if (hypre_ParVectorUseReproSums(x))
+   {
+      hypre_ParVector **xy = hypre_TAlloc(hypre_ParVector *, 4 * k, HYPRE_MEMORY_HOST);
+      hypre_ParVector **zz = xy + 2 * k;
+
+      result = hypre_TAlloc(HYPRE_Real, 2 * k, HYPRE_MEMORY_HOST);
+      for (i = 0; i < k; i++)
+      {
+         xy[i]     = x;
+         xy[k + i] = y;
+         zz[i]     = z[i];
+         zz[k + i] = z[i];
+      }
+      hypre_ParVectorInnerProdsRepro(2 * k, xy, zz, result);
+      for (i = 0; i < k; i++)
+      {
+         result_x[i] = result[i];
+         result_y[i] = result[k + i];
+      }
+      hypre_TFree(xy, HYPRE_MEMORY_HOST);
+      hypre_TFree(result, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    z_local = hypre_TAlloc(hypre_Vector*, k, HYPRE_MEMORY_HOST);
 
    for (i = 0; i < k; i++)
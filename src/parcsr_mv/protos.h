@@ -298,6 +298,14 @@ HYPRE_Int hypre_ParCSRMatrixTransposeHost ( hypre_ParCSRMatrix *A, hypre_ParCSRM
                                             HYPRE_Int data );
 HYPRE_Int hypre_ParCSRMatrixTransposeDevice ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
                                               HYPRE_Int data );
+HYPRE_Int hypre_ParCSRTransposePlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **AT_ptr,
+                                            hypre_ParCSRTransposePlan **plan_ptr );
+HYPRE_Int hypre_ParCSRTransposePlanUpdate ( hypre_ParCSRTransposePlan *plan, hypre_ParCSRMatrix *A,
+                                            hypre_ParCSRMatrix *AT );
+HYPRE_Int hypre_ParCSRTransposePlanDestroy ( hypre_ParCSRTransposePlan *plan );
+HYPRE_Int hypre_ParCSRMatrixLocalTransposeKT ( hypre_ParCSRMatrix *A, HYPRE_Int keep_transpose,
+                                               hypre_CSRMatrix **AT_diag_ptr,
+                                               hypre_CSRMatrix **AT_offd_ptr );
 void hypre_ParCSRMatrixGenSpanningTree ( hypre_ParCSRMatrix *G_csr, HYPRE_Int **indices,
                                          HYPRE_Int G_type );
 void hypre_ParCSRMatrixExtractSubmatrices ( hypre_ParCSRMatrix *A_csr, HYPRE_Int *indices2,
@@ -447,6 +455,33 @@ HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A
                                       hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha, hypre_ParCSRMatrix *A,
                                         hypre_ParVector *x, HYPRE_Complex beta, hypre_ParVector *y, HYPRE_Int *CF_marker, HYPRE_Int fpt );
+HYPRE_Int hypre_ParCSRResidualRestrictPlanCreate ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                                   HYPRE_Int num_chunks,
+                                                   hypre_ParCSRResidualRestrictPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRResidualRestrictPlanDestroy ( hypre_ParCSRResidualRestrictPlan *plan );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P,
+                                               hypre_ParCSRResidualRestrictPlan *plan,
+                                               hypre_ParVector *u, hypre_ParVector *f, hypre_ParVector *fc );
+
+/* par_csr_repartition.c */
+HYPRE_Int hypre_ParCSRMatrixComputeRepartition ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                                 float *coordinates, HYPRE_BigInt **new_rows_ptr,
+                                                 HYPRE_BigInt *new_starts );
+HYPRE_Int hypre_ParCSRMatrixCreatePermutation ( hypre_ParCSRMatrix *A, HYPRE_BigInt *new_rows,
+                                                HYPRE_BigInt *new_starts, hypre_ParCSRMatrix **Q_ptr );
+HYPRE_Int hypre_ParCSRMatrixRenumber ( hypre_ParCSRMatrix *A, HYPRE_BigInt *new_rows,
+                                       HYPRE_BigInt *new_row_starts, HYPRE_BigInt *new_cols,
+                                       HYPRE_BigInt *new_col_starts, hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParCSRMatrixRepartition ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                          float *coordinates, hypre_ParCSRMatrix **Q_ptr,
+                                          hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParCSRMatrixComputeLocalOrdering ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                                   float *coordinates, HYPRE_BigInt **new_rows_ptr );
+HYPRE_Int hypre_ParCSRMatrixReorderLocal ( hypre_ParCSRMatrix *A, HYPRE_Int coord_dim,
+                                           float *coordinates, hypre_ParCSRMatrix **Q_ptr,
+                                           hypre_ParCSRMatrix **A_new_ptr );
+HYPRE_Int hypre_ParVectorRepartition ( hypre_ParCSRMatrix *Q, hypre_ParVector *x,
+                                       hypre_ParVector **x_new_ptr );
 
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -500,6 +535,11 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha, hypre_ParVector *x, hypre_P
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProds ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                      HYPRE_Real *result );
+HYPRE_Int hypre_ParVectorUseReproSums ( hypre_ParVector *x );
+HYPRE_Int hypre_ParVectorInnerProdsRepro ( HYPRE_Int k, hypre_ParVector **x, hypre_ParVector **y,
+                                           HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
@@ -1026,13 +1026,19 @@ transpose_idx (HYPRE_Int idx, HYPRE_Int dim1, HYPRE_Int dim2)
 }
 
 /*--------------------------------------------------------------------------
- * hypre_CSRMatrixTransposeHost
+ * hypre_CSRMatrixTransposePerm
+ *
+ * Same as hypre_CSRMatrixTransposeHost, but also returns in perm (if not
+ * NULL) the position in AT of every entry of A, so that the values of AT can
+ * later be refreshed from an A with the same sparsity pattern by
+ * AT_data[perm[j]] = A_data[j]. perm must hold num_nonzeros(A) entries.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
-hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
+hypre_CSRMatrixTransposePerm(hypre_CSRMatrix  *A,
                              hypre_CSRMatrix **AT,
-                             HYPRE_Int         data)
+                             HYPRE_Int         data,
+                             HYPRE_Int        *perm)
 
 {
    HYPRE_Complex        *A_data     = hypre_CSRMatrixData(A);
@@ -1221,6 +1227,10 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
                offset = bucket[ii * num_cols_A + idx];
                AT_data[offset] = A_data[j];
                AT_j[offset] = ir;
+               if (perm)
+               {
+                  perm[j] = offset;
+               }
             }
          }
       }
@@ -1236,6 +1246,10 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
 
                offset = bucket[ii * num_cols_A + idx];
                AT_j[offset] = ir;
+               if (perm)
+               {
+                  perm[j] = offset;
+               }
             }
          }
       }
@@ -1258,6 +1272,18 @@ hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTransposeHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixTransposeHost(hypre_CSRMatrix  *A,
+                             hypre_CSRMatrix **AT,
+                             HYPRE_Int         data)
+{
+   return hypre_CSRMatrixTransposePerm(A, AT, data, NULL);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixTranspose
  *--------------------------------------------------------------------------*/
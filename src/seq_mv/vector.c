@@ -714,6 +714,65 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdRepro
+ *
+ * Adds the inner product of x and y to the reproducible accumulator acc.
+ * Each thread deposits into a private accumulator; since merging them is
+ * exact, the result does not depend on the number of threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorInnerProdRepro( hypre_Vector   *x,
+                               hypre_Vector   *y,
+                               hypre_ReproSum *acc )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+
+   size *= hypre_VectorNumVectors(x);
+
+#if defined(HYPRE_USING_OPENMP)
+   HYPRE_Int       num_threads = hypre_NumThreads();
+   hypre_ReproSum *thread_acc;
+   HYPRE_Int       i;
+
+   thread_acc = hypre_TAlloc(hypre_ReproSum, num_threads, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_threads; i++)
+   {
+      hypre_ReproSumInit(&thread_acc[i]);
+   }
+
+   #pragma omp parallel
+   {
+      HYPRE_Int ns, ne;
+      HYPRE_Int my_thread_num = hypre_GetThreadNum();
+
+      hypre_partition1D(size, hypre_NumActiveThreads(), my_thread_num, &ns, &ne);
+      hypre_ReproSumDot(&thread_acc[my_thread_num], x_data + ns, y_data + ns, ne - ns);
+   }
+
+   for (i = 0; i < num_threads; i++)
+   {
+      hypre_ReproSumMerge(acc, &thread_acc[i]);
+   }
+   hypre_TFree(thread_acc, HYPRE_MEMORY_HOST);
+#else
+   hypre_ReproSumDot(acc, x_data, y_data, size);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 //TODO
 
 /*--------------------------------------------------------------------------
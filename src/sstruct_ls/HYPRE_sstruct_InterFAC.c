@@ -271,6 +271,17 @@ HYPRE_SStructFACSetCoarseSolverType( HYPRE_SStructSolver solver,
 }
 
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SStructFACSetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructFACSetReuse( HYPRE_SStructSolver solver,
+                          HYPRE_Int           reuse )
+{
+   return ( hypre_FACSetReuse( (void *) solver, reuse) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SStructFACSetLogging
  *--------------------------------------------------------------------------*/
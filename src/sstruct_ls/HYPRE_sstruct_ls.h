@@ -534,6 +534,18 @@ HYPRE_Int
 HYPRE_SStructFACSetCoarseSolverType(HYPRE_SStructSolver solver,
                                     HYPRE_Int           csolver_type);
 
+/**
+ * (Optional) If reuse is nonzero, a call to HYPRE_SStructFACSetup2() with a
+ * matrix on the graph of the previous setup only recomputes the coefficients
+ * of the coarse-grid and level operators, e.g., for the time steps of a
+ * fixed refinement layout. The level grids, the interpolation and
+ * restriction data and the communication packages of the previous setup are
+ * kept. The default is 0.
+ **/
+HYPRE_Int
+HYPRE_SStructFACSetReuse(HYPRE_SStructSolver solver,
+                         HYPRE_Int           reuse);
+
 /**
  * (Optional) Set the amount of logging to do.
  **/
@@ -237,6 +237,11 @@ HYPRE_Int hypre_AMR_FCoarsen ( hypre_SStructMatrix *A, hypre_SStructMatrix *fac_
 /* fac_amr_rap.c */
 HYPRE_Int hypre_AMR_RAP ( hypre_SStructMatrix *A, hypre_Index *rfactors,
                           hypre_SStructMatrix **fac_A_ptr );
+HYPRE_Int hypre_AMR_RAPSetup ( hypre_SStructMatrix *A, hypre_Index *rfactors,
+                               hypre_SStructMatrix **fac_A_ptr, void **rap_data_ptr );
+HYPRE_Int hypre_AMR_RAPCompute ( hypre_SStructMatrix *A, hypre_Index *rfactors,
+                                 hypre_SStructMatrix *fac_A, void *rap_vdata );
+HYPRE_Int hypre_AMR_RAPDestroy ( void *rap_vdata );
 
 /* fac_amr_zero_data.c */
 HYPRE_Int hypre_ZeroAMRVectorData ( hypre_SStructVector *b, HYPRE_Int *plevels,
@@ -259,6 +264,7 @@ HYPRE_Int hypre_FACSetJacobiWeight ( void *fac_vdata, HYPRE_Real weight );
 HYPRE_Int hypre_FACSetNumPreSmooth ( void *fac_vdata, HYPRE_Int num_pre_smooth );
 HYPRE_Int hypre_FACSetNumPostSmooth ( void *fac_vdata, HYPRE_Int num_post_smooth );
 HYPRE_Int hypre_FACSetCoarseSolverType ( void *fac_vdata, HYPRE_Int csolver_type );
+HYPRE_Int hypre_FACSetReuse ( void *fac_vdata, HYPRE_Int reuse );
 HYPRE_Int hypre_FACSetLogging ( void *fac_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_FACGetNumIterations ( void *fac_vdata, HYPRE_Int *num_iterations );
 HYPRE_Int hypre_FACPrintLogging ( void *fac_vdata, HYPRE_Int myid );
@@ -304,6 +310,10 @@ HYPRE_Int hypre_FacSemiRestrictDestroy2 ( void *fac_restrict_vdata );
 /* fac_setup2.c */
 HYPRE_Int hypre_FacSetup2 ( void *fac_vdata, hypre_SStructMatrix *A_in, hypre_SStructVector *b,
                             hypre_SStructVector *x );
+HYPRE_Int hypre_FacSetLevelMatrices ( void *fac_vdata );
+HYPRE_Int hypre_FacSetupLevelSolvers ( void *fac_vdata );
+HYPRE_Int hypre_FacSetupNumeric ( void *fac_vdata, hypre_SStructMatrix *A_in,
+                                  hypre_SStructVector *b, hypre_SStructVector *x );
 
 /* fac_solve3.c */
 HYPRE_Int hypre_FACSolve3 ( void *fac_vdata, hypre_SStructMatrix *A_user, hypre_SStructVector *b_in,
@@ -442,6 +452,7 @@ HYPRE_Int HYPRE_SStructFACSetNumPreRelax ( HYPRE_SStructSolver solver, HYPRE_Int
 HYPRE_Int HYPRE_SStructFACSetNumPostRelax ( HYPRE_SStructSolver solver, HYPRE_Int num_post_relax );
 HYPRE_Int HYPRE_SStructFACSetCoarseSolverType ( HYPRE_SStructSolver solver,
                                                 HYPRE_Int csolver_type );
+HYPRE_Int HYPRE_SStructFACSetReuse ( HYPRE_SStructSolver solver, HYPRE_Int reuse );
 HYPRE_Int HYPRE_SStructFACSetLogging ( HYPRE_SStructSolver solver, HYPRE_Int logging );
 HYPRE_Int HYPRE_SStructFACGetNumIterations ( HYPRE_SStructSolver solver,
                                              HYPRE_Int *num_iterations );
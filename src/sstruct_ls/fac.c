@@ -32,6 +32,7 @@ hypre_FACCreate( MPI_Comm  comm )
    (fac_data -> num_pre_smooth)   = 1;
    (fac_data -> num_post_smooth)  = 1;
    (fac_data -> csolver_type)     = 1;
+   (fac_data -> reuse)            = 0;
    (fac_data -> logging)          = 0;
 
    return (void *) fac_data;
@@ -55,6 +56,7 @@ hypre_FACDestroy2(void *fac_vdata)
 
       HYPRE_SStructGraphDestroy(hypre_SStructMatrixGraph((fac_data -> A_rap)));
       HYPRE_SStructMatrixDestroy((fac_data -> A_rap));
+      hypre_AMR_RAPDestroy((fac_data -> rap_data));
       for (level = 0; level <= (fac_data -> max_levels); level++)
       {
          HYPRE_SStructMatrixDestroy( (fac_data -> A_level[level]) );
@@ -334,6 +336,22 @@ hypre_FACSetCoarseSolverType( void *fac_vdata,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FACSetReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FACSetReuse( void      *fac_vdata,
+                   HYPRE_Int  reuse )
+{
+   hypre_FACData *fac_data = (hypre_FACData *)fac_vdata;
+   HYPRE_Int          ierr = 0;
+
+   (fac_data -> reuse) = reuse;
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FACSetLogging
  *--------------------------------------------------------------------------*/
@@ -33,6 +33,7 @@ typedef struct
    hypre_SStructGraph   **graph_level;
 
    hypre_SStructMatrix   *A_rap;
+   void                  *rap_data;             /* hypre_AMR_RAPSetup data */
    hypre_SStructMatrix  **A_level;
    hypre_SStructVector  **b_level;
    hypre_SStructVector  **x_level;
@@ -49,6 +50,8 @@ typedef struct
    void                 **restrict_data_level;
    void                 **interp_data_level;
 
+   HYPRE_Int              reuse;                /* re-setup on the same graph */
+
    HYPRE_Int              csolver_type;
    HYPRE_SStructSolver    csolver;
    HYPRE_SStructSolver    cprecond;
@@ -78,6 +81,30 @@ typedef struct
  * Accessor macros: hypre_FACData
  *--------------------------------------------------------------------------*/
 
+/*--------------------------------------------------------------------------
+ * hypre_AMRRAPData: the part of hypre_AMR_RAP that depends only on the
+ * composite grid.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int                   nparts;
+   HYPRE_Int                   computed;
+
+   /* rows & cols of the unstructured (IJ) coefficients */
+   HYPRE_Int                   nrows;
+   HYPRE_Int                  *ncols;
+   HYPRE_BigInt               *rows;
+   HYPRE_BigInt               *cols;
+   HYPRE_Int                   ncoeffs;
+
+   hypre_SStructOwnInfoData ***owninfo;         /* owninfo[part][var] */
+   hypre_SStructPGrid        **temp_pgrids;     /* coarsened fboxes of part */
+   hypre_SStructPMatrix      **temp_pmatrices;
+   hypre_CommPkg           ****comm_pkgs;       /* comm_pkgs[part][var1][var2] */
+
+} hypre_AMRRAPData;
+
 #define hypre_FACDataMaxLevels(fac_data)\
 ((fac_data) -> max_levels)
 #define hypre_FACDataLevelToPart(fac_data)\
@@ -164,6 +164,7 @@ hypre_AMR_FCoarsen( hypre_SStructMatrix  *   A,
    HYPRE_Int              *box_ranks, *box_ranks_cnt, *box_to_ranks_cnt;
    HYPRE_Int              *cdata_space_ranks, *box_starts, *box_ends;
    HYPRE_Int              *box_connections;
+   HYPRE_Int              *sorted_ranks, *sorted_pos, *group_first;
    HYPRE_Int             **coarse_contrib_Uv;
    HYPRE_Int              *fine_interface_ranks;
    HYPRE_Int               nUventries = hypre_SStructGraphNUVEntries(graph);
@@ -2690,26 +2691,57 @@ hypre_AMR_FCoarsen( hypre_SStructMatrix  *   A,
             /*---------------------------------------------------------------
              * Determine and "group" the Uventries using the box_ranks.
              * temp2 stores the Uventries indices for a coarsen node.
+             *
+             * The (rank, position) pairs are sorted so that equal ranks are
+             * adjacent. Each group is emitted at the position of its first
+             * member with its members in their original order, so the
+             * grouping is that of a pairwise scan without its quadratic cost.
              *---------------------------------------------------------------*/
+            sorted_ranks = hypre_TAlloc(HYPRE_Int,  box_graph_cnts[fi], HYPRE_MEMORY_HOST);
+            sorted_pos  = hypre_TAlloc(HYPRE_Int,  box_graph_cnts[fi], HYPRE_MEMORY_HOST);
+            group_first = hypre_TAlloc(HYPRE_Int,  box_graph_cnts[fi], HYPRE_MEMORY_HOST);
+            for (i = 0; i < box_graph_cnts[fi]; i++)
+            {
+               sorted_ranks[i] = box_ranks[i];
+               sorted_pos[i]  = i;
+               group_first[i] = -1;
+            }
+            hypre_qsort2i(sorted_ranks, sorted_pos, 0, box_graph_cnts[fi] - 1);
+
+            for (i = 0; i < box_graph_cnts[fi]; i = l)
+            {
+               for (l = i + 1; l < box_graph_cnts[fi]; l++)
+               {
+                  if (sorted_ranks[l] != sorted_ranks[i])
+                  {
+                     break;
+                  }
+               }
+               hypre_qsort0(sorted_pos, i, l - 1);
+               group_first[sorted_pos[i]] = i;
+            }
+
             cnt1 = 0;
             j   = 0;
             temp1[cnt1] = j;
 
             for (i = 0; i < box_graph_cnts[fi]; i++)
             {
-               if (box_ranks[i] != -1)
+               if (group_first[i] != -1)
                {
-                  k                 = box_ranks[i];
-                  box_connections[i] = cnt1;
-                  temp2[j++]        = box_graph_indices[fi][i];
-
-                  for (l = i + 1; l < box_graph_cnts[fi]; l++)
+                  k = box_ranks[i];
+                  for (l = group_first[i]; l < box_graph_cnts[fi]; l++)
                   {
-                     if (box_ranks[l] == k)
+                     if (sorted_ranks[l] != k)
                      {
-                        box_connections[l] = cnt1;
-                        temp2[j++]        = box_graph_indices[fi][l];
-                        box_ranks[l]      = -1;
+                        break;
+                     }
+                     m                 = sorted_pos[l];
+                     box_connections[m] = cnt1;
+                     temp2[j++]        = box_graph_indices[fi][m];
+                     if (m != i)
+                     {
+                        box_ranks[m]   = -1;
                      }
                   }
                   cnt1++;
@@ -2717,6 +2749,10 @@ hypre_AMR_FCoarsen( hypre_SStructMatrix  *   A,
                }
             }
 
+            hypre_TFree(sorted_ranks, HYPRE_MEMORY_HOST);
+            hypre_TFree(sorted_pos, HYPRE_MEMORY_HOST);
+            hypre_TFree(group_first, HYPRE_MEMORY_HOST);
+
             /*-----------------------------------------------------------------
              *  Store the graph entry info and other index info for each coarse
              *  grid node.
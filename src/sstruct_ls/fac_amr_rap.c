@@ -25,12 +25,33 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
                hypre_Index          *rfactors,
                hypre_SStructMatrix **fac_A_ptr )
 {
+   void       *rap_data;
+   HYPRE_Int   ierr = 0;
+
+   ierr = hypre_AMR_RAPSetup(A, rfactors, fac_A_ptr, &rap_data);
+   hypre_AMR_RAPDestroy(rap_data);
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMR_RAPSetup: Same as hypre_AMR_RAP, but also returns the data that
+ * depends only on the composite grid of A- the IJ rows & cols, the owninfo,
+ * the coarsened fbox matrices and the communication packages. With it,
+ * hypre_AMR_RAPCompute recomputes fac_A in place when only the coefficients
+ * of A have changed.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_AMR_RAPSetup( hypre_SStructMatrix  *A,
+                    hypre_Index          *rfactors,
+                    hypre_SStructMatrix **fac_A_ptr,
+                    void                **rap_data_ptr )
+{
 
    MPI_Comm                     comm         = hypre_SStructMatrixComm(A);
    HYPRE_Int                    ndim         = hypre_SStructMatrixNDim(A);
    HYPRE_Int                    nparts       = hypre_SStructMatrixNParts(A);
    hypre_SStructGraph          *graph        = hypre_SStructMatrixGraph(A);
-   HYPRE_IJMatrix               ij_A         = hypre_SStructMatrixIJMatrix(A);
    HYPRE_Int                    matrix_type  = hypre_SStructMatrixObjectType(A);
 
    hypre_SStructGrid           *grid         = hypre_SStructGraphGrid(graph);
@@ -40,20 +61,18 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
    hypre_SStructUVEntry        *Uventry;
    HYPRE_Int                    nUentries;
 
-   hypre_CommPkg               *amrA_comm_pkg;
-   hypre_CommHandle            *comm_handle;
+   hypre_AMRRAPData            *rap_data;
+   hypre_CommPkg            ****comm_pkgs;
 
    hypre_SStructMatrix         *fac_A;
-   hypre_SStructPMatrix        *pmatrix, *fac_pmatrix;
+   hypre_SStructPMatrix        *fac_pmatrix;
    hypre_StructMatrix          *smatrix, *fac_smatrix;
-   hypre_Box                   *smatrix_dbox, *fac_smatrix_dbox;
-   HYPRE_Real                  *smatrix_vals, *fac_smatrix_vals;
 
    hypre_SStructGrid           *fac_grid;
    hypre_SStructGraph          *fac_graph;
    hypre_SStructPGrid          *f_pgrid, *c_pgrid;
    hypre_StructGrid            *fgrid, *cgrid;
-   hypre_BoxArray              *grid_boxes, *cgrid_boxes;
+   hypre_BoxArray              *grid_boxes;
    hypre_Box                   *grid_box;
    hypre_Box                    scaled_box;
 
@@ -64,30 +83,19 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
    hypre_SStructOwnInfoData  ***owninfo;
    hypre_SStructRecvInfoData   *recvinfo;
    hypre_SStructSendInfoData   *sendinfo;
-   hypre_BoxArrayArray         *own_composite_cboxes, *own_boxes;
-   hypre_BoxArray              *own_composite_cbox;
-   HYPRE_Int                  **own_cboxnums;
 
    hypre_BoxManager            *fboxman, *cboxman;
    hypre_BoxManEntry           *boxman_entry;
-   hypre_Index                  ilower;
 
-   HYPRE_Real                  *values;
    HYPRE_Int                   *ncols, tot_cols;
    HYPRE_BigInt                *rows, *cols;
 
-   hypre_SStructStencil        *stencils;
-   hypre_Index                  stencil_shape, loop_size;
-   HYPRE_Int                    stencil_size, *stencil_vars;
+   hypre_Index                  index, zero_index;
+   HYPRE_Int                    nvars, var1, var2, part;
+   HYPRE_Int                    i, j, k;
 
-   hypre_Index                  index, stride, zero_index;
-   HYPRE_Int                    nvars, var1, var2, part, cbox;
-   HYPRE_Int                    i, j, k, size;
-
-   HYPRE_Int                    myid;
    HYPRE_Int                    ierr = 0;
 
-   hypre_MPI_Comm_rank(comm, &myid);
    hypre_ClearIndex(zero_index);
 
    hypre_BoxInit(&scaled_box, ndim);
@@ -97,11 +105,12 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
    HYPRE_SStructMatrixCreate(comm, fac_graph, &fac_A);
    HYPRE_SStructMatrixInitialize(fac_A);
 
+   rap_data = hypre_CTAlloc(hypre_AMRRAPData, 1, HYPRE_MEMORY_HOST);
+   (rap_data -> nparts) = nparts;
+
    /*--------------------------------------------------------------------------
-    * Copy all A's unstructured data and structured data that are not processed
-    * into fac_A. Since the grids are the same for both matrices, the ranks
-    * are also the same. Thus, the rows, cols, etc. for the IJ_matrix are
-    * the same.
+    * The rows & cols of A's unstructured data. Since the grids are the same
+    * for A and fac_A, these are also the rows & cols of fac_A.
     *--------------------------------------------------------------------------*/
    ncols = hypre_CTAlloc(HYPRE_Int,  nUventries, HYPRE_MEMORY_HOST);
    rows = hypre_CTAlloc(HYPRE_BigInt,  nUventries, HYPRE_MEMORY_HOST);
@@ -133,16 +142,11 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
       }
    }
 
-   values = hypre_CTAlloc(HYPRE_Real,  tot_cols, HYPRE_MEMORY_HOST);
-   HYPRE_IJMatrixGetValues(ij_A, nUventries, ncols, rows, cols, values);
-
-   HYPRE_IJMatrixSetValues(hypre_SStructMatrixIJMatrix(fac_A), nUventries,
-                           ncols, (const HYPRE_BigInt *) rows, (const HYPRE_BigInt *) cols,
-                           (const HYPRE_Real *) values);
-   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
-   hypre_TFree(rows, HYPRE_MEMORY_HOST);
-   hypre_TFree(cols, HYPRE_MEMORY_HOST);
-   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   (rap_data -> nrows)   = nUventries;
+   (rap_data -> ncols)   = ncols;
+   (rap_data -> rows)    = rows;
+   (rap_data -> cols)    = cols;
+   (rap_data -> ncoeffs) = tot_cols;
 
    owninfo = hypre_CTAlloc(hypre_SStructOwnInfoData  **,  nparts, HYPRE_MEMORY_HOST);
    for (part = (nparts - 1); part > 0; part--)
@@ -165,18 +169,229 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
                                                     rfactors[part]);
       }
    }
+   (rap_data -> owninfo) = owninfo;
+
+   (rap_data -> temp_pgrids)    = hypre_CTAlloc(hypre_SStructPGrid *, nparts, HYPRE_MEMORY_HOST);
+   (rap_data -> temp_pmatrices) = hypre_CTAlloc(hypre_SStructPMatrix *, nparts, HYPRE_MEMORY_HOST);
+   comm_pkgs = hypre_CTAlloc(hypre_CommPkg ***, nparts, HYPRE_MEMORY_HOST);
+   (rap_data -> comm_pkgs) = comm_pkgs;
+
+   for (part = (nparts - 1); part >= 1; part--)
+   {
+      /*-----------------------------------------------------------------------
+       *  Create the temp SStruct_PMatrix for coarsening away the level= part
+       *  boxes.
+       *-----------------------------------------------------------------------*/
+      f_pgrid = hypre_SStructGridPGrid(fac_grid, part);
+      c_pgrid = hypre_SStructGridPGrid(fac_grid, part - 1);
+      grid_boxes = hypre_SStructPGridCellIBoxArray(f_pgrid);
+
+      hypre_SStructPGridCreate(hypre_SStructGridComm(f_pgrid),
+                               ndim, &temp_pgrid);
+
+      /*coarsen the fboxes.*/
+      for (i = 0; i < hypre_BoxArraySize(grid_boxes); i++)
+      {
+         grid_box = hypre_BoxArrayBox(grid_boxes, i);
+         hypre_StructMapFineToCoarse(hypre_BoxIMin(grid_box), zero_index,
+                                     rfactors[part], hypre_BoxIMin(&scaled_box));
+         hypre_StructMapFineToCoarse(hypre_BoxIMax(grid_box), zero_index,
+                                     rfactors[part], hypre_BoxIMax(&scaled_box));
+
+         hypre_SStructPGridSetExtents(temp_pgrid,
+                                      hypre_BoxIMin(&scaled_box),
+                                      hypre_BoxIMax(&scaled_box));
+      }
+
+      nvars  = hypre_SStructPGridNVars(f_pgrid);
+      hypre_SStructPGridSetVariables(temp_pgrid, nvars,
+                                     hypre_SStructPGridVarTypes(f_pgrid));
+      hypre_SStructPGridAssemble(temp_pgrid);
+
+      /* reference the sstruct_stencil of fac_pmatrix- to be used in temp_pmatrix */
+      temp_sstencils = hypre_CTAlloc(hypre_SStructStencil *,  nvars, HYPRE_MEMORY_HOST);
+      fac_pmatrix = hypre_SStructMatrixPMatrix(fac_A, part - 1);
+      for (i = 0; i < nvars; i++)
+      {
+         hypre_SStructStencilRef(hypre_SStructPMatrixStencil(fac_pmatrix, i),
+                                 &temp_sstencils[i]);
+      }
+
+      hypre_SStructPMatrixCreate(hypre_SStructPMatrixComm(fac_pmatrix),
+                                 temp_pgrid,
+                                 temp_sstencils,
+                                 &temp_pmatrix);
+      hypre_SStructPMatrixInitialize(temp_pmatrix);
+
+      (rap_data -> temp_pgrids[part])    = temp_pgrid;
+      (rap_data -> temp_pmatrices[part]) = temp_pmatrix;
+
+      /*-----------------------------------------------------------------------
+       * Communication packages for the off-process coarse data. These
+       * depend only on the grids and the data spaces, so they are computed
+       * here once- i.e., sendboxes, recvboxes, etc.
+       *-----------------------------------------------------------------------*/
+      comm_pkgs[part] = hypre_TAlloc(hypre_CommPkg **, nvars, HYPRE_MEMORY_HOST);
+      for (var1 = 0; var1 < nvars; var1++)
+      {
+         fboxman = hypre_SStructGridBoxManager(fac_grid, part, var1);
+         cboxman = hypre_SStructGridBoxManager(fac_grid, part - 1, var1);
+
+         fgrid = hypre_SStructPGridSGrid(f_pgrid, var1);
+         cgrid = hypre_SStructPGridSGrid(c_pgrid, var1);
+
+         sendinfo = hypre_SStructSendInfo(fgrid, cboxman, rfactors[part]);
+         recvinfo = hypre_SStructRecvInfo(cgrid, fboxman, rfactors[part]);
+
+         /*-------------------------------------------------------------------
+          * need to check this for more than one variable- are the comm. info
+          * for this sgrid okay for cross-variable matrices?
+          *-------------------------------------------------------------------*/
+         comm_pkgs[part][var1] = hypre_TAlloc(hypre_CommPkg *, nvars, HYPRE_MEMORY_HOST);
+         for (var2 = 0; var2 < nvars; var2++)
+         {
+            fac_smatrix = hypre_SStructPMatrixSMatrix(fac_pmatrix, var1, var2);
+            smatrix    = hypre_SStructPMatrixSMatrix(temp_pmatrix, var1, var2);
+
+            hypre_SStructAMRInterCommunication(sendinfo,
+                                               recvinfo,
+                                               hypre_StructMatrixDataSpace(smatrix),
+                                               hypre_StructMatrixDataSpace(fac_smatrix),
+                                               hypre_StructMatrixNumValues(smatrix),
+                                               comm,
+                                               &comm_pkgs[part][var1][var2]);
+         }
+
+         hypre_SStructSendInfoDataDestroy(sendinfo);
+         hypre_SStructRecvInfoDataDestroy(recvinfo);
+
+      }  /* for (var1= 0; var1< nvars; var1++) */
+   }     /* for (part= (nparts-1); part>= 1; part--) */
+
+   ierr = hypre_AMR_RAPCompute(A, rfactors, fac_A, (void *) rap_data);
+
+   *fac_A_ptr    = fac_A;
+   *rap_data_ptr = (void *) rap_data;
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMR_RAPCompute: Computes the values of fac_A from those of A, using
+ * the data from hypre_AMR_RAPSetup. A must have the graph that was given to
+ * hypre_AMR_RAPSetup. A second call first zeroes fac_A, so that it is
+ * recomputed exactly as in the first call.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_AMR_RAPCompute( hypre_SStructMatrix  *A,
+                      hypre_Index          *rfactors,
+                      hypre_SStructMatrix  *fac_A,
+                      void                 *rap_vdata )
+{
+   hypre_AMRRAPData            *rap_data     = (hypre_AMRRAPData *) rap_vdata;
+
+   HYPRE_Int                    ndim         = hypre_SStructMatrixNDim(A);
+   HYPRE_Int                    nparts       = hypre_SStructMatrixNParts(A);
+   hypre_SStructGraph          *graph        = hypre_SStructMatrixGraph(A);
+   HYPRE_IJMatrix               ij_A         = hypre_SStructMatrixIJMatrix(A);
+
+   hypre_SStructOwnInfoData  ***owninfo      = (rap_data -> owninfo);
+   hypre_SStructPMatrix       **temp_pmatrices = (rap_data -> temp_pmatrices);
+   hypre_CommPkg            ****comm_pkgs    = (rap_data -> comm_pkgs);
+
+   hypre_CommHandle            *comm_handle;
+
+   hypre_SStructPMatrix        *pmatrix, *fac_pmatrix;
+   hypre_StructMatrix          *smatrix, *fac_smatrix;
+   hypre_Box                   *smatrix_dbox, *fac_smatrix_dbox;
+   HYPRE_Real                  *smatrix_vals, *fac_smatrix_vals;
+
+   hypre_SStructGrid           *fac_grid     = hypre_SStructGraphGrid(hypre_SStructMatrixGraph(fac_A));
+   hypre_SStructPGrid          *f_pgrid;
+   hypre_StructGrid            *fgrid;
+   hypre_BoxArray              *grid_boxes, *cgrid_boxes;
+   hypre_Box                   *grid_box;
+
+   hypre_SStructPMatrix        *temp_pmatrix;
+
+   hypre_BoxArrayArray         *own_composite_cboxes, *own_boxes;
+   hypre_BoxArray              *own_composite_cbox;
+   HYPRE_Int                  **own_cboxnums;
+
+   hypre_Index                  ilower;
+
+   HYPRE_Real                  *values;
+
+   hypre_SStructStencil        *stencils;
+   hypre_Index                  stencil_shape, loop_size;
+   HYPRE_Int                    stencil_size, *stencil_vars;
+
+   hypre_Index                  stride;
+   HYPRE_Int                    nvars, var1, var2, part, cbox;
+   HYPRE_Int                    i, j, k, size;
+
+   HYPRE_Int                    ierr = 0;
+
+   /*--------------------------------------------------------------------------
+    * On a recompute, zero fac_A and the temp matrices: the coarsening adds
+    * into some of their entries.
+    *--------------------------------------------------------------------------*/
+   if (rap_data -> computed)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         for (k = 0; k < 2; k++)
+         {
+            pmatrix = (k == 0) ? hypre_SStructMatrixPMatrix(fac_A, part) : temp_pmatrices[part];
+            if (pmatrix == NULL)
+            {
+               continue;
+            }
+
+            nvars = hypre_SStructPMatrixNVars(pmatrix);
+            for (var1 = 0; var1 < nvars; var1++)
+            {
+               for (var2 = 0; var2 < nvars; var2++)
+               {
+                  smatrix = hypre_SStructPMatrixSMatrix(pmatrix, var1, var2);
+                  if (smatrix != NULL)
+                  {
+                     hypre_Memset(hypre_StructMatrixData(smatrix), 0,
+                                  hypre_StructMatrixDataSize(smatrix) * sizeof(HYPRE_Complex),
+                                  HYPRE_MEMORY_DEVICE);
+                  }
+               }
+            }
+         }
+      }
+      hypre_ParCSRMatrixSetConstantValues(hypre_SStructMatrixParCSRMatrix(fac_A), 0.0);
+   }
+
+   /*--------------------------------------------------------------------------
+    * Copy all A's unstructured data and structured data that are not processed
+    * into fac_A. Since the grids are the same for both matrices, the ranks
+    * are also the same. Thus, the rows, cols, etc. for the IJ_matrix are
+    * the same.
+    *--------------------------------------------------------------------------*/
+   values = hypre_CTAlloc(HYPRE_Real,  (rap_data -> ncoeffs), HYPRE_MEMORY_HOST);
+   HYPRE_IJMatrixGetValues(ij_A, (rap_data -> nrows), (rap_data -> ncols),
+                           (rap_data -> rows), (rap_data -> cols), values);
+
+   HYPRE_IJMatrixSetValues(hypre_SStructMatrixIJMatrix(fac_A), (rap_data -> nrows),
+                           (rap_data -> ncols), (const HYPRE_BigInt *) (rap_data -> rows),
+                           (const HYPRE_BigInt *) (rap_data -> cols),
+                           (const HYPRE_Real *) values);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
 
    hypre_SetIndex3(stride, 1, 1, 1);
    for (part = (nparts - 1); part > 0; part--)
    {
       f_pgrid = hypre_SStructGridPGrid(fac_grid, part);
-      c_pgrid = hypre_SStructGridPGrid(fac_grid, part - 1);
       nvars  = hypre_SStructPGridNVars(f_pgrid);
 
       for (var1 = 0; var1 < nvars; var1++)
       {
          fgrid     = hypre_SStructPGridSGrid(f_pgrid, var1);
-         cgrid     = hypre_SStructPGridSGrid(c_pgrid, var1);
          grid_boxes = hypre_StructGridBoxes(fgrid);
 
          stencils = hypre_SStructGraphStencil(graph, part, var1);
@@ -304,57 +519,14 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
    {
       hypre_AMR_CFCoarsen(A, fac_A, rfactors[part], part);
 
-      /*-----------------------------------------------------------------------
-       *  Create the temp SStruct_PMatrix for coarsening away the level= part
-       *  boxes.
-       *-----------------------------------------------------------------------*/
-      f_pgrid = hypre_SStructGridPGrid(fac_grid, part);
-      c_pgrid = hypre_SStructGridPGrid(fac_grid, part - 1);
-      grid_boxes = hypre_SStructPGridCellIBoxArray(f_pgrid);
-
-      hypre_SStructPGridCreate(hypre_SStructGridComm(f_pgrid),
-                               ndim, &temp_pgrid);
-
-      /*coarsen the fboxes.*/
-      for (i = 0; i < hypre_BoxArraySize(grid_boxes); i++)
-      {
-         grid_box = hypre_BoxArrayBox(grid_boxes, i);
-         hypre_StructMapFineToCoarse(hypre_BoxIMin(grid_box), zero_index,
-                                     rfactors[part], hypre_BoxIMin(&scaled_box));
-         hypre_StructMapFineToCoarse(hypre_BoxIMax(grid_box), zero_index,
-                                     rfactors[part], hypre_BoxIMax(&scaled_box));
-
-         hypre_SStructPGridSetExtents(temp_pgrid,
-                                      hypre_BoxIMin(&scaled_box),
-                                      hypre_BoxIMax(&scaled_box));
-      }
-
-      nvars  = hypre_SStructPGridNVars(f_pgrid);
-      hypre_SStructPGridSetVariables(temp_pgrid, nvars,
-                                     hypre_SStructPGridVarTypes(f_pgrid));
-      hypre_SStructPGridAssemble(temp_pgrid);
-
-      /* reference the sstruct_stencil of fac_pmatrix- to be used in temp_pmatrix */
-      temp_sstencils = hypre_CTAlloc(hypre_SStructStencil *,  nvars, HYPRE_MEMORY_HOST);
-      fac_pmatrix = hypre_SStructMatrixPMatrix(fac_A, part - 1);
-      for (i = 0; i < nvars; i++)
-      {
-         hypre_SStructStencilRef(hypre_SStructPMatrixStencil(fac_pmatrix, i),
-                                 &temp_sstencils[i]);
-      }
-
-      hypre_SStructPMatrixCreate(hypre_SStructPMatrixComm(fac_pmatrix),
-                                 temp_pgrid,
-                                 temp_sstencils,
-                                 &temp_pmatrix);
-      hypre_SStructPMatrixInitialize(temp_pmatrix);
-
+      temp_pmatrix = temp_pmatrices[part];
       hypre_AMR_FCoarsen(A, fac_A, temp_pmatrix, rfactors[part], part);
 
       /*-----------------------------------------------------------------------
        * Extract the own_box data (boxes of coarsen data of this processor).
        *-----------------------------------------------------------------------*/
       fac_pmatrix = hypre_SStructMatrixPMatrix(fac_A, part - 1);
+      nvars = hypre_SStructPMatrixNVars(temp_pmatrix);
       for (var1 = 0; var1 < nvars; var1++)
       {
          stencils = hypre_SStructGraphStencil(graph, part - 1, var1);
@@ -416,68 +588,76 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
                }  /* for (k = 0; k < stencil_size; k++) */
             }     /* hypre_ForBoxI(j, cgrid_boxes) */
          }        /* for (i= 0; i< size; i++) */
-
-         hypre_SStructOwnInfoDataDestroy(owninfo[part][var1]);
       }           /* for (var1= 0; var1< nvars; var1++) */
 
-      hypre_TFree(owninfo[part], HYPRE_MEMORY_HOST);
-
       /*-----------------------------------------------------------------------
-       * Communication of off-process coarse data. A communication pkg is
-       * needed. Thus, compute the communication info- sendboxes, recvboxes,
-       * etc.
+       * Communication of off-process coarse data.
        *-----------------------------------------------------------------------*/
       for (var1 = 0; var1 < nvars; var1++)
       {
-         fboxman = hypre_SStructGridBoxManager(fac_grid, part, var1);
-         cboxman = hypre_SStructGridBoxManager(fac_grid, part - 1, var1);
-
-         fgrid = hypre_SStructPGridSGrid(f_pgrid, var1);
-         cgrid = hypre_SStructPGridSGrid(c_pgrid, var1);
-
-         sendinfo = hypre_SStructSendInfo(fgrid, cboxman, rfactors[part]);
-         recvinfo = hypre_SStructRecvInfo(cgrid, fboxman, rfactors[part]);
-
-         /*-------------------------------------------------------------------
-          * need to check this for more than one variable- are the comm. info
-          * for this sgrid okay for cross-variable matrices?
-          *-------------------------------------------------------------------*/
          for (var2 = 0; var2 < nvars; var2++)
          {
             fac_smatrix = hypre_SStructPMatrixSMatrix(fac_pmatrix, var1, var2);
             smatrix    = hypre_SStructPMatrixSMatrix(temp_pmatrix, var1, var2);
 
-            hypre_SStructAMRInterCommunication(sendinfo,
-                                               recvinfo,
-                                               hypre_StructMatrixDataSpace(smatrix),
-                                               hypre_StructMatrixDataSpace(fac_smatrix),
-                                               hypre_StructMatrixNumValues(smatrix),
-                                               comm,
-                                               &amrA_comm_pkg);
-
-            hypre_InitializeCommunication(amrA_comm_pkg,
+            hypre_InitializeCommunication(comm_pkgs[part][var1][var2],
                                           hypre_StructMatrixData(smatrix),
                                           hypre_StructMatrixData(fac_smatrix), 0, 0,
                                           &comm_handle);
             hypre_FinalizeCommunication(comm_handle);
-
-            hypre_CommPkgDestroy(amrA_comm_pkg);
          }
-
-         hypre_SStructSendInfoDataDestroy(sendinfo);
-         hypre_SStructRecvInfoDataDestroy(recvinfo);
-
       }  /* for (var1= 0; var1< nvars; var1++) */
 
-      hypre_SStructPGridDestroy(temp_pgrid);
-      hypre_SStructPMatrixDestroy(temp_pmatrix);
-
    }  /* for (part= 0; part< nparts; part++) */
 
-   hypre_TFree(owninfo, HYPRE_MEMORY_HOST);
-
    HYPRE_SStructMatrixAssemble(fac_A);
 
-   *fac_A_ptr = fac_A;
+   (rap_data -> computed) = 1;
+
    return ierr;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_AMR_RAPDestroy
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_AMR_RAPDestroy( void *rap_vdata )
+{
+   hypre_AMRRAPData  *rap_data = (hypre_AMRRAPData *) rap_vdata;
+   HYPRE_Int          nparts, nvars, part, var1, var2;
+
+   if (rap_data)
+   {
+      nparts = (rap_data -> nparts);
+      for (part = (nparts - 1); part > 0; part--)
+      {
+         nvars = hypre_SStructPGridNVars(rap_data -> temp_pgrids[part]);
+         for (var1 = 0; var1 < nvars; var1++)
+         {
+            hypre_SStructOwnInfoDataDestroy(rap_data -> owninfo[part][var1]);
+            for (var2 = 0; var2 < nvars; var2++)
+            {
+               hypre_CommPkgDestroy(rap_data -> comm_pkgs[part][var1][var2]);
+            }
+            hypre_TFree(rap_data -> comm_pkgs[part][var1], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(rap_data -> owninfo[part], HYPRE_MEMORY_HOST);
+         hypre_TFree(rap_data -> comm_pkgs[part], HYPRE_MEMORY_HOST);
+
+         hypre_SStructPMatrixDestroy(rap_data -> temp_pmatrices[part]);
+         hypre_SStructPGridDestroy(rap_data -> temp_pgrids[part]);
+      }
+      hypre_TFree(rap_data -> owninfo, HYPRE_MEMORY_HOST);
+      hypre_TFree(rap_data -> comm_pkgs, HYPRE_MEMORY_HOST);
+      hypre_TFree(rap_data -> temp_pmatrices, HYPRE_MEMORY_HOST);
+      hypre_TFree(rap_data -> temp_pgrids, HYPRE_MEMORY_HOST);
+
+      hypre_TFree(rap_data -> ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(rap_data -> rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(rap_data -> cols, HYPRE_MEMORY_HOST);
+
+      hypre_TFree(rap_data, HYPRE_MEMORY_HOST);
+   }
+
+   return 0;
+}
@@ -32,9 +32,6 @@ hypre_FacSetup2( void                 *fac_vdata,
    HYPRE_Int               nparts_level  =  2;
    HYPRE_Int               part_crse     =  0;
    HYPRE_Int               part_fine     =  1;
-   hypre_SStructPMatrix   *A_pmatrix;
-   hypre_StructMatrix     *A_smatrix;
-   hypre_Box              *A_smatrix_dbox;
 
    hypre_SStructGrid     **grid_level;
    hypre_SStructGraph    **graph_level;
@@ -44,27 +41,20 @@ hypre_FacSetup2( void                 *fac_vdata,
    hypre_SStructGraph     *graph;
    hypre_SStructGrid      *grid;
    hypre_SStructPGrid     *pgrid;
-   hypre_StructGrid       *sgrid;
-   hypre_BoxArray         *sgrid_boxes;
-   hypre_Box              *sgrid_box;
    hypre_SStructStencil   *stencils;
    hypre_BoxArray         *iboxarray;
 
    hypre_Index            *refine_factors;
-   hypre_IndexRef          box_start;
-   hypre_IndexRef          box_end;
 
    hypre_SStructUVEntry  **Uventries;
    HYPRE_Int               nUventries;
    HYPRE_Int              *iUventries;
    hypre_SStructUVEntry   *Uventry;
    hypre_SStructUEntry    *Uentry;
-   hypre_Index             index, to_index, stride;
+   hypre_Index             index, to_index;
    HYPRE_Int               var, to_var, to_part, level_part, level_topart;
-   HYPRE_Int               var1, var2;
-   HYPRE_Int               i, j, k, nUentries;
-   HYPRE_BigInt            row_coord, to_rank;
-   hypre_BoxManEntry      *boxman_entry;
+   HYPRE_Int               var1;
+   HYPRE_Int               i, k, nUentries;
 
    hypre_SStructMatrix    *A_rap;
    hypre_SStructMatrix   **A_level;
@@ -78,44 +68,14 @@ hypre_FacSetup2( void                 *fac_vdata,
    void                  **matvec_data_level;
    void                  **pmatvec_data_level;
    void                   *matvec_data;
-   void                  **relax_data_level;
    void                  **interp_data_level;
    void                  **restrict_data_level;
 
-
-   /* coarsest grid solver */
-   HYPRE_Int               csolver_type       = (fac_data-> csolver_type);
-   HYPRE_SStructSolver     crse_solver = NULL;
-   HYPRE_SStructSolver     crse_precond = NULL;
-
    HYPRE_Int               max_level        =  hypre_FACDataMaxLevels(fac_data);
-   HYPRE_Int               relax_type       =  fac_data -> relax_type;
-   HYPRE_Int               usr_jacobi_weight =  fac_data -> usr_jacobi_weight;
-   HYPRE_Real              jacobi_weight    =  fac_data -> jacobi_weight;
    HYPRE_Int              *levels;
    HYPRE_Int              *part_to_level;
 
-   HYPRE_Int               box, box_volume;
-   HYPRE_Int               max_box_volume;
-   HYPRE_Int               stencil_size;
-   hypre_Index             stencil_shape_i, loop_size;
-   HYPRE_Int              *stencil_vars;
-   HYPRE_Real             *values;
-   HYPRE_Real             *A_smatrix_value;
-
-   HYPRE_Int              *nrows;
-   HYPRE_Int             **ncols;
-   HYPRE_BigInt          **rows;
-   HYPRE_BigInt          **cols;
-   HYPRE_Int              *cnt;
-   HYPRE_Real             *vals;
-
-   HYPRE_BigInt           *level_rows;
-   HYPRE_BigInt           *level_cols;
-   HYPRE_Int               level_cnt;
-
-   HYPRE_IJMatrix          ij_A;
-   HYPRE_Int               matrix_type;
+   HYPRE_Int               box;
 
    HYPRE_Int               max_cycles;
 
@@ -125,8 +85,26 @@ hypre_FacSetup2( void                 *fac_vdata,
      nested_A= hypre_TAlloc(hypre_SStructMatrix ,  1, HYPRE_MEMORY_HOST);
      nested_A= hypre_CoarsenAMROp(fac_vdata, A);*/
 
+   /*--------------------------------------------------------------------------
+    * A re-setup on the graph of the previous setup keeps everything that
+    * depends only on the composite grid.
+    *--------------------------------------------------------------------------*/
+   if ((fac_data -> reuse) && (fac_data -> rap_data) &&
+       (hypre_SStructMatrixGraph(fac_data -> A_rap) == hypre_SStructMatrixGraph(A_in)))
+   {
+      return hypre_FacSetupNumeric(fac_vdata, A_in, b, x);
+   }
+
    /* generate the composite operator with the computed coarse-grid operators */
-   hypre_AMR_RAP(A_in, rfactors, &A_rap);
+   if (fac_data -> reuse)
+   {
+      hypre_AMR_RAPDestroy(fac_data -> rap_data);
+      hypre_AMR_RAPSetup(A_in, rfactors, &A_rap, &(fac_data -> rap_data));
+   }
+   else
+   {
+      hypre_AMR_RAP(A_in, rfactors, &A_rap);
+   }
    (fac_data -> A_rap) = A_rap;
 
    comm = hypre_SStructMatrixComm(A_rap);
@@ -134,8 +112,6 @@ hypre_FacSetup2( void                 *fac_vdata,
    npart = hypre_SStructMatrixNParts(A_rap);
    graph = hypre_SStructMatrixGraph(A_rap);
    grid = hypre_SStructGraphGrid(graph);
-   ij_A = hypre_SStructMatrixIJMatrix(A_rap);
-   matrix_type = hypre_SStructMatrixObjectType(A_rap);
 
    /*--------------------------------------------------------------------------
     * logging arrays.
@@ -324,8 +300,7 @@ hypre_FacSetup2( void                 *fac_vdata,
 
    /*-----------------------------------------------------------
     * Extract the non-stencil graph structure: assuming only like
-    * variables connect. Also count the number of unstructured
-    * connections per part.
+    * variables connect.
     *
     * THE COARSEST COMPOSITE MATRIX DOES NOT HAVE ANY NON-STENCIL
     * CONNECTIONS.
@@ -334,7 +309,6 @@ hypre_FacSetup2( void                 *fac_vdata,
    nUventries =  hypre_SStructGraphNUVEntries(graph);
    iUventries =  hypre_SStructGraphIUVEntries(graph);
 
-   nrows     =  hypre_CTAlloc(HYPRE_Int,  max_level + 1, HYPRE_MEMORY_HOST);
    for (i = 0; i < nUventries; i++)
    {
       Uventry =  Uventries[iUventries[i]];
@@ -364,7 +338,6 @@ hypre_FacSetup2( void                 *fac_vdata,
             level_part   = part_crse;
             level_topart = part_fine;
          }
-         nrows[level]++;
 
          HYPRE_SStructGraphAddEntries(graph_level[level], level_part, index,
                                       var, level_topart, to_index, to_var);
@@ -433,11 +406,162 @@ hypre_FacSetup2( void                 *fac_vdata,
     *-----------------------------------------------------------*/
 
    A_level = hypre_TAlloc(hypre_SStructMatrix *,  max_level + 1, HYPRE_MEMORY_HOST);
-   hypre_SetIndex3(stride, 1, 1, 1);
    for (level = 0; level <= max_level; level++)
    {
       HYPRE_SStructMatrixCreate(comm, graph_level[level], &A_level[level]);
       HYPRE_SStructMatrixInitialize(A_level[level]);
+   }
+   (fac_data -> A_level) = A_level;
+
+   hypre_FacSetLevelMatrices(fac_vdata);
+
+   /*---------------------------------------------------------------
+    * Construct the fine grid (part 1) SStruct_PMatrix for all
+    * levels except for max_level. This involves coarsening the
+    * finer level SStruct_Matrix. Coarsening involves interpolation,
+    * matvec, and restriction (to obtain the "row-sum").
+    *---------------------------------------------------------------*/
+   matvec_data_level  = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
+   pmatvec_data_level = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
+   interp_data_level  = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
+   restrict_data_level = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
+   for (level = 0; level <= max_level; level++)
+   {
+      if (level < max_level)
+      {
+         hypre_FacSemiInterpCreate2(&interp_data_level[level]);
+         hypre_FacSemiInterpSetup2(interp_data_level[level],
+                                   x_level[level + 1],
+                                   hypre_SStructVectorPVector(x_level[level], part_fine),
+                                   refine_factors[level + 1]);
+      }
+      else
+      {
+         interp_data_level[level] = NULL;
+      }
+
+      if (level > 0)
+      {
+         hypre_FacSemiRestrictCreate2(&restrict_data_level[level]);
+
+         hypre_FacSemiRestrictSetup2(restrict_data_level[level],
+                                     x_level[level], part_crse, part_fine,
+                                     hypre_SStructVectorPVector(x_level[level - 1], part_fine),
+                                     refine_factors[level]);
+      }
+      else
+      {
+         restrict_data_level[level] = NULL;
+      }
+   }
+
+   /*------------------------------------------------------------
+    * create data structures that are needed for coarsening
+    -------------------------------------------------------------*/
+   for (level = max_level; level >= 0; level--)
+   {
+      hypre_SStructMatvecCreate(&matvec_data_level[level]);
+      hypre_SStructMatvecSetup(matvec_data_level[level],
+                               A_level[level],
+                               x_level[level]);
+
+      hypre_SStructPMatvecCreate(&pmatvec_data_level[level]);
+      hypre_SStructPMatvecSetup(pmatvec_data_level[level],
+                                hypre_SStructMatrixPMatrix(A_level[level], part_fine),
+                                hypre_SStructVectorPVector(x_level[level], part_fine));
+   }
+
+   hypre_SStructMatvecCreate(&matvec_data);
+   hypre_SStructMatvecSetup(matvec_data, A_rap, x);
+
+   /*HYPRE_SStructVectorPrint("sstruct.out.b_l", b_level[max_level], 0);*/
+   /*HYPRE_SStructMatrixPrint("sstruct.out.A_l",  A_level[max_level-2], 0);*/
+   (fac_data -> matvec_data_level)   = matvec_data_level;
+   (fac_data -> pmatvec_data_level)  = pmatvec_data_level;
+   (fac_data -> matvec_data)         = matvec_data;
+   (fac_data -> interp_data_level)   = interp_data_level;
+   (fac_data -> restrict_data_level) = restrict_data_level;
+
+   hypre_FacSetupLevelSolvers(fac_vdata);
+
+   hypre_FacZeroCData(fac_vdata, A_rap);
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FacSetLevelMatrices: Copies the coefficients of the composite
+ * operator A_rap into the level matrices and assembles them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FacSetLevelMatrices( void *fac_vdata )
+{
+   hypre_FACData          *fac_data      =  (hypre_FACData*)fac_vdata;
+
+   hypre_SStructMatrix    *A_rap         =  (fac_data -> A_rap);
+   hypre_SStructMatrix   **A_level       =  (fac_data -> A_level);
+   hypre_SStructGrid     **grid_level    =  (fac_data -> grid_level);
+   hypre_SStructGraph    **graph_level   =  (fac_data -> graph_level);
+   HYPRE_Int              *levels        =  (fac_data -> level_to_part);
+   HYPRE_Int              *part_to_level =  (fac_data -> part_to_level);
+   hypre_Index            *refine_factors =  (fac_data -> refine_factors);
+   HYPRE_Int               max_level     =  hypre_FACDataMaxLevels(fac_data);
+
+   HYPRE_Int               ndim          =  hypre_SStructMatrixNDim(A_rap);
+   hypre_SStructGraph     *graph         =  hypre_SStructMatrixGraph(A_rap);
+   hypre_SStructGrid      *grid          =  hypre_SStructGraphGrid(graph);
+   HYPRE_IJMatrix          ij_A          =  hypre_SStructMatrixIJMatrix(A_rap);
+   HYPRE_Int               matrix_type   =  hypre_SStructMatrixObjectType(A_rap);
+
+   HYPRE_Int               part_crse     =  0;
+   HYPRE_Int               part_fine     =  1;
+   hypre_SStructPMatrix   *A_pmatrix;
+   hypre_StructMatrix     *A_smatrix;
+   hypre_Box              *A_smatrix_dbox;
+
+   hypre_SStructPGrid     *pgrid;
+   hypre_StructGrid       *sgrid;
+   hypre_BoxArray         *sgrid_boxes;
+   hypre_Box              *sgrid_box;
+   hypre_SStructStencil   *stencils;
+
+   hypre_IndexRef          box_start;
+   hypre_IndexRef          box_end;
+
+   hypre_SStructUVEntry  **Uventries;
+   HYPRE_Int               nUventries;
+   HYPRE_Int              *iUventries;
+   hypre_SStructUVEntry   *Uventry;
+   hypre_Index             index, stride;
+   HYPRE_Int               var, to_part, part, level;
+   HYPRE_Int               var1, var2, nvars;
+   HYPRE_Int               i, j, k, nUentries;
+   HYPRE_BigInt            row_coord, to_rank;
+   hypre_BoxManEntry      *boxman_entry;
+
+   HYPRE_Int               box_volume;
+   HYPRE_Int               max_box_volume;
+   HYPRE_Int               stencil_size;
+   hypre_Index             stencil_shape_i, loop_size;
+   HYPRE_Int              *stencil_vars;
+   HYPRE_Real             *values;
+   HYPRE_Real             *A_smatrix_value;
+
+   HYPRE_Int              *nrows;
+   HYPRE_Int             **ncols;
+   HYPRE_BigInt          **rows;
+   HYPRE_BigInt          **cols;
+   HYPRE_Int              *cnt;
+   HYPRE_Real             *vals;
+
+   HYPRE_BigInt           *level_rows;
+   HYPRE_BigInt           *level_cols;
+   HYPRE_Int               level_cnt;
+
+   hypre_SetIndex3(stride, 1, 1, 1);
+   for (level = 0; level <= max_level; level++)
+   {
 
       max_box_volume = 0;
       pgrid = hypre_SStructGridPGrid(grid, levels[level]);
@@ -592,6 +716,24 @@ hypre_FacSetup2( void                 *fac_vdata,
    nUventries =  hypre_SStructGraphNUVEntries(graph);
    iUventries =  hypre_SStructGraphIUVEntries(graph);
 
+   /*-----------------------------------------------------------
+    * Count the unstructured connections per level.
+    *-----------------------------------------------------------*/
+   nrows =  hypre_CTAlloc(HYPRE_Int,  max_level + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nUventries; i++)
+   {
+      Uventry  =  Uventries[iUventries[i]];
+
+      part      =  hypre_SStructUVEntryPart(Uventry);
+      nUentries =  hypre_SStructUVEntryNUEntries(Uventry);
+      for (k = 0; k < nUentries; k++)
+      {
+         to_part =  hypre_SStructUVEntryToPart(Uventry, k);
+         level   =  hypre_max( part_to_level[part], part_to_level[to_part] );
+         nrows[level]++;
+      }
+   }
+
    /*-----------------------------------------------------------
     * Allocate memory for arguments of HYPRE_IJMatrixGetValues.
     *-----------------------------------------------------------*/
@@ -707,49 +849,8 @@ hypre_FacSetup2( void                 *fac_vdata,
    hypre_TFree(cols, HYPRE_MEMORY_HOST);
    hypre_TFree(nrows, HYPRE_MEMORY_HOST);
 
-   /*---------------------------------------------------------------
-    * Construct the fine grid (part 1) SStruct_PMatrix for all
-    * levels except for max_level. This involves coarsening the
-    * finer level SStruct_Matrix. Coarsening involves interpolation,
-    * matvec, and restriction (to obtain the "row-sum").
-    *---------------------------------------------------------------*/
-   matvec_data_level  = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
-   pmatvec_data_level = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
-   interp_data_level  = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
-   restrict_data_level = hypre_TAlloc(void *,  max_level + 1, HYPRE_MEMORY_HOST);
-   for (level = 0; level <= max_level; level++)
-   {
-      if (level < max_level)
-      {
-         hypre_FacSemiInterpCreate2(&interp_data_level[level]);
-         hypre_FacSemiInterpSetup2(interp_data_level[level],
-                                   x_level[level + 1],
-                                   hypre_SStructVectorPVector(x_level[level], part_fine),
-                                   refine_factors[level + 1]);
-      }
-      else
-      {
-         interp_data_level[level] = NULL;
-      }
-
-      if (level > 0)
-      {
-         hypre_FacSemiRestrictCreate2(&restrict_data_level[level]);
-
-         hypre_FacSemiRestrictSetup2(restrict_data_level[level],
-                                     x_level[level], part_crse, part_fine,
-                                     hypre_SStructVectorPVector(x_level[level - 1], part_fine),
-                                     refine_factors[level]);
-      }
-      else
-      {
-         restrict_data_level[level] = NULL;
-      }
-   }
-
    for (level = max_level; level > 0; level--)
    {
-
       /*  hypre_FacZeroCFSten(hypre_SStructMatrixPMatrix(A_level[level], part_fine),
           hypre_SStructMatrixPMatrix(A_level[level], part_crse),
           grid_level[level],
@@ -762,20 +863,7 @@ hypre_FacSetup2( void                 *fac_vdata,
 
       hypre_ZeroAMRMatrixData(A_level[level], part_crse, refine_factors[level]);
 
-
       HYPRE_SStructMatrixAssemble(A_level[level]);
-      /*------------------------------------------------------------
-       * create data structures that are needed for coarsening
-       -------------------------------------------------------------*/
-      hypre_SStructMatvecCreate(&matvec_data_level[level]);
-      hypre_SStructMatvecSetup(matvec_data_level[level],
-                               A_level[level],
-                               x_level[level]);
-
-      hypre_SStructPMatvecCreate(&pmatvec_data_level[level]);
-      hypre_SStructPMatvecSetup(pmatvec_data_level[level],
-                                hypre_SStructMatrixPMatrix(A_level[level], part_fine),
-                                hypre_SStructVectorPVector(x_level[level], part_fine));
    }
 
    /*---------------------------------------------------------------
@@ -842,27 +930,37 @@ hypre_FacSetup2( void                 *fac_vdata,
 
    HYPRE_SStructMatrixAssemble(A_level[0]);
 
-   hypre_SStructMatvecCreate(&matvec_data_level[0]);
-   hypre_SStructMatvecSetup(matvec_data_level[0],
-                            A_level[0],
-                            x_level[0]);
+   return hypre_error_flag;
+}
 
-   hypre_SStructPMatvecCreate(&pmatvec_data_level[0]);
-   hypre_SStructPMatvecSetup(pmatvec_data_level[0],
-                             hypre_SStructMatrixPMatrix(A_level[0], part_fine),
-                             hypre_SStructVectorPVector(x_level[0], part_fine));
+/*--------------------------------------------------------------------------
+ * hypre_FacSetupLevelSolvers: Sets up the fine patch relaxation of each
+ * level and the coarsest level solver.
+ *--------------------------------------------------------------------------*/
 
-   hypre_SStructMatvecCreate(&matvec_data);
-   hypre_SStructMatvecSetup(matvec_data, A_rap, x);
+HYPRE_Int
+hypre_FacSetupLevelSolvers( void *fac_vdata )
+{
+   hypre_FACData          *fac_data         =  (hypre_FACData*)fac_vdata;
 
-   /*HYPRE_SStructVectorPrint("sstruct.out.b_l", b_level[max_level], 0);*/
-   /*HYPRE_SStructMatrixPrint("sstruct.out.A_l",  A_level[max_level-2], 0);*/
-   (fac_data -> A_level)             = A_level;
-   (fac_data -> matvec_data_level)   = matvec_data_level;
-   (fac_data -> pmatvec_data_level)  = pmatvec_data_level;
-   (fac_data -> matvec_data)         = matvec_data;
-   (fac_data -> interp_data_level)   = interp_data_level;
-   (fac_data -> restrict_data_level) = restrict_data_level;
+   MPI_Comm                comm             =  hypre_SStructMatrixComm(fac_data -> A_rap);
+   HYPRE_Int               max_level        =  hypre_FACDataMaxLevels(fac_data);
+   hypre_SStructMatrix   **A_level          =  (fac_data -> A_level);
+   hypre_SStructVector   **b_level          =  (fac_data -> b_level);
+   hypre_SStructVector   **x_level          =  (fac_data -> x_level);
+   hypre_SStructPVector  **tx_level         =  (fac_data -> tx_level);
+   HYPRE_Int               part_fine        =  1;
+   HYPRE_Int               level;
+
+   void                  **relax_data_level;
+   HYPRE_Int               relax_type       =  fac_data -> relax_type;
+   HYPRE_Int               usr_jacobi_weight =  fac_data -> usr_jacobi_weight;
+   HYPRE_Real              jacobi_weight    =  fac_data -> jacobi_weight;
+
+   /* coarsest grid solver */
+   HYPRE_Int               csolver_type     = (fac_data-> csolver_type);
+   HYPRE_SStructSolver     crse_solver = NULL;
+   HYPRE_SStructSolver     crse_precond = NULL;
 
    /*---------------------------------------------------------------
     * Create the fine patch relax_data structure.
@@ -945,8 +1043,51 @@ hypre_FacSetup2( void                 *fac_vdata,
    (fac_data -> csolver)  = crse_solver;
    (fac_data -> cprecond) = crse_precond;
 
-   hypre_FacZeroCData(fac_vdata, A_rap);
-
-   return ierr;
+   return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FacSetupNumeric: Re-setup for a matrix on the graph of the previous
+ * setup- i.e., the same composite grid and refinement layout with new
+ * coefficients. The level grids, graphs and vectors, the interpolation,
+ * restriction and matvec data, and the hypre_AMR_RAPSetup data are kept.
+ * A_rap and the level matrices are recomputed in place, and the relaxation
+ * and the coarsest level solver are set up again.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FacSetupNumeric( void                 *fac_vdata,
+                       hypre_SStructMatrix  *A_in,
+                       hypre_SStructVector  *b,
+                       hypre_SStructVector  *x )
+{
+   hypre_FACData          *fac_data      =  (hypre_FACData*)fac_vdata;
+   HYPRE_Int               max_level     =  hypre_FACDataMaxLevels(fac_data);
+   HYPRE_Int               level;
+
+   hypre_AMR_RAPCompute(A_in, (fac_data -> prefinements), (fac_data -> A_rap),
+                        (fac_data -> rap_data));
+
+   for (level = 0; level <= max_level; level++)
+   {
+      hypre_SysPFMGRelaxDestroy(fac_data -> relax_data_level[level]);
+   }
+   hypre_TFree(fac_data -> relax_data_level, HYPRE_MEMORY_HOST);
+
+   if ((fac_data -> csolver_type) == 1)
+   {
+      HYPRE_SStructPCGDestroy(fac_data -> csolver);
+      HYPRE_SStructSysPFMGDestroy(fac_data -> cprecond);
+   }
+   else if ((fac_data -> csolver_type) == 2)
+   {
+      HYPRE_SStructSysPFMGDestroy(fac_data -> csolver);
+   }
+
+   hypre_FacSetLevelMatrices(fac_vdata);
+   hypre_FacSetupLevelSolvers(fac_vdata);
+
+   hypre_FacZeroCData(fac_vdata, fac_data -> A_rap);
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,73 @@
 /* TODO consider adding it to semistruct header files */
 #define HYPRE_MAXVARS 4
 
+/*--------------------------------------------------------------------------
+ * Gaussian elimination of the n x n block L in place.  The multipliers are
+ * kept below the diagonal, so hypre_NodeRelaxBlockSolve() then does the same
+ * operations on x as hypre_gselim() does.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_NodeRelaxBlockFactor(L, n)                \
+{                                                      \
+   HYPRE_Int  j_, k_, m_;                              \
+   HYPRE_Real divA_;                                   \
+   for (k_ = 0; k_ < n - 1; k_++)                      \
+   {                                                   \
+      if (L[k_*n+k_] != 0.0)                           \
+      {                                                \
+         divA_ = 1.0 / L[k_*n+k_];                     \
+         for (j_ = k_ + 1; j_ < n; j_++)               \
+         {                                             \
+            if (L[j_*n+k_] != 0.0)                     \
+            {                                          \
+               L[j_*n+k_] *= divA_;                    \
+               for (m_ = k_ + 1; m_ < n; m_++)         \
+               {                                       \
+                  L[j_*n+m_] -= L[j_*n+k_] * L[k_*n+m_]; \
+               }                                       \
+            }                                          \
+         }                                             \
+      }                                                \
+      else                                             \
+      {                                                \
+         for (j_ = k_ + 1; j_ < n; j_++)               \
+         {                                             \
+            L[j_*n+k_] = 0.0;                          \
+         }                                             \
+      }                                                \
+   }                                                   \
+}
+
+#define hypre_NodeRelaxBlockSolve(L, x, n)              \
+{                                                      \
+   HYPRE_Int  j_, k_;                                  \
+   for (k_ = 0; k_ < n - 1; k_++)                      \
+   {                                                   \
+      for (j_ = k_ + 1; j_ < n; j_++)                  \
+      {                                                \
+         if (L[j_*n+k_] != 0.0)                        \
+         {                                             \
+            x[j_] -= L[j_*n+k_] * x[k_];               \
+         }                                             \
+      }                                                \
+   }                                                   \
+   for (k_ = n - 1; k_ > 0; --k_)                      \
+   {                                                   \
+      if (L[k_*n+k_] != 0.0)                           \
+      {                                                \
+         x[k_] /= L[k_*n+k_];                          \
+         for (j_ = 0; j_ < k_; j_++)                   \
+         {                                             \
+            if (L[j_*n+k_] != 0.0)                     \
+            {                                          \
+               x[j_] -= x[k_] * L[j_*n+k_];            \
+            }                                          \
+         }                                             \
+      }                                                \
+   }                                                   \
+   if (L[0] != 0.0) x[0] /= L[0];                      \
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -41,6 +108,18 @@ typedef struct
 
    HYPRE_Int             **diag_rank;
 
+   /* factored diagonal blocks, stored interleaved (one nvars x nvars block
+      per data point of A(0,0), starting at diag_lu_offsets[box]) */
+   HYPRE_Real             *diag_lu;
+   HYPRE_Int              *diag_lu_offsets;
+
+   /* off-diagonal coefficients and shifted x pointers of the current box,
+      grouped by row variable (offd_starts[vi] to offd_starts[vi+1]) */
+   HYPRE_Int               offd_size;
+   HYPRE_Int              *offd_starts;
+   HYPRE_Real            **offd_Ap;
+   HYPRE_Real            **offd_xp;
+
    /* defines sends and recieves for each struct_vector */
    hypre_ComputePkg     ***svec_compute_pkgs;
    hypre_CommHandle     **comm_handle;
@@ -96,6 +175,12 @@ hypre_NodeRelaxCreate( MPI_Comm  comm )
    (relax_data -> nodeset_strides)  = NULL;
    (relax_data -> nodeset_indices)  = NULL;
    (relax_data -> diag_rank)        = NULL;
+   (relax_data -> diag_lu)          = NULL;
+   (relax_data -> diag_lu_offsets)  = NULL;
+   (relax_data -> offd_size)        = 0;
+   (relax_data -> offd_starts)      = NULL;
+   (relax_data -> offd_Ap)          = NULL;
+   (relax_data -> offd_xp)          = NULL;
    (relax_data -> t)                = NULL;
    /*
    (relax_data -> A_loc)            = NULL;
@@ -164,6 +249,11 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
          hypre_TFree((relax_data -> diag_rank)[vi], HYPRE_MEMORY_HOST);
       }
       hypre_TFree(relax_data -> diag_rank, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> diag_lu, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(relax_data -> diag_lu_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> offd_starts, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(relax_data -> offd_Ap, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(relax_data -> offd_xp, HYPRE_MEMORY_DEVICE);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -200,6 +290,24 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    HYPRE_Real           **xp;
    HYPRE_Real           **tp;
 
+   HYPRE_Real            *_h_Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
+   HYPRE_Real           **h_Ap;
+
+   HYPRE_Real            *diag_lu;
+   HYPRE_Int             *diag_lu_offsets;
+   HYPRE_Int              diag_lu_size;
+   HYPRE_Real            *lu;
+   hypre_BoxArray        *data_space;
+   hypre_Box             *A_data_box;
+   hypre_Index            unit_stride;
+   hypre_Index            loop_size;
+
+   HYPRE_Int              offd_size;
+   HYPRE_Int              h_offd_starts[HYPRE_MAXVARS + 1];
+   HYPRE_Int             *offd_starts;
+   HYPRE_Real           **offd_Ap;
+   HYPRE_Real           **offd_xp;
+
    hypre_ComputeInfo     *compute_info;
    hypre_ComputePkg     **compute_pkgs;
    hypre_ComputePkg    ***svec_compute_pkgs;
@@ -295,11 +403,112 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    tp = hypre_TAlloc(HYPRE_Real *, nvars,       HYPRE_MEMORY_DEVICE);
    Ap = hypre_TAlloc(HYPRE_Real *, nvars * nvars, HYPRE_MEMORY_DEVICE);
 
+   /* Ap is a device pointer */
+   if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
+   {
+      h_Ap = _h_Ap;
+   }
+   else
+   {
+      h_Ap = Ap;
+   }
+
    /*----------------------------------------------------------
-    * Set up the compute packages for each nodeset
+    * Factor the diagonal blocks once, instead of in every sweep
     *----------------------------------------------------------*/
 
    sgrid = hypre_StructMatrixGrid(hypre_SStructPMatrixSMatrix(A, 0, 0));
+   data_space = hypre_StructMatrixDataSpace(hypre_SStructPMatrixSMatrix(A, 0, 0));
+
+   diag_lu_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(data_space),
+                                  HYPRE_MEMORY_HOST);
+   diag_lu_size = 0;
+   hypre_ForBoxI(i, data_space)
+   {
+      diag_lu_offsets[i] = diag_lu_size;
+      diag_lu_size += nvars * nvars * hypre_BoxVolume(hypre_BoxArrayBox(data_space, i));
+   }
+   diag_lu = hypre_CTAlloc(HYPRE_Real, diag_lu_size, HYPRE_MEMORY_DEVICE);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, hypre_StructGridBoxes(sgrid))
+   {
+      box = hypre_BoxArrayBox(hypre_StructGridBoxes(sgrid), i);
+      A_data_box = hypre_BoxArrayBox(data_space, i);
+      lu = diag_lu + diag_lu_offsets[i];
+
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
+            {
+               h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData(hypre_SStructPMatrixSMatrix(A, vi, vj),
+                                                                 i, diag_rank[vi][vj]);
+            }
+            else
+            {
+               h_Ap[vi * nvars + vj] = NULL;
+            }
+         }
+      }
+
+      if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
+      {
+         hypre_Memcpy(Ap, h_Ap, nvars * nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+      }
+
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(lu,Ap)
+      hypre_BoxLoop1Begin(ndim, loop_size,
+                          A_data_box, hypre_BoxIMin(box), unit_stride, Ai);
+      {
+         HYPRE_Int   vi, vj;
+         HYPRE_Real *L = lu + Ai * nvars * nvars;
+
+         for (vi = 0; vi < nvars; vi++)
+         {
+            for (vj = 0; vj < nvars; vj++)
+            {
+               HYPRE_Real *Apij = Ap[vi * nvars + vj];
+               L[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
+            }
+         }
+         hypre_NodeRelaxBlockFactor(L, nvars);
+      }
+      hypre_BoxLoop1End(Ai);
+#undef DEVICE_VAR
+   }
+
+   /*----------------------------------------------------------
+    * Allocate the off-diagonal pointers used by the fused sweep
+    *----------------------------------------------------------*/
+
+   offd_size = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      h_offd_starts[vi] = offd_size;
+      for (vj = 0; vj < nvars; vj++)
+      {
+         if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
+         {
+            offd_size += hypre_StructStencilSize(hypre_SStructPMatrixSStencil(A, vi, vj)) - 1;
+         }
+      }
+   }
+   h_offd_starts[nvars] = offd_size;
+
+   offd_starts = hypre_TAlloc(HYPRE_Int, nvars + 1, HYPRE_MEMORY_DEVICE);
+   hypre_TMemcpy(offd_starts, h_offd_starts, HYPRE_Int, nvars + 1,
+                 HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+   offd_Ap = hypre_TAlloc(HYPRE_Real *, offd_size, HYPRE_MEMORY_DEVICE);
+   offd_xp = hypre_TAlloc(HYPRE_Real *, offd_size, HYPRE_MEMORY_DEVICE);
+
+   /*----------------------------------------------------------
+    * Set up the compute packages for each nodeset
+    *----------------------------------------------------------*/
+
    dim = hypre_StructStencilNDim(hypre_SStructPMatrixSStencil(A, 0, 0));
 
    compute_pkgs = hypre_CTAlloc(hypre_ComputePkg *, num_nodesets,
@@ -499,6 +708,17 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    hypre_SStructPVectorRef(b, &(relax_data -> b));
 
    (relax_data -> diag_rank) = diag_rank;
+   hypre_TFree(relax_data -> diag_lu, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(relax_data -> diag_lu_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> offd_starts, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(relax_data -> offd_Ap, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(relax_data -> offd_xp, HYPRE_MEMORY_DEVICE);
+   (relax_data -> diag_lu)         = diag_lu;
+   (relax_data -> diag_lu_offsets) = diag_lu_offsets;
+   (relax_data -> offd_size)       = offd_size;
+   (relax_data -> offd_starts)     = offd_starts;
+   (relax_data -> offd_Ap)         = offd_Ap;
+   (relax_data -> offd_xp)         = offd_xp;
    /*
    (relax_data -> A_loc)     = A_loc;
    (relax_data -> x_loc)     = x_loc;
@@ -573,32 +793,37 @@ hypre_NodeRelax(  void                 *relax_vdata,
    HYPRE_Real            *tx_loc = (relax_data -> x_loc);
    */
 
-   HYPRE_Real           **Ap = (relax_data -> Ap);
    HYPRE_Real           **bp = (relax_data -> bp);
    HYPRE_Real           **xp = (relax_data -> xp);
    HYPRE_Real           **tp = (relax_data -> tp);
 
-   HYPRE_Real            *_h_Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
+   HYPRE_Real            *diag_lu          = (relax_data -> diag_lu);
+   HYPRE_Int             *diag_lu_offsets  = (relax_data -> diag_lu_offsets);
+   HYPRE_Int              offd_size        = (relax_data -> offd_size);
+   HYPRE_Int             *offd_starts      = (relax_data -> offd_starts);
+   HYPRE_Real           **offd_Ap          = (relax_data -> offd_Ap);
+   HYPRE_Real           **offd_xp          = (relax_data -> offd_xp);
+   HYPRE_Real           **h_offd_Ap;
+   HYPRE_Real           **h_offd_xp;
+   HYPRE_Real            *lu;
+
    HYPRE_Real            *_h_bp[HYPRE_MAXVARS];
    HYPRE_Real            *_h_xp[HYPRE_MAXVARS];
    HYPRE_Real            *_h_tp[HYPRE_MAXVARS];
 
-   HYPRE_Real           **h_Ap;
    HYPRE_Real           **h_bp;
    HYPRE_Real           **h_xp;
    HYPRE_Real           **h_tp;
 
-   /* Ap, bp, xp, tp are device pointers */
+   /* bp, xp, tp are device pointers */
    if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
    {
-      h_Ap = _h_Ap;
       h_bp = _h_bp;
       h_xp = _h_xp;
       h_tp = _h_tp;
    }
    else
    {
-      h_Ap = Ap;
       h_bp = bp;
       h_xp = xp;
       h_tp = tp;
@@ -615,7 +840,7 @@ hypre_NodeRelax(  void                 *relax_vdata,
    hypre_Index           *stencil_shape;
    HYPRE_Int              stencil_size;
 
-   HYPRE_Int              iter, p, compute_i, i, j, si;
+   HYPRE_Int              iter, p, compute_i, i, j, k, si;
    HYPRE_Int              nodeset;
 
    HYPRE_Int              nvars, ndim;
@@ -649,6 +874,18 @@ hypre_NodeRelax(  void                 *relax_vdata,
       return hypre_error_flag;
    }
 
+   /* offd_Ap and offd_xp are device pointers */
+   if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
+   {
+      h_offd_Ap = hypre_TAlloc(HYPRE_Real *, offd_size, HYPRE_MEMORY_HOST);
+      h_offd_xp = hypre_TAlloc(HYPRE_Real *, offd_size, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      h_offd_Ap = offd_Ap;
+      h_offd_xp = offd_xp;
+   }
+
    /*----------------------------------------------------------
     * Do zero_guess iteration
     *----------------------------------------------------------*/
@@ -697,27 +934,16 @@ hypre_NodeRelax(  void                 *relax_vdata,
             x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(
                                               hypre_SStructPVectorSVector(x, 0)), i);
 
+            lu = diag_lu + diag_lu_offsets[i];
+
             for (vi = 0; vi < nvars; vi++)
             {
-               for (vj = 0; vj < nvars; vj++)
-               {
-                  if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
-                  {
-                     h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A, vi, vj),
-                                                                        i, diag_rank[vi][vj] );
-                  }
-                  else
-                  {
-                     h_Ap[vi * nvars + vj] = NULL;
-                  }
-               }
                h_bp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(b, vi), i );
                h_xp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(x, vi), i );
             }
 
             if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
             {
-               hypre_Memcpy(Ap, h_Ap, nvars * nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
                hypre_Memcpy(bp, h_bp,       nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
                hypre_Memcpy(xp, h_xp,       nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
             }
@@ -729,39 +955,25 @@ hypre_NodeRelax(  void                 *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(bp,Ap,xp)
+#define DEVICE_VAR is_device_ptr(bp,xp,lu)
                hypre_BoxLoop3Begin(ndim, loop_size,
                                    A_data_box, start, stride, Ai,
                                    b_data_box, start, stride, bi,
                                    x_data_box, start, stride, xi);
                {
-                  HYPRE_Int vi, vj, err;
-                  //HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  //HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
-                  HYPRE_Real x_loc[HYPRE_MAXVARS];
+                  HYPRE_Int   vi;
+                  HYPRE_Real *L = lu + Ai * nvars * nvars;
+                  HYPRE_Real  x_loc[HYPRE_MAXVARS];
+
                   /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
+                   * Solve with the factored intra-nodal coupling
                    *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *bpi = bp[vi];
                      x_loc[vi] = bpi[bi];
-                     for (vj = 0; vj < nvars; vj++)
-                     {
-                        HYPRE_Real *Apij = Ap[vi * nvars + vj];
-                        A_loc[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
-                     }
                   }
-
-                  /*------------------------------------------------
-                   * Invert intra-nodal coupling
-                   *----------------------------------------------*/
-                  hypre_gselim(A_loc, x_loc, nvars, err);
-                  /*------------------------------------------------
-                   * Copy solution from local storage.
-                   *----------------------------------------------*/
+                  hypre_NodeRelaxBlockSolve(L, x_loc, nvars);
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *xpi = xp[vi];
@@ -837,16 +1049,49 @@ hypre_NodeRelax(  void                 *relax_vdata,
             t_data_box = hypre_BoxArrayBox( hypre_StructVectorDataSpace(
                                                hypre_SStructPVectorSVector(t, 0)), i );
 
+            lu = diag_lu + diag_lu_offsets[i];
+
             for (vi = 0; vi < nvars; vi++)
             {
                h_bp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(b, vi), i );
                h_tp[vi] = hypre_StructVectorBoxData( hypre_SStructPVectorSVector(t, vi), i );
             }
 
+            /* off-diagonal coefficients and the x values they multiply */
+            k = 0;
+            for (vi = 0; vi < nvars; vi++)
+            {
+               for (vj = 0; vj < nvars; vj++)
+               {
+                  if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
+                  {
+                     A_block = hypre_SStructPMatrixSMatrix(A, vi, vj);
+                     x_block = hypre_SStructPVectorSVector(x, vj);
+                     stencil = hypre_StructMatrixStencil(A_block);
+                     stencil_shape = hypre_StructStencilShape(stencil);
+                     stencil_size  = hypre_StructStencilSize(stencil);
+                     for (si = 0; si < stencil_size; si++)
+                     {
+                        if (si != diag_rank[vi][vj])
+                        {
+                           h_offd_Ap[k] = hypre_StructMatrixBoxData(A_block, i, si);
+                           h_offd_xp[k] = hypre_StructVectorBoxData(x_block, i) +
+                                          hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+                           k++;
+                        }
+                     }
+                  }
+               }
+            }
+
             if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
             {
                hypre_Memcpy(bp, h_bp, nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
                hypre_Memcpy(tp, h_tp, nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+               hypre_Memcpy(offd_Ap, h_offd_Ap, offd_size * sizeof(HYPRE_Real*),
+                            HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+               hypre_Memcpy(offd_xp, h_offd_xp, offd_size * sizeof(HYPRE_Real*),
+                            HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
             }
 
             hypre_ForBoxI(j, compute_box_a)
@@ -856,123 +1101,38 @@ hypre_NodeRelax(  void                 *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
-#define DEVICE_VAR is_device_ptr(tp,bp)
-               hypre_BoxLoop2Begin(ndim, loop_size,
-                                   b_data_box, start, stride, bi,
-                                   t_data_box, start, stride, ti);
-               {
-                  HYPRE_Int vi;
-                  /* Copy rhs into temp vector */
-                  for (vi = 0; vi < nvars; vi++)
-                  {
-                     HYPRE_Real *tpi = tp[vi];
-                     HYPRE_Real *bpi = bp[vi];
-                     tpi[ti] = bpi[bi];
-                  }
-               }
-               hypre_BoxLoop2End(bi, ti);
-#undef DEVICE_VAR
-
-               for (vi = 0; vi < nvars; vi++)
-               {
-                  for (vj = 0; vj < nvars; vj++)
-                  {
-                     if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
-                     {
-                        A_block = hypre_SStructPMatrixSMatrix(A, vi, vj);
-                        x_block = hypre_SStructPVectorSVector(x, vj);
-                        stencil = hypre_StructMatrixStencil(A_block);
-                        stencil_shape = hypre_StructStencilShape(stencil);
-                        stencil_size  = hypre_StructStencilSize(stencil);
-                        for (si = 0; si < stencil_size; si++)
-                        {
-                           if (si != diag_rank[vi][vj])
-                           {
-                              HYPRE_Real *Apij = hypre_StructMatrixBoxData(A_block, i, si);
-                              HYPRE_Real *xpj  = hypre_StructVectorBoxData(x_block, i) +
-                                                 hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
-                              HYPRE_Real *tpi  = h_tp[vi];
-
-#define DEVICE_VAR is_device_ptr(tpi,Apij,xpj)
-                              hypre_BoxLoop3Begin(ndim, loop_size,
-                                                  A_data_box, start, stride, Ai,
-                                                  x_data_box, start, stride, xi,
-                                                  t_data_box, start, stride, ti);
-                              {
-                                 tpi[ti] -= Apij[Ai] * xpj[xi];
-                              }
-                              hypre_BoxLoop3End(Ai, xi, ti);
-#undef DEVICE_VAR
-                           }
-                        }
-                     }
-                  }
-               }
-
-               for (vi = 0; vi < nvars; vi++)
-               {
-                  for (vj = 0; vj < nvars; vj++)
-                  {
-                     if (hypre_SStructPMatrixSMatrix(A, vi, vj) != NULL)
-                     {
-                        h_Ap[vi * nvars + vj] = hypre_StructMatrixBoxData( hypre_SStructPMatrixSMatrix(A, vi, vj),
-                                                                           i, diag_rank[vi][vj]);
-                     }
-                     else
-                     {
-                        h_Ap[vi * nvars + vj] = NULL;
-                     }
-                  }
-               }
-
-               if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
-               {
-                  hypre_Memcpy(Ap, h_Ap, nvars * nvars * sizeof(HYPRE_Real*), HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
-               }
-
-#define DEVICE_VAR is_device_ptr(tp,Ap)
-               hypre_BoxLoop2Begin(ndim, loop_size,
+               /* one pass per node: subtract the off-diagonal couplings from
+                  the rhs, then solve with the factored diagonal block */
+#define DEVICE_VAR is_device_ptr(bp,tp,lu,offd_starts,offd_Ap,offd_xp)
+               hypre_BoxLoop4Begin(ndim, loop_size,
                                    A_data_box, start, stride, Ai,
+                                   b_data_box, start, stride, bi,
+                                   x_data_box, start, stride, xi,
                                    t_data_box, start, stride, ti);
                {
-                  HYPRE_Int vi, vj, err;
-                  /*
-                  HYPRE_Real *A_loc = tA_loc + hypre_BoxLoopBlock() * nvars * nvars;
-                  HYPRE_Real *x_loc = tx_loc + hypre_BoxLoopBlock() * nvars;
-                  */
-                  HYPRE_Real A_loc[HYPRE_MAXVARS * HYPRE_MAXVARS];
-                  HYPRE_Real x_loc[HYPRE_MAXVARS];
+                  HYPRE_Int   vi, k;
+                  HYPRE_Real *L = lu + Ai * nvars * nvars;
+                  HYPRE_Real  x_loc[HYPRE_MAXVARS];
 
-                  /*------------------------------------------------
-                   * Copy rhs and matrix for diagonal coupling
-                   * (intra-nodal) into local storage.
-                   *----------------------------------------------*/
                   for (vi = 0; vi < nvars; vi++)
                   {
-                     HYPRE_Real *tpi = tp[vi];
-                     x_loc[vi] = tpi[ti];
-                     for (vj = 0; vj < nvars; vj++)
+                     HYPRE_Real *bpi = bp[vi];
+                     x_loc[vi] = bpi[bi];
+                     for (k = offd_starts[vi]; k < offd_starts[vi + 1]; k++)
                      {
-                        HYPRE_Real *Apij = Ap[vi * nvars + vj];
-                        A_loc[vi * nvars + vj] = Apij ? Apij[Ai] : 0.0;
+                        HYPRE_Real *Apij = offd_Ap[k];
+                        HYPRE_Real *xpj  = offd_xp[k];
+                        x_loc[vi] -= Apij[Ai] * xpj[xi];
                      }
                   }
-
-                  /*------------------------------------------------
-                   * Invert intra-nodal coupling
-                   *----------------------------------------------*/
-                  hypre_gselim(A_loc, x_loc, nvars, err);
-                  /*------------------------------------------------
-                   * Copy solution from local storage.
-                   *----------------------------------------------*/
+                  hypre_NodeRelaxBlockSolve(L, x_loc, nvars);
                   for (vi = 0; vi < nvars; vi++)
                   {
                      HYPRE_Real *tpi = tp[vi];
                      tpi[ti] = x_loc[vi];
                   }
-
                }
-               hypre_BoxLoop2End(Ai, ti);
+               hypre_BoxLoop4End(Ai, bi, xi, ti);
 #undef DEVICE_VAR
             }
          }
@@ -994,6 +1154,12 @@ hypre_NodeRelax(  void                 *relax_vdata,
 
    (relax_data -> num_iterations) = iter;
 
+   if (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST)
+   {
+      hypre_TFree(h_offd_Ap, HYPRE_MEMORY_HOST);
+      hypre_TFree(h_offd_xp, HYPRE_MEMORY_HOST);
+   }
+
    /*-----------------------------------------------------------------------
     * Return
     *-----------------------------------------------------------------------*/
@@ -112,6 +112,8 @@ HYPRE_SStructMatrixCreate( MPI_Comm              comm,
 
    hypre_SStructMatrixIJMatrix(matrix)     = NULL;
    hypre_SStructMatrixParCSRMatrix(matrix) = NULL;
+   hypre_SStructMatrixUFillSize(matrix)    = 0;
+   hypre_SStructMatrixUFillMap(matrix)     = NULL;
 
    size = 0;
    for (part = 0; part < nparts; part++)
@@ -198,6 +200,7 @@ HYPRE_SStructMatrixDestroy( HYPRE_SStructMatrix matrix )
          hypre_TFree(hypre_SStructMatrixTmpRowCoordsDevice(matrix), HYPRE_MEMORY_DEVICE);
          hypre_TFree(hypre_SStructMatrixTmpColCoordsDevice(matrix), HYPRE_MEMORY_DEVICE);
          hypre_TFree(hypre_SStructMatrixTmpCoeffsDevice(matrix),    HYPRE_MEMORY_DEVICE);
+         hypre_TFree(hypre_SStructMatrixUFillMap(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(matrix, HYPRE_MEMORY_HOST);
       }
    }
@@ -151,12 +151,53 @@ HYPRE_SStructVectorInitialize( HYPRE_SStructVector vector )
    hypre_ParVector        *par_vector;
    hypre_Vector           *parlocal_vector;
 
+   HYPRE_Int               alias;
+   HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM] = {0};
+
+
+   /* A HYPRE_PARCSR vector of cell variables that are not shared between
+    * parts does not need ghost zones.  Without them, the data chunk has the
+    * global ParCSR ordering, and the parvector can use it directly. */
+
+   alias = 0;
+   if (vector_type == HYPRE_PARCSR && hypre_SStructGridVNborNComms(grid) == 0)
+   {
+      alias = 1;
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid    = hypre_SStructPVectorPGrid(hypre_SStructVectorPVector(vector, part));
+         vartypes = hypre_SStructPGridVarTypes(pgrid);
+         for (var = 0; var < hypre_SStructPGridNVars(pgrid); var++)
+         {
+            if (vartypes[var] != HYPRE_SSTRUCT_VARIABLE_CELL)
+            {
+               alias = 0;
+            }
+         }
+      }
+   }
+   if (alias)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         pvector = hypre_SStructVectorPVector(vector, part);
+         for (var = 0; var < hypre_SStructPVectorNVars(pvector); var++)
+         {
+            hypre_StructVectorSetNumGhost(hypre_SStructPVectorSVector(pvector, var),
+                                          num_ghost);
+         }
+      }
+   }
 
    /* GEC0902 getting the datasizes and indices we need  */
 
    hypre_SStructVectorInitializeShell(vector);
 
    datasize = hypre_SStructVectorDataSize(vector);
+   if (datasize != hypre_SStructGridLocalSize(grid))
+   {
+      alias = 0;
+   }
 
    data = hypre_CTAlloc(HYPRE_Complex, datasize, HYPRE_MEMORY_DEVICE);
 
@@ -240,6 +281,15 @@ HYPRE_SStructVectorInitialize( HYPRE_SStructVector vector )
       hypre_TFree(hypre_VectorData(parlocal_vector), HYPRE_MEMORY_DEVICE);
       hypre_VectorData(parlocal_vector) = data ;
    }
+   else if (alias)
+   {
+      /* the data chunk is freed with the sstruct vector */
+      par_vector = (hypre_ParVector        *)hypre_IJVectorObject(ijvector);
+      parlocal_vector = hypre_ParVectorLocalVector(par_vector);
+      hypre_TFree(hypre_VectorData(parlocal_vector), HYPRE_MEMORY_DEVICE);
+      hypre_VectorData(parlocal_vector) = data ;
+      hypre_VectorOwnsData(parlocal_vector) = 0;
+   }
 
    return hypre_error_flag;
 }
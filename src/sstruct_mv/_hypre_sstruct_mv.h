@@ -592,6 +592,11 @@ typedef struct hypre_SStructMatrix_struct
    HYPRE_IJMatrix          ijmatrix;
    hypre_ParCSRMatrix     *parcsrmatrix;
 
+   /* direct fill of HYPRE_PARCSR U-matrices (NULL map if not used) */
+   HYPRE_Int               ufill_size;   /* row stride of ufill_map */
+   HYPRE_Int              *ufill_map;    /* diag/offd data position of each
+                                          * (local row, stencil entry) */
+
    /* temporary storage for SetValues routines */
    HYPRE_Int               entries_size;
    HYPRE_Int              *Sentries;
@@ -630,6 +635,8 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixSymmetric(mat)            ((mat) -> symmetric)
 #define hypre_SStructMatrixIJMatrix(mat)             ((mat) -> ijmatrix)
 #define hypre_SStructMatrixParCSRMatrix(mat)         ((mat) -> parcsrmatrix)
+#define hypre_SStructMatrixUFillSize(mat)            ((mat) -> ufill_size)
+#define hypre_SStructMatrixUFillMap(mat)             ((mat) -> ufill_map)
 #define hypre_SStructMatrixEntriesSize(mat)          ((mat) -> entries_size)
 #define hypre_SStructMatrixSEntries(mat)             ((mat) -> Sentries)
 #define hypre_SStructMatrixUEntries(mat)             ((mat) -> Uentries)
@@ -1009,12 +1016,16 @@ HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPR
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructUMatrixInitializeFill ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                           hypre_Index index, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values,
                                           HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                             hypre_Box *set_box, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, hypre_Box *value_box,
                                             HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_SStructUMatrixSetBoxValuesFill ( hypre_SStructMatrix *matrix,
+                                                 hypre_BoxManEntry *boxman_entry, hypre_Box *box, HYPRE_Int nentries, HYPRE_Int *entries,
+                                                 hypre_Box *value_box, HYPRE_Complex *values, HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixAssemble ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructMatrixRef ( hypre_SStructMatrix *matrix, hypre_SStructMatrix **matrix_ref );
 HYPRE_Int hypre_SStructMatrixSplitEntries ( hypre_SStructMatrix *matrix, HYPRE_Int part,
@@ -662,6 +662,7 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    HYPRE_Int               part, var, entry, b, m, mi;
    HYPRE_Int              *row_sizes;
    HYPRE_Int               max_row_size;
+   HYPRE_Int               fill = 0;
 
    hypre_BoxArray         *boxes;
    hypre_Box              *box;
@@ -684,7 +685,31 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    {
       rowstart = hypre_SStructGridStartRank(grid);
       nrows = hypre_SStructGridLocalSize(grid);
+
+      /* fill the ParCSR arrays directly when they live on the host.  Rows in
+       * neighbor boxes (neighbor parts or shared variables) also get
+       * couplings from the stencils of other parts, which the fill pattern
+       * does not include, so these grids use the IJ interface. */
+      if (hypre_GetExecPolicy1(hypre_HandleMemoryLocation(hypre_handle())) == HYPRE_EXEC_HOST)
+      {
+         fill = 1;
+      }
+      for (part = 0; part < nparts; part++)
+      {
+         nvars = hypre_SStructPGridNVars(pgrids[part]);
+         for (var = 0; var < nvars; var++)
+         {
+            if (nvneighbors[part][var])
+            {
+               fill = 0;
+            }
+         }
+      }
+      hypre_MPI_Allreduce(&fill, &m, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                          hypre_SStructMatrixComm(matrix));
+      fill = m;
    }
+   hypre_TFree(hypre_SStructMatrixUFillMap(matrix), HYPRE_MEMORY_HOST);
 
    /* set row sizes */
    m = 0;
@@ -767,7 +792,10 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    }
 
    /* ZTODO: Update row_sizes based on neighbor off-part couplings */
-   HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   if (!fill)
+   {
+      HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   }
 
    hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
 
@@ -785,8 +813,438 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    hypre_SStructMatrixTmpCoeffsDevice(matrix)    = hypre_CTAlloc(HYPRE_Complex, max_row_size,
                                                                  HYPRE_MEMORY_DEVICE);
 
+   if (fill)
+   {
+      hypre_SStructUMatrixInitializeFill(matrix);
+   }
+   else
+   {
+      HYPRE_IJMatrixInitialize(ijmatrix);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes the exact nonzero pattern of a HYPRE_PARCSR U-matrix from the graph
+ * stencils and non-stencil entries, preallocates the diag and offd parts of
+ * the IJ matrix with it, and initializes the IJ matrix with all of its column
+ * indices in place.  Each row stores the diagonal first, followed by the other
+ * columns in stencil order and then the non-stencil columns, which is the
+ * order that the IJ assembly would produce.
+ *
+ * The position of the coefficient of each (local row, stencil entry) pair in
+ * the diag or offd data array is saved in the fill map (offd positions are
+ * shifted by the number of diag nonzeros, and -1 means that the stencil entry
+ * points outside of the domain grid).  This lets SetBoxValues write stencil
+ * coefficients of local rows directly into the ParCSR arrays.  All other
+ * values still go through the IJ interface, which finds their columns in the
+ * preallocated rows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructUMatrixInitializeFill( hypre_SStructMatrix *matrix )
+{
+   MPI_Comm                comm        = hypre_SStructMatrixComm(matrix);
+   HYPRE_Int               ndim        = hypre_SStructMatrixNDim(matrix);
+   HYPRE_IJMatrix          ijmatrix    = hypre_SStructMatrixIJMatrix(matrix);
+   hypre_SStructGraph     *graph       = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *grid        = hypre_SStructGraphGrid(graph);
+   hypre_SStructGrid      *dom_grid    = hypre_SStructGraphDomainGrid(graph);
+   HYPRE_Int               nparts      = hypre_SStructGraphNParts(graph);
+   hypre_SStructPGrid    **pgrids      = hypre_SStructGraphPGrids(graph);
+   hypre_SStructStencil ***stencils    = hypre_SStructGraphStencils(graph);
+   HYPRE_Int               nUventries  = hypre_SStructGraphNUVEntries(graph);
+   HYPRE_Int              *iUventries  = hypre_SStructGraphIUVEntries(graph);
+   hypre_SStructUVEntry  **Uventries   = hypre_SStructGraphUVEntries(graph);
+   HYPRE_BigInt            rowstart    = hypre_SStructGridStartRank(grid);
+   HYPRE_Int               nrows       = hypre_SStructGridLocalSize(grid);
+   HYPRE_BigInt           *col_part    = hypre_IJMatrixColPartitioning(ijmatrix);
+   HYPRE_BigInt            col_0       = col_part[0];
+   HYPRE_BigInt            col_n       = col_part[1] - 1;
+
+   hypre_ParCSRMatrix     *par_matrix;
+   hypre_AuxParCSRMatrix  *aux_matrix;
+   hypre_CSRMatrix        *diag, *offd;
+   HYPRE_Int              *diag_i, *diag_j, *offd_i;
+   HYPRE_BigInt           *big_offd_j = NULL;
+   HYPRE_Int               diag_nnz;
+
+   hypre_SStructStencil   *stencil;
+   HYPRE_Int              *vars;
+   hypre_Index            *shape;
+   hypre_IndexRef          offset;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *row_box, *to_box, *row_map_box, *to_map_box, *int_box;
+   hypre_BoxManEntry     **boxman_entries, **boxman_to_entries;
+   HYPRE_Int               nboxman_entries, nboxman_to_entries;
+   hypre_SStructBoxManInfo *to_info;
+   hypre_Index             rstart, stride, loop_size, cs;
+   HYPRE_BigInt            row_base, col_base;
+
+   HYPRE_Int               size, nvars, part, var, entry, b, ii, jj, mi, r;
+   HYPRE_Int               myid;
+   HYPRE_BigInt           *cols;
+   HYPRE_Int              *row_uv;
+   HYPRE_Int              *diag_sizes, *offd_sizes;
+   HYPRE_Int              *fill_map;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* fill map row stride */
+   size = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(pgrids[part]);
+      for (var = 0; var < nvars; var++)
+      {
+         size = hypre_max(size, hypre_SStructStencilSize(stencils[part][var]));
+      }
+   }
+
+   /*------------------------------------------
+    * Column of each (local row, stencil entry)
+    *------------------------------------------*/
+
+   cols = hypre_TAlloc(HYPRE_BigInt, nrows * size, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(mi) HYPRE_SMP_SCHEDULE
+#endif
+   for (mi = 0; mi < nrows * size; mi++)
+   {
+      cols[mi] = -1;
+   }
+
+   row_box     = hypre_BoxCreate(ndim);
+   to_box      = hypre_BoxCreate(ndim);
+   row_map_box = hypre_BoxCreate(ndim);
+   to_map_box  = hypre_BoxCreate(ndim);
+   int_box     = hypre_BoxCreate(ndim);
+   hypre_SetIndex(stride, 1);
+
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(pgrids[part]);
+      for (var = 0; var < nvars; var++)
+      {
+         stencil = stencils[part][var];
+         vars    = hypre_SStructStencilVars(stencil);
+         shape   = hypre_SStructStencilShape(stencil);
+         boxes   = hypre_StructGridBoxes(hypre_SStructPGridSGrid(pgrids[part], var));
+
+         hypre_ForBoxI(b, boxes)
+         {
+            hypre_SStructGridIntersect(grid, part, var, hypre_BoxArrayBox(boxes, b), 0,
+                                       &boxman_entries, &nboxman_entries);
+
+            for (ii = 0; ii < nboxman_entries; ii++)
+            {
+               if (hypre_BoxManEntryProc(boxman_entries[ii]) != myid)
+               {
+                  continue;
+               }
+
+               /* local rows are numbered lexicographically within row_map_box */
+               hypre_BoxManEntryGetExtents(boxman_entries[ii], hypre_BoxIMin(row_map_box),
+                                           hypre_BoxIMax(row_map_box));
+               hypre_IntersectBoxes(hypre_BoxArrayBox(boxes, b), row_map_box, row_box);
+               hypre_SStructBoxManEntryGetGlobalRank(boxman_entries[ii],
+                                                     hypre_BoxIMin(row_map_box),
+                                                     &row_base, HYPRE_PARCSR);
+               row_base -= rowstart;
+
+               for (entry = 0; entry < hypre_SStructStencilSize(stencil); entry++)
+               {
+                  hypre_CopyBox(row_box, to_box);
+                  offset = shape[entry];
+                  hypre_BoxShiftPos(to_box, offset);
+
+                  hypre_SStructGridIntersect(dom_grid, part, vars[entry], to_box, -1,
+                                             &boxman_to_entries, &nboxman_to_entries);
+
+                  for (jj = 0; jj < nboxman_to_entries; jj++)
+                  {
+                     hypre_BoxManEntryGetExtents(boxman_to_entries[jj],
+                                                 hypre_BoxIMin(to_map_box),
+                                                 hypre_BoxIMax(to_map_box));
+                     hypre_IntersectBoxes(to_box, to_map_box, int_box);
+                     hypre_SubtractIndexes(hypre_BoxIMin(int_box), offset, ndim, rstart);
+                     hypre_BoxGetSize(int_box, loop_size);
+
+                     hypre_BoxManEntryGetInfo(boxman_to_entries[jj], (void **) &to_info);
+                     if (hypre_SStructBoxManInfoType(to_info) == hypre_SSTRUCT_BOXMAN_INFO_DEFAULT)
+                     {
+                        /* columns are also numbered lexicographically */
+                        hypre_SStructBoxManEntryGetGlobalRank(boxman_to_entries[jj],
+                                                              hypre_BoxIMin(to_map_box),
+                                                              &col_base, HYPRE_PARCSR);
+
+                        zypre_BoxLoop2Begin(ndim, loop_size,
+                                            row_map_box, rstart, stride, ri,
+                                            to_map_box, hypre_BoxIMin(int_box), stride, ci);
+#ifdef HYPRE_USING_OPENMP
+                        #pragma omp parallel for private(HYPRE_BOX_PRIVATE,ri,ci) HYPRE_SMP_SCHEDULE
+#endif
+                        zypre_BoxLoop2For(ri, ci)
+                        {
+                           cols[(row_base + ri) * size + entry] = col_base + ci;
+                        }
+                        zypre_BoxLoop2End(ri, ci);
+                     }
+                     else
+                     {
+                        /* neighbor entries may be permuted, so use their strides */
+                        hypre_SStructBoxManEntryGetStrides(boxman_to_entries[jj], cs,
+                                                           HYPRE_PARCSR);
+                        hypre_SStructBoxManEntryGetGlobalRank(boxman_to_entries[jj],
+                                                              hypre_BoxIMin(int_box),
+                                                              &col_base, HYPRE_PARCSR);
+
+                        zypre_BoxLoop1Begin(ndim, loop_size, row_map_box, rstart, stride, ri);
+#ifdef HYPRE_USING_OPENMP
+                        #pragma omp parallel for private(HYPRE_BOX_PRIVATE,ri) HYPRE_SMP_SCHEDULE
+#endif
+                        zypre_BoxLoop1For(ri)
+                        {
+                           hypre_Index  lindex;
+                           HYPRE_BigInt col = col_base;
+                           HYPRE_Int    d;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           cols[(row_base + ri) * size + entry] = col;
+                        }
+                        zypre_BoxLoop1End(ri);
+                     }
+                  }
+
+                  hypre_TFree(boxman_to_entries, HYPRE_MEMORY_HOST);
+               }
+            }
+
+            hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
+         }
+      }
+   }
+
+   hypre_BoxDestroy(row_box);
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(row_map_box);
+   hypre_BoxDestroy(to_map_box);
+   hypre_BoxDestroy(int_box);
+
+   /* non-stencil entry of each local row (there is at most one per row) */
+   row_uv = hypre_TAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   for (r = 0; r < nrows; r++)
+   {
+      row_uv[r] = -1;
+   }
+   for (entry = 0; entry < nUventries; entry++)
+   {
+      mi = iUventries[entry];
+      r  = (HYPRE_Int)(hypre_SStructUVEntryRank(Uventries[mi]) - rowstart);
+      if ((r > -1) && (r < nrows))
+      {
+         row_uv[r] = mi;
+      }
+   }
+
+   /*------------------------------------------
+    * Exact diag and offd row sizes.  For now, the fill map holds the first
+    * stencil entry with the same column (or -1 if there is no column).
+    *------------------------------------------*/
+
+   fill_map   = hypre_TAlloc(HYPRE_Int, nrows * size, HYPRE_MEMORY_HOST);
+   diag_sizes = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+   offd_sizes = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nrows; r++)
+   {
+      HYPRE_BigInt         *rcols = &cols[r * size];
+      HYPRE_Int            *rmap  = &fill_map[r * size];
+      hypre_SStructUVEntry *Uventry;
+      HYPRE_Int             k, k1, u, u1;
+      HYPRE_BigInt          col;
+
+      for (k = 0; k < size; k++)
+      {
+         col = rcols[k];
+         if (col < 0)
+         {
+            rmap[k] = -1;
+            continue;
+         }
+         for (k1 = 0; rcols[k1] != col; k1++);
+         rmap[k] = k1;
+         if (k1 == k)
+         {
+            if (col < col_0 || col > col_n)
+            {
+               offd_sizes[r]++;
+            }
+            else
+            {
+               diag_sizes[r]++;
+            }
+         }
+      }
+
+      if (row_uv[r] > -1)
+      {
+         Uventry = Uventries[row_uv[r]];
+         for (u = 0; u < hypre_SStructUVEntryNUEntries(Uventry); u++)
+         {
+            col = hypre_SStructUVEntryToRank(Uventry, u);
+            for (k = 0; k < size; k++)
+            {
+               if (rcols[k] == col)
+               {
+                  break;
+               }
+            }
+            for (u1 = 0; u1 < u; u1++)
+            {
+               if (hypre_SStructUVEntryToRank(Uventry, u1) == col)
+               {
+                  break;
+               }
+            }
+            if ((k == size) && (u1 == u))
+            {
+               if (col < col_0 || col > col_n)
+               {
+                  offd_sizes[r]++;
+               }
+               else
+               {
+                  diag_sizes[r]++;
+               }
+            }
+         }
+      }
+   }
+
+   HYPRE_IJMatrixSetDiagOffdSizes(ijmatrix, (const HYPRE_Int *) diag_sizes,
+                                  (const HYPRE_Int *) offd_sizes);
    HYPRE_IJMatrixInitialize(ijmatrix);
 
+   hypre_TFree(diag_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_sizes, HYPRE_MEMORY_HOST);
+
+   /*------------------------------------------
+    * Column indices and data positions
+    *------------------------------------------*/
+
+   par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix);
+   aux_matrix = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(ijmatrix);
+   diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   diag_i     = hypre_CSRMatrixI(diag);
+   diag_j     = hypre_CSRMatrixJ(diag);
+   offd_i     = hypre_CSRMatrixI(offd);
+   diag_nnz   = diag_i[nrows];
+   if (offd_i[nrows])
+   {
+      big_offd_j = hypre_CSRMatrixBigJ(offd);
+      if (!big_offd_j)
+      {
+         big_offd_j = hypre_CTAlloc(HYPRE_BigInt, offd_i[nrows],
+                                    hypre_CSRMatrixMemoryLocation(offd));
+         hypre_CSRMatrixBigJ(offd) = big_offd_j;
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nrows; r++)
+   {
+      HYPRE_BigInt         *rcols = &cols[r * size];
+      HYPRE_Int            *rmap  = &fill_map[r * size];
+      hypre_SStructUVEntry *Uventry;
+      HYPRE_Int             cnt_diag = diag_i[r];
+      HYPRE_Int             cnt_offd = offd_i[r];
+      HYPRE_Int             k, kd, u, j;
+      HYPRE_BigInt          col;
+
+      /* diagonal first */
+      for (kd = 0; kd < size; kd++)
+      {
+         if ((rmap[kd] == kd) && (rcols[kd] - col_0 == r) && (rcols[kd] <= col_n))
+         {
+            diag_j[cnt_diag] = r;
+            rmap[kd] = cnt_diag++;
+            break;
+         }
+      }
+
+      /* the first entry of each column gets a new position, and the others
+         copy it (their first entry comes earlier, so it is already mapped) */
+      for (k = 0; k < size; k++)
+      {
+         col = rcols[k];
+         if ((k == kd) || (rmap[k] < 0))
+         {
+            continue;
+         }
+         else if (rmap[k] < k)
+         {
+            rmap[k] = rmap[rmap[k]];
+         }
+         else if (col < col_0 || col > col_n)
+         {
+            big_offd_j[cnt_offd] = col;
+            rmap[k] = diag_nnz + cnt_offd++;
+         }
+         else
+         {
+            diag_j[cnt_diag] = (HYPRE_Int)(col - col_0);
+            rmap[k] = cnt_diag++;
+         }
+      }
+
+      /* non-stencil columns */
+      if (row_uv[r] > -1)
+      {
+         Uventry = Uventries[row_uv[r]];
+         for (u = 0; u < hypre_SStructUVEntryNUEntries(Uventry); u++)
+         {
+            col = hypre_SStructUVEntryToRank(Uventry, u);
+            if (col < col_0 || col > col_n)
+            {
+               for (j = offd_i[r]; (j < cnt_offd) && (big_offd_j[j] != col); j++);
+               if (j == cnt_offd)
+               {
+                  big_offd_j[cnt_offd++] = col;
+               }
+            }
+            else
+            {
+               for (j = diag_i[r]; (j < cnt_diag) && (diag_j[j] != (HYPRE_Int)(col - col_0)); j++);
+               if (j == cnt_diag)
+               {
+                  diag_j[cnt_diag++] = (HYPRE_Int)(col - col_0);
+               }
+            }
+         }
+      }
+
+      hypre_AuxParCSRMatrixIndxDiag(aux_matrix)[r] = cnt_diag;
+      hypre_AuxParCSRMatrixIndxOffd(aux_matrix)[r] = cnt_offd;
+   }
+
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_uv, HYPRE_MEMORY_HOST);
+
+   hypre_SStructMatrixUFillSize(matrix) = size;
+   hypre_SStructMatrixUFillMap(matrix)  = fill_map;
+
    return hypre_error_flag;
 }
 
@@ -1039,6 +1497,11 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
    HYPRE_BigInt          row_base, col_base;
    HYPRE_Int             ei, entry, ii, jj;
    HYPRE_Int             matrix_type = hypre_SStructMatrixObjectType(matrix);
+   HYPRE_Int            *fill_map    = hypre_SStructMatrixUFillMap(matrix);
+   hypre_SStructBoxManInfo *entry_info;
+   HYPRE_Int             myid;
+
+   hypre_MPI_Comm_rank(hypre_SStructMatrixComm(matrix), &myid);
 
    box  = hypre_BoxCreate(ndim);
 
@@ -1074,6 +1537,20 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
          hypre_IntersectBoxes(box, map_box, int_box);
          hypre_CopyBox(int_box, box);
 
+         /* Local rows of a directly filled matrix */
+         if ((fill_map != NULL) && (action > -1) &&
+             (hypre_BoxManEntryProc(boxman_entries[ii]) == myid))
+         {
+            hypre_BoxManEntryGetInfo(boxman_entries[ii], (void **) &entry_info);
+            if (hypre_SStructBoxManInfoType(entry_info) == hypre_SSTRUCT_BOXMAN_INFO_DEFAULT)
+            {
+               hypre_SStructUMatrixSetBoxValuesFill(matrix, boxman_entries[ii], box,
+                                                    nentries, entries,
+                                                    value_box, values, action);
+               continue;
+            }
+         }
+
          /* For each index in 'box', compute a row of length <= nentries and
           * insert it into an nentries-length segment of 'cols' and 'ijvalues'.
           * This may result in gaps, but IJSetValues2() is designed for that. */
@@ -1263,6 +1740,89 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Sets or adds stencil coefficients for the rows of 'box' directly in the diag
+ * and offd data arrays, using the fill map computed in InitializeFill.  The
+ * box must lie in a local (non-neighbor) box manager entry.
+ *
+ * (action > 0): add-to values
+ * (action = 0): set values
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructUMatrixSetBoxValuesFill( hypre_SStructMatrix *matrix,
+                                      hypre_BoxManEntry   *boxman_entry,
+                                      hypre_Box           *box,
+                                      HYPRE_Int            nentries,
+                                      HYPRE_Int           *entries,
+                                      hypre_Box           *value_box,
+                                      HYPRE_Complex       *values,
+                                      HYPRE_Int            action )
+{
+   HYPRE_Int             ndim       = hypre_SStructMatrixNDim(matrix);
+   HYPRE_IJMatrix        ijmatrix   = hypre_SStructMatrixIJMatrix(matrix);
+   hypre_SStructGraph   *graph      = hypre_SStructMatrixGraph(matrix);
+   HYPRE_BigInt          rowstart   = hypre_SStructGridStartRank(hypre_SStructGraphGrid(graph));
+   HYPRE_Int             size       = hypre_SStructMatrixUFillSize(matrix);
+   HYPRE_Int            *fill_map   = hypre_SStructMatrixUFillMap(matrix);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   HYPRE_Complex        *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex        *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int             diag_nnz   = hypre_CSRMatrixNumNonzeros(diag);
+   hypre_Box            *map_box;
+   hypre_Index           stride, loop_size;
+   hypre_IndexRef        start;
+   HYPRE_BigInt          row_base;
+   HYPRE_Int             ei, entry;
+
+   /* rows of a default box manager entry are numbered lexicographically */
+   map_box = hypre_BoxCreate(ndim);
+   hypre_BoxManEntryGetExtents(boxman_entry, hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+   hypre_SStructBoxManEntryGetGlobalRank(boxman_entry, hypre_BoxIMin(map_box),
+                                         &row_base, HYPRE_PARCSR);
+   row_base -= rowstart;
+
+   hypre_SetIndex(stride, 1);
+   start = hypre_BoxIMin(box);
+   hypre_BoxGetSize(box, loop_size);
+
+   for (ei = 0; ei < nentries; ei++)
+   {
+      entry = entries[ei];
+
+      zypre_BoxLoop2Begin(ndim, loop_size,
+                          map_box, start, stride, ri,
+                          value_box, start, stride, vi);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(HYPRE_BOX_PRIVATE,ri,vi) HYPRE_SMP_SCHEDULE
+#endif
+      zypre_BoxLoop2For(ri, vi)
+      {
+         HYPRE_Int      pos = fill_map[(row_base + ri) * size + entry];
+         HYPRE_Complex *coeff;
+
+         if (pos > -1)
+         {
+            coeff = (pos < diag_nnz) ? &diag_data[pos] : &offd_data[pos - diag_nnz];
+            if (action > 0)
+            {
+               *coeff += values[ei + vi * nentries];
+            }
+            else
+            {
+               *coeff = values[ei + vi * nentries];
+            }
+         }
+      }
+      zypre_BoxLoop2End(ri, vi);
+   }
+
+   hypre_BoxDestroy(map_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1271,6 +1831,9 @@ hypre_SStructUMatrixAssemble( hypre_SStructMatrix *matrix )
 {
    HYPRE_IJMatrix ijmatrix = hypre_SStructMatrixIJMatrix(matrix);
 
+   /* the fill map is only used until the IJ matrix is assembled */
+   hypre_TFree(hypre_SStructMatrixUFillMap(matrix), HYPRE_MEMORY_HOST);
+
    HYPRE_IJMatrixAssemble(ijmatrix);
    HYPRE_IJMatrixGetObject(
       ijmatrix, (void **) &hypre_SStructMatrixParCSRMatrix(matrix));
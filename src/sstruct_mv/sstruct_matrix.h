@@ -58,6 +58,11 @@ typedef struct hypre_SStructMatrix_struct
    HYPRE_IJMatrix          ijmatrix;
    hypre_ParCSRMatrix     *parcsrmatrix;
 
+   /* direct fill of HYPRE_PARCSR U-matrices (NULL map if not used) */
+   HYPRE_Int               ufill_size;   /* row stride of ufill_map */
+   HYPRE_Int              *ufill_map;    /* diag/offd data position of each
+                                          * (local row, stencil entry) */
+
    /* temporary storage for SetValues routines */
    HYPRE_Int               entries_size;
    HYPRE_Int              *Sentries;
@@ -96,6 +101,8 @@ typedef struct hypre_SStructMatrix_struct
 #define hypre_SStructMatrixSymmetric(mat)            ((mat) -> symmetric)
 #define hypre_SStructMatrixIJMatrix(mat)             ((mat) -> ijmatrix)
 #define hypre_SStructMatrixParCSRMatrix(mat)         ((mat) -> parcsrmatrix)
+#define hypre_SStructMatrixUFillSize(mat)            ((mat) -> ufill_size)
+#define hypre_SStructMatrixUFillMap(mat)             ((mat) -> ufill_map)
 #define hypre_SStructMatrixEntriesSize(mat)          ((mat) -> entries_size)
 #define hypre_SStructMatrixSEntries(mat)             ((mat) -> Sentries)
 #define hypre_SStructMatrixUEntries(mat)             ((mat) -> Uentries)
@@ -614,6 +614,14 @@ hypre_SStructVectorParConvert( hypre_SStructVector  *vector,
 
    parvector = hypre_SStructVectorParVector(vector);
    pardata = hypre_VectorData(hypre_ParVectorLocalVector(parvector));
+
+   /* nothing to copy if the parvector uses the data chunk */
+   if (pardata == hypre_SStructVectorData(vector))
+   {
+      *parvector_ptr = parvector;
+      return hypre_error_flag;
+   }
+
    pari = 0;
    nparts = hypre_SStructVectorNParts(vector);
    for (part = 0; part < nparts; part++)
@@ -700,6 +708,13 @@ hypre_SStructVectorParRestore( hypre_SStructVector *vector,
 
       parvector = hypre_SStructVectorParVector(vector);
       pardata = hypre_VectorData(hypre_ParVectorLocalVector(parvector));
+
+      /* nothing to copy if the parvector uses the data chunk */
+      if (pardata == hypre_SStructVectorData(vector))
+      {
+         return hypre_error_flag;
+      }
+
       pari = 0;
       nparts = hypre_SStructVectorNParts(vector);
       for (part = 0; part < nparts; part++)
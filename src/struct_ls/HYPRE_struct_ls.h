@@ -265,6 +265,8 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Zebra line Gauss-Seidel (symmetric: lines along the direction of
+ *          strongest coupling, chosen on each level)
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -328,6 +330,28 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Fuse relaxation sweeps by temporal blocking.  With \e tb_depth
+ * greater than 1, the pre- and post-relaxation sweeps (see
+ * \ref HYPRE_StructPFMGSetNumPreRelax and \ref HYPRE_StructPFMGSetNumPostRelax)
+ * are done in groups of up to \e tb_depth sweeps: a halo of \e tb_depth cells
+ * (2 \e tb_depth for red-black Gauss-Seidel) is exchanged once per group, and
+ * the sweeps of a group are done tile by tile while the tile is in cache.  The
+ * results are the same as without temporal blocking.
+ *
+ * This is used for (weighted) Jacobi and red-black relaxation of matrices with
+ * variable coefficients and stencils that reach the nearest neighbors only, on
+ * the host.  The depth is reduced on levels where the halo would reach past
+ * the neighbor information of the grid.  It keeps a copy of the matrix with the
+ * wider halo on each level, and it pays off only when the relaxation is limited
+ * by memory bandwidth.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int          tb_depth);
+
+HYPRE_Int HYPRE_StructPFMGGetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int *tb_depth);
+
 /*
  * RE-VISIT
  **/
@@ -39,6 +39,11 @@ hypre_StructMatrix *hypre_CycRedCreateCoarseOp ( hypre_StructMatrix *A,
                                                  hypre_StructGrid *coarse_grid, HYPRE_Int cdir );
 HYPRE_Int hypre_CycRedSetupCoarseOp ( hypre_StructMatrix *A, hypre_StructMatrix *Ac,
                                       hypre_Index cindex, hypre_Index cstride, HYPRE_Int cdir );
+HYPRE_Int hypre_CycRedLinesAreLocal ( hypre_StructGrid *grid, HYPRE_Int cdir,
+                                      hypre_Index base_stride );
+HYPRE_Int hypre_CycRedSolveLines ( HYPRE_Int num_lines, HYPRE_Int n, HYPRE_Complex *lower,
+                                   HYPRE_Complex *diag, HYPRE_Complex *upper, HYPRE_Complex *rhs,
+                                   HYPRE_Complex *work );
 HYPRE_Int hypre_CyclicReductionSetup ( void *cyc_red_vdata, hypre_StructMatrix *A,
                                        hypre_StructVector *b, hypre_StructVector *x );
 HYPRE_Int hypre_CyclicReduction ( void *cyc_red_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
@@ -231,6 +236,8 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata, HYPRE_Int num_post_relax
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata, HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata, HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata, HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetTemporalBlocking ( void *pfmg_vdata, HYPRE_Int tb_depth );
+HYPRE_Int hypre_PFMGGetTemporalBlocking ( void *pfmg_vdata, HYPRE_Int *tb_depth );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata, HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata, HYPRE_Int *logging );
@@ -256,6 +263,35 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata, HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata, HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata, hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetTemporalBlocking ( void *pfmg_relax_vdata, HYPRE_Int tb_depth );
+
+/* pfmg_tb_relax.c */
+void *hypre_PFMGTBRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_PFMGTBRelaxDestroy ( void *tb_vdata );
+HYPRE_Int hypre_PFMGTBRelaxSetup ( void *tb_vdata, hypre_StructMatrix *A, HYPRE_Int relax_type,
+                                   HYPRE_Int depth );
+HYPRE_Int hypre_PFMGTBRelaxDepth ( void *tb_vdata );
+HYPRE_Int hypre_PFMGTBRelax ( void *tb_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                              hypre_StructVector *x, HYPRE_Int max_iter, HYPRE_Int zero_guess, HYPRE_Real weight,
+                              HYPRE_Int rb_start );
+
+/* pfmg_line_relax.c */
+void *hypre_PFMGLineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_PFMGLineRelaxDestroy ( void *line_vdata );
+HYPRE_Int hypre_PFMGLineRelaxSetup ( void *line_vdata, hypre_StructMatrix *A,
+                                     hypre_StructVector *x );
+HYPRE_Int hypre_PFMGLineRelaxDirection ( void *line_vdata );
+HYPRE_Int hypre_PFMGLineRelax ( void *line_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                                hypre_StructVector *x, hypre_StructVector *t, HYPRE_Int max_iter,
+                                HYPRE_Int zero_guess, HYPRE_Int start_color );
+
+/* pfmg_mf_relax.c */
+void *hypre_PFMGMFRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_PFMGMFRelaxDestroy ( void *mf_vdata );
+HYPRE_Int hypre_PFMGMFRelaxSetup ( void *mf_vdata, hypre_StructMatrix *A, hypre_StructVector *x );
+HYPRE_Int hypre_PFMGMFRelax ( void *mf_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
+                              hypre_StructVector *x, hypre_StructVector *t, HYPRE_Int relax_type, HYPRE_Int max_iter,
+                              HYPRE_Int zero_guess, HYPRE_Real weight, HYPRE_Int rb_start );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata, hypre_StructMatrix *A, hypre_StructVector *b,
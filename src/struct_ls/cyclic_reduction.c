@@ -8,6 +8,11 @@
 /******************************************************************************
  * Cyclic reduction algorithm (coded as if it were a 1D MG method)
  *
+ * When every line in the coarsening direction lies within a single box, the
+ * lines are instead solved locally with no communication: the lines of a box
+ * are gathered in batches into structure-of-arrays form, and all lines of a
+ * batch are solved at once by hypre_CycRedSolveLines.
+ *
  *****************************************************************************/
 
 #include "_hypre_struct_ls.h"
@@ -15,6 +20,9 @@
 
 #define DEBUG 0
 
+/* number of lines solved together in the batched (local) solve */
+#define HYPRE_CYCRED_BATCH 16
+
 /*--------------------------------------------------------------------------
  * Macros
  *--------------------------------------------------------------------------*/
@@ -74,6 +82,12 @@ typedef struct
    hypre_ComputePkg    **down_compute_pkg_l;
    hypre_ComputePkg    **up_compute_pkg_l;
 
+   HYPRE_Int             batched;      /* solve the lines locally */
+   HYPRE_Int             max_lines;    /* max lines in a box */
+   HYPRE_Int             max_length;   /* max line length */
+   HYPRE_Int            *line_starts;  /* A, x and b ranks of each line */
+   HYPRE_Complex        *work;         /* per-thread batch arrays */
+
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
@@ -457,6 +471,287 @@ hypre_CycRedSetupCoarseOp( hypre_StructMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CycRedLinesAreLocal
+ *
+ * Returns 1 if every line of the grid in direction cdir lies within a single
+ * box on all processes, so that the lines can be solved without
+ * communication.  This is checked by intersecting the layers just beyond
+ * both ends of each box in direction cdir with the boxes of the grid.  The
+ * lines are not local for periodic grids (periodic images of a line are kept
+ * consistent by the communication), for strided lines, or for device data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedLinesAreLocal( hypre_StructGrid *grid,
+                           HYPRE_Int         cdir,
+                           hypre_Index       base_stride )
+{
+   hypre_BoxManager   *boxman = hypre_StructGridBoxMan(grid);
+   hypre_BoxArray     *boxes  = hypre_StructGridBoxes(grid);
+   hypre_Box          *box;
+   hypre_Box          *layer;
+   hypre_BoxManEntry **entries;
+   HYPRE_Int           num_entries;
+   HYPRE_Int           local, global, i, side;
+
+   local = 1;
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   local = 0;
+#endif
+   if (hypre_IndexD(base_stride, cdir) != 1 ||
+       hypre_StructGridNumPeriods(grid) > 1)
+   {
+      local = 0;
+   }
+
+   layer = hypre_BoxCreate(hypre_StructGridNDim(grid));
+   hypre_ForBoxI(i, boxes)
+   {
+      if (!local)
+      {
+         break;
+      }
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+      for (side = 0; side < 2; side++)
+      {
+         hypre_CopyBox(box, layer);
+         if (side == 0)
+         {
+            hypre_BoxIMinD(layer, cdir) = hypre_BoxIMinD(box, cdir) - 1;
+            hypre_BoxIMaxD(layer, cdir) = hypre_BoxIMinD(box, cdir) - 1;
+         }
+         else
+         {
+            hypre_BoxIMinD(layer, cdir) = hypre_BoxIMaxD(box, cdir) + 1;
+            hypre_BoxIMaxD(layer, cdir) = hypre_BoxIMaxD(box, cdir) + 1;
+         }
+         hypre_BoxManIntersect(boxman, hypre_BoxIMin(layer), hypre_BoxIMax(layer),
+                               &entries, &num_entries);
+         hypre_TFree(entries, HYPRE_MEMORY_HOST);
+         if (num_entries > 0)
+         {
+            local = 0;
+         }
+      }
+   }
+   hypre_BoxDestroy(layer);
+
+   hypre_MPI_Allreduce(&local, &global, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_StructGridComm(grid));
+
+   return global;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveLines
+ *
+ * Solves num_lines independent tridiagonal systems of size n stored in
+ * structure-of-arrays form: row m of line k is at [m*num_lines + k], so the
+ * inner loops run across the lines with unit stride.  The lower coefficient
+ * of the first row and the upper coefficient of the last row are ignored.
+ * The solution overwrites rhs, and work must hold n*num_lines values.  As in
+ * the coarsest-level solve of hypre_CyclicReduction, a zero pivot (from a
+ * singular line) gives a zero solution value.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CycRedSolveLines( HYPRE_Int      num_lines,
+                        HYPRE_Int      n,
+                        HYPRE_Complex *lower,
+                        HYPRE_Complex *diag,
+                        HYPRE_Complex *upper,
+                        HYPRE_Complex *rhs,
+                        HYPRE_Complex *work )
+{
+   HYPRE_Complex  *cp = work;
+   HYPRE_Complex   den, inv;
+   HYPRE_Int       k, m, mk;
+
+   /* forward elimination */
+   for (k = 0; k < num_lines; k++)
+   {
+      den    = diag[k];
+      inv    = (den != 0.0) ? 1.0 / den : 0.0;
+      cp[k]  = upper[k] * inv;
+      rhs[k] = rhs[k] * inv;
+   }
+   for (m = 1; m < n; m++)
+   {
+      for (k = 0; k < num_lines; k++)
+      {
+         mk      = m * num_lines + k;
+         den     = diag[mk] - lower[mk] * cp[mk - num_lines];
+         inv     = (den != 0.0) ? 1.0 / den : 0.0;
+         cp[mk]  = upper[mk] * inv;
+         rhs[mk] = (rhs[mk] - lower[mk] * rhs[mk - num_lines]) * inv;
+      }
+   }
+
+   /* back substitution */
+   for (m = n - 2; m >= 0; m--)
+   {
+      for (k = 0; k < num_lines; k++)
+      {
+         mk       = m * num_lines + k;
+         rhs[mk] -= cp[mk] * rhs[mk + num_lines];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CycRedSolveBatched
+ *
+ * Solves all lines of the base points locally.  The coupling to the points
+ * just beyond both ends of a line (domain boundary ghost zones) is moved to
+ * the right-hand side with the current values of x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CycRedSolveBatched( hypre_CyclicReductionData *cyc_red_data,
+                          hypre_StructMatrix        *A,
+                          hypre_StructVector        *b,
+                          hypre_StructVector        *x )
+{
+   HYPRE_Int             ndim        = hypre_StructVectorNDim(x);
+   HYPRE_Int             cdir        = (cyc_red_data -> cdir);
+   hypre_IndexRef        base_stride = (cyc_red_data -> base_stride);
+   hypre_BoxArray       *base_points = (cyc_red_data -> base_points);
+   HYPRE_Int            *line_starts = (cyc_red_data -> line_starts);
+   hypre_StructStencil  *stencil     = hypre_StructMatrixStencil(A);
+
+   hypre_Box            *compute_box;
+   hypre_Box            *A_dbox, *x_dbox, *b_dbox;
+   HYPRE_Complex        *Ap[3];
+   HYPRE_Int             Ainc[3];
+   HYPRE_Complex        *xp, *bp;
+   HYPRE_Complex         zero = 0.0;
+   hypre_Index           index, unit, loop_size;
+   HYPRE_Int             sA, sx, sb, n, num_lines, num_batches, batch;
+   HYPRE_Int             fi, j, rank;
+
+   hypre_SetIndex(unit, 0);
+   hypre_IndexD(unit, cdir) = 1;
+
+   hypre_ForBoxI(fi, base_points)
+   {
+      compute_box = hypre_BoxArrayBox(base_points, fi);
+      if (hypre_BoxVolume(compute_box) == 0)
+      {
+         continue;
+      }
+
+      A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), fi);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), fi);
+      xp = hypre_StructVectorBoxData(x, fi);
+      bp = hypre_StructVectorBoxData(b, fi);
+
+      /* lower, diagonal and upper coefficients; a missing or constant entry
+         is read at a fixed location */
+      for (j = 0; j < 3; j++)
+      {
+         hypre_SetIndex(index, 0);
+         hypre_IndexD(index, cdir) = j - 1;
+         rank = hypre_StructStencilElementRank(stencil, index);
+         if (rank < 0)
+         {
+            Ap[j]   = &zero;
+            Ainc[j] = 0;
+         }
+         else
+         {
+            Ap[j]   = hypre_StructMatrixBoxData(A, fi, rank);
+            Ainc[j] = (hypre_StructMatrixEntryType(A, rank) != HYPRE_STRUCT_ENTRY_CONSTANT);
+         }
+      }
+
+      n  = hypre_BoxSizeD(compute_box, cdir);
+      sA = hypre_BoxOffsetDistance(A_dbox, unit);
+      sx = hypre_BoxOffsetDistance(x_dbox, unit);
+      sb = hypre_BoxOffsetDistance(b_dbox, unit);
+
+      /* first point of each line */
+      hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+      hypre_IndexD(loop_size, cdir) = 1;
+      num_lines = 0;
+      hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                A_dbox, hypre_BoxIMin(compute_box), base_stride, Ai,
+                                x_dbox, hypre_BoxIMin(compute_box), base_stride, xi);
+      {
+         line_starts[3 * num_lines]     = Ai;
+         line_starts[3 * num_lines + 1] = xi;
+         num_lines++;
+      }
+      hypre_SerialBoxLoop2End(Ai, xi);
+      num_lines = 0;
+      hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                b_dbox, hypre_BoxIMin(compute_box), base_stride, bi);
+      {
+         line_starts[3 * num_lines + 2] = bi;
+         num_lines++;
+      }
+      hypre_SerialBoxLoop1End(bi);
+      num_batches = (num_lines + HYPRE_CYCRED_BATCH - 1) / HYPRE_CYCRED_BATCH;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(batch) HYPRE_SMP_SCHEDULE
+#endif
+      for (batch = 0; batch < num_batches; batch++)
+      {
+         HYPRE_Int      *starts = &line_starts[3 * batch * HYPRE_CYCRED_BATCH];
+         HYPRE_Int       nl     = hypre_min(HYPRE_CYCRED_BATCH,
+                                            num_lines - batch * HYPRE_CYCRED_BATCH);
+         HYPRE_Complex  *lo     = (cyc_red_data -> work) + hypre_GetThreadNum() * 5 *
+                                  HYPRE_CYCRED_BATCH * (cyc_red_data -> max_length);
+         HYPRE_Complex  *di     = lo + nl * n;
+         HYPRE_Complex  *up     = di + nl * n;
+         HYPRE_Complex  *rhs    = up + nl * n;
+         HYPRE_Int       k, m, mk, Ai, bi, xi;
+
+         /* gather into structure-of-arrays form */
+         for (k = 0; k < nl; k++)
+         {
+            Ai = starts[3 * k];
+            bi = starts[3 * k + 2];
+            for (m = 0; m < n; m++)
+            {
+               mk      = m * nl + k;
+               lo[mk]  = Ap[0][Ainc[0] * (Ai + m * sA)];
+               di[mk]  = Ap[1][Ainc[1] * (Ai + m * sA)];
+               up[mk]  = Ap[2][Ainc[2] * (Ai + m * sA)];
+               rhs[mk] = bp[bi + m * sb];
+            }
+         }
+         for (k = 0; k < nl; k++)
+         {
+            xi = starts[3 * k + 1];
+            rhs[k] -= lo[k] * xp[xi - sx];
+            rhs[(n - 1) * nl + k] -= up[(n - 1) * nl + k] * xp[xi + n * sx];
+         }
+
+         hypre_CycRedSolveLines(nl, n, lo, di, up, rhs, rhs + nl * n);
+
+         /* scatter the solution */
+         for (m = 0; m < n; m++)
+         {
+            for (k = 0; k < nl; k++)
+            {
+               xp[starts[3 * k + 1] + m * sx] = rhs[m * nl + k];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CyclicReductionSetup
  *--------------------------------------------------------------------------*/
@@ -496,8 +791,9 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    hypre_StructGrid       *grid;
 
    hypre_Box              *cbox;
+   hypre_Box              *box;
 
-   HYPRE_Int               l;
+   HYPRE_Int               l, i, n, num_lines;
    HYPRE_Int               flop_divisor;
 
    HYPRE_Int               x_num_ghost[] = {0, 0, 0, 0, 0, 0};
@@ -519,6 +815,13 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
       max_levels = (cyc_red_data -> max_levels);
    }
 
+   /* no coarse levels are needed when the lines are solved locally */
+   (cyc_red_data -> batched) = hypre_CycRedLinesAreLocal(grid, cdir, base_stride);
+   if (cyc_red_data -> batched)
+   {
+      max_levels = 1;
+   }
+
 
    grid_l    = hypre_TAlloc(hypre_StructGrid *,  num_levels, HYPRE_MEMORY_HOST);
    hypre_StructGridRef(grid, &grid_l[0]);
@@ -571,6 +874,34 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    (cyc_red_data -> base_points) = base_points;
 
+   /*-----------------------------------------------------
+    * Set up work space for the batched line solves
+    *-----------------------------------------------------*/
+
+   if (cyc_red_data -> batched)
+   {
+      (cyc_red_data -> max_lines)  = 0;
+      (cyc_red_data -> max_length) = 0;
+      hypre_ForBoxI(i, base_points)
+      {
+         box = hypre_BoxArrayBox(base_points, i);
+         n = hypre_BoxSizeD(box, cdir);
+         if (hypre_BoxVolume(box) == 0)
+         {
+            continue;
+         }
+         hypre_BoxGetStrideVolume(box, base_stride, &num_lines);
+         (cyc_red_data -> max_lines)  = hypre_max((cyc_red_data -> max_lines), num_lines / n);
+         (cyc_red_data -> max_length) = hypre_max((cyc_red_data -> max_length), n);
+      }
+      (cyc_red_data -> line_starts) = hypre_TAlloc(HYPRE_Int, 3 * (cyc_red_data -> max_lines),
+                                                   HYPRE_MEMORY_HOST);
+      (cyc_red_data -> work) = hypre_TAlloc(HYPRE_Complex,
+                                            hypre_NumThreads() * 5 * HYPRE_CYCRED_BATCH *
+                                            (cyc_red_data -> max_length),
+                                            HYPRE_MEMORY_HOST);
+   }
+
    /*-----------------------------------------------------
     * Set up fine points
     *-----------------------------------------------------*/
@@ -727,6 +1058,12 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
          hypre_StructVectorGlobalSize(x_l[l]) / 2;
    }
 
+   if (cyc_red_data -> batched)
+   {
+      (cyc_red_data -> solve_flops) =
+         8 * hypre_StructVectorGlobalSize(x_l[0]) / (HYPRE_BigInt)flop_divisor;
+   }
+
 
    /*-----------------------------------------------------
     * Finalize some things
@@ -823,6 +1160,16 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
    A_l[0] = hypre_StructMatrixRef(A);
    x_l[0] = hypre_StructVectorRef(x);
 
+   if (cyc_red_data -> batched)
+   {
+      hypre_CycRedSolveBatched(cyc_red_data, A, b, x);
+
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------
     * Copy b into x
     *--------------------------------------------------*/
@@ -1233,6 +1580,8 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
       hypre_TFree(cyc_red_data -> x_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> down_compute_pkg_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> up_compute_pkg_l, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> line_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(cyc_red_data -> work, HYPRE_MEMORY_HOST);
 
       hypre_FinalizeTiming(cyc_red_data -> time_index);
       hypre_TFree(cyc_red_data, HYPRE_MEMORY_HOST);
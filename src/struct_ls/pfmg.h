@@ -36,6 +36,7 @@ typedef struct
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
    HYPRE_Int             num_post_relax; /* number of post relaxation sweeps */
    HYPRE_Int             skip_relax;     /* flag to allow skipping relaxation */
+   HYPRE_Int             tb_depth;       /* relaxation sweeps per halo exchange */
    HYPRE_Real            relax_weight;
    HYPRE_Real            dxyz[3];     /* parameters used to determine cdir */
 
@@ -0,0 +1,654 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Zebra line Gauss-Seidel relaxation for PFMG
+ *
+ * The grid is split into lines along the direction of strongest coupling
+ * 'ldir', and the lines are colored by the parity of the sum of their other
+ * coordinates (alternating lines in 2D, a checkerboard of lines in 3D).  For
+ * each color, the ghost layers of x are updated, then every line of that color
+ * is solved exactly, with the coupling to all other lines moved to the
+ * right-hand side:
+ *
+ *   A_lower x(m-1) + A_diag x(m) + A_upper x(m+1) = b(m) - sum_other A_s x(m+s)
+ *
+ * The right-hand sides of all lines of a color are computed into the
+ * temporary vector t before any line is solved, so that lines of the same
+ * color (coupled only by 19- and 27-point stencils) are relaxed Jacobi-style,
+ * independently of the order in which they are solved.
+ *
+ * When every line lies within a single box, the tridiagonal systems of a batch
+ * of lines are gathered into structure-of-arrays form and solved at once by
+ * hypre_CycRedSolveLines, the line solver of the cyclic reduction code.
+ * Otherwise (lines split across boxes or processes, or periodic in 'ldir'),
+ * the lines of a color are solved together by hypre_CyclicReduction, which
+ * couples the pieces of a line across box and process boundaries.  Its base
+ * points must form a strided index space, so in that case the lines are
+ * colored by the parity of each of their other coordinates (2^(ndim-1)
+ * colors) instead.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+typedef struct
+{
+   HYPRE_Int               ldir;         /* line direction, -1 if not set up */
+   HYPRE_Int               diag_rank;
+   HYPRE_Int               lower_rank;   /* entry -e_ldir, or -1 */
+   HYPRE_Int               upper_rank;   /* entry +e_ldir, or -1 */
+   HYPRE_Int               num_offl;     /* number of entries off the line */
+   HYPRE_Int              *offl;
+
+   hypre_CommPkg          *comm_pkg;     /* ghost layers of x */
+
+   HYPRE_Int               num_colors;
+   HYPRE_Int               cut;          /* lines cross box boundaries */
+   hypre_StructMatrix     *A_line;       /* entries of A on the line */
+   void                  **cyc_red_data; /* line solves of each color */
+
+   HYPRE_Int               max_lines;    /* max lines of one color in a box */
+   HYPRE_Int               max_length;   /* max line length */
+   HYPRE_Int              *line_starts;  /* x, A, b and t ranks of each line */
+   HYPRE_Complex          *work;         /* per-thread batch arrays */
+
+} hypre_PFMGLineRelaxData;
+
+/* number of lines solved together by hypre_CycRedSolveLines */
+#define HYPRE_PFMG_LINE_BATCH 32
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PFMGLineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_PFMGLineRelaxData *line_data;
+
+   line_data = hypre_CTAlloc(hypre_PFMGLineRelaxData, 1, HYPRE_MEMORY_HOST);
+   (line_data -> ldir) = -1;
+
+   return (void *) line_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGLineRelaxFree( hypre_PFMGLineRelaxData *line_data )
+{
+   HYPRE_Int  color;
+
+   if (line_data -> cyc_red_data)
+   {
+      for (color = 0; color < (line_data -> num_colors); color++)
+      {
+         hypre_CyclicReductionDestroy((line_data -> cyc_red_data)[color]);
+      }
+      hypre_TFree(line_data -> cyc_red_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_StructMatrixDestroy(line_data -> A_line);
+   hypre_TFree(line_data -> offl, HYPRE_MEMORY_HOST);
+   hypre_CommPkgDestroy(line_data -> comm_pkg);
+   hypre_TFree(line_data -> line_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(line_data -> work, HYPRE_MEMORY_HOST);
+
+   (line_data -> comm_pkg) = NULL;
+   (line_data -> A_line)   = NULL;
+   (line_data -> ldir)     = -1;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelaxDestroy( void *line_vdata )
+{
+   hypre_PFMGLineRelaxData *line_data = (hypre_PFMGLineRelaxData *)line_vdata;
+
+   if (line_data)
+   {
+      hypre_PFMGLineRelaxFree(line_data);
+      hypre_TFree(line_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGLineRelaxSetup
+ *
+ * Chooses the line direction as the one with the largest sum of absolute
+ * nearest-neighbor coefficients over the global grid, and sets up cyclic
+ * reduction for each color if the lines are not local to the boxes.  Line
+ * relaxation is not set up (and hypre_PFMGLineRelaxDirection returns -1) for
+ * device data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelaxSetup( void               *line_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_StructVector *x )
+{
+   hypre_PFMGLineRelaxData *line_data = (hypre_PFMGLineRelaxData *)line_vdata;
+
+   MPI_Comm               comm          = hypre_StructMatrixComm(A);
+   hypre_StructGrid      *grid          = hypre_StructMatrixGrid(A);
+   HYPRE_Int              ndim          = hypre_StructGridNDim(grid);
+   hypre_BoxArray        *boxes         = hypre_StructGridBoxes(grid);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_CommInfo        *comm_info;
+   hypre_Box             *box;
+   hypre_Box             *A_dbox;
+   HYPRE_Complex         *Ap;
+   HYPRE_Real             coupling[HYPRE_MAXDIM], global_coupling[HYPRE_MAXDIM];
+   hypre_Index            loop_size, unit_stride, index, base_stride;
+   HYPRE_Int              line_ranks[3];
+   HYPRE_Int              ldir, i, j, k, d, si, dir, num_lines, color;
+
+   hypre_PFMGLineRelaxFree(line_data);
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_error_flag;
+#endif
+
+   /*-----------------------------------------------------------------------
+    * Line direction
+    *-----------------------------------------------------------------------*/
+
+   for (d = 0; d < HYPRE_MAXDIM; d++)
+   {
+      coupling[d] = 0.0;
+   }
+   hypre_SetIndex(unit_stride, 1);
+   for (si = 0; si < stencil_size; si++)
+   {
+      /* nearest-neighbor entries only */
+      dir = -1;
+      k = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_IndexD(stencil_shape[si], d) != 0)
+         {
+            dir = d;
+            k += hypre_abs(hypre_IndexD(stencil_shape[si], d));
+         }
+      }
+      if (k != 1)
+      {
+         continue;
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box    = hypre_BoxArrayBox(boxes, i);
+         A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         Ap     = hypre_StructMatrixBoxData(A, i, si);
+
+         if (hypre_StructMatrixEntryType(A, si) == HYPRE_STRUCT_ENTRY_CONSTANT)
+         {
+            coupling[dir] += hypre_cabs(Ap[0]) * hypre_BoxVolume(box);
+         }
+         else
+         {
+            HYPRE_Real  sum = 0.0;
+
+            hypre_BoxGetSize(box, loop_size);
+            hypre_SerialBoxLoop1Begin(ndim, loop_size,
+                                      A_dbox, hypre_BoxIMin(box), unit_stride, Ai);
+            {
+               sum += hypre_cabs(Ap[Ai]);
+            }
+            hypre_SerialBoxLoop1End(Ai);
+            coupling[dir] += sum;
+         }
+      }
+   }
+   hypre_MPI_Allreduce(coupling, global_coupling, ndim, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   ldir = 0;
+   for (d = 1; d < ndim; d++)
+   {
+      if (global_coupling[d] > global_coupling[ldir])
+      {
+         ldir = d;
+      }
+   }
+   (line_data -> ldir) = ldir;
+
+   /*-----------------------------------------------------------------------
+    * Stencil entries on and off the line
+    *-----------------------------------------------------------------------*/
+
+   hypre_SetIndex(index, 0);
+   (line_data -> diag_rank) = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, ldir) = -1;
+   (line_data -> lower_rank) = hypre_StructStencilElementRank(stencil, index);
+   hypre_IndexD(index, ldir) = 1;
+   (line_data -> upper_rank) = hypre_StructStencilElementRank(stencil, index);
+
+   (line_data -> offl) = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != (line_data -> diag_rank)  &&
+          si != (line_data -> lower_rank) &&
+          si != (line_data -> upper_rank))
+      {
+         (line_data -> offl)[k++] = si;
+      }
+   }
+   (line_data -> num_offl) = k;
+
+   /*-----------------------------------------------------------------------
+    * Cyclic reduction for lines that cross box boundaries, on the strided
+    * base points of each color
+    *-----------------------------------------------------------------------*/
+
+   (line_data -> cut) = !hypre_CycRedLinesAreLocal(grid, ldir, unit_stride);
+   (line_data -> num_colors) = 2;
+   if (line_data -> cut)
+   {
+      k = 0;
+      line_ranks[k++] = (line_data -> diag_rank);
+      if ((line_data -> lower_rank) >= 0)
+      {
+         line_ranks[k++] = (line_data -> lower_rank);
+      }
+      if ((line_data -> upper_rank) >= 0)
+      {
+         line_ranks[k++] = (line_data -> upper_rank);
+      }
+      (line_data -> A_line) = hypre_StructMatrixCreateMask(A, k, line_ranks);
+
+      (line_data -> num_colors)   = 1 << (ndim - 1);
+      (line_data -> cyc_red_data) = hypre_TAlloc(void *, (line_data -> num_colors),
+                                                 HYPRE_MEMORY_HOST);
+      for (color = 0; color < (line_data -> num_colors); color++)
+      {
+         hypre_SetIndex(index, 0);
+         hypre_SetIndex(base_stride, 1);
+         j = 0;
+         for (d = 0; d < ndim; d++)
+         {
+            if (d != ldir)
+            {
+               hypre_IndexD(index, d)       = (color >> j++) & 1;
+               hypre_IndexD(base_stride, d) = 2;
+            }
+         }
+         (line_data -> cyc_red_data)[color] = hypre_CyclicReductionCreate(comm);
+         hypre_CyclicReductionSetCDir((line_data -> cyc_red_data)[color], ldir);
+         hypre_CyclicReductionSetBase((line_data -> cyc_red_data)[color], index, base_stride);
+         hypre_CyclicReductionSetup((line_data -> cyc_red_data)[color],
+                                    (line_data -> A_line), x, x);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Ghost layer update of x and work space
+    *-----------------------------------------------------------------------*/
+
+   hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(x), hypre_StructVectorDataSpace(x),
+                       1, NULL, 0, comm, &(line_data -> comm_pkg));
+   hypre_CommInfoDestroy(comm_info);
+
+   (line_data -> max_lines)  = 0;
+   (line_data -> max_length) = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+      num_lines = hypre_BoxVolume(box) / hypre_BoxSizeD(box, ldir);
+      (line_data -> max_lines)  = hypre_max((line_data -> max_lines), (num_lines + 1) / 2);
+      (line_data -> max_length) = hypre_max((line_data -> max_length),
+                                            hypre_BoxSizeD(box, ldir));
+   }
+   (line_data -> line_starts) = hypre_TAlloc(HYPRE_Int, 4 * (line_data -> max_lines),
+                                             HYPRE_MEMORY_HOST);
+   (line_data -> work) = hypre_TAlloc(HYPRE_Complex,
+                                      hypre_NumThreads() * 5 * HYPRE_PFMG_LINE_BATCH *
+                                      (line_data -> max_length),
+                                      HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelaxDirection( void *line_vdata )
+{
+   hypre_PFMGLineRelaxData *line_data = (hypre_PFMGLineRelaxData *)line_vdata;
+
+   return (line_data -> ldir);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGLineRelaxRHS
+ *
+ * Computes t = b - (couplings off the line) x on num_lines lines of box b.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGLineRelaxRHS( hypre_PFMGLineRelaxData *line_data,
+                        hypre_StructMatrix      *A,
+                        hypre_StructVector      *b,
+                        hypre_StructVector      *x,
+                        hypre_StructVector      *t,
+                        HYPRE_Int                bi,
+                        HYPRE_Int               *line_starts,
+                        HYPRE_Int                num_lines,
+                        HYPRE_Int                n,
+                        HYPRE_Int                sA,
+                        HYPRE_Int                sx,
+                        HYPRE_Int                sb,
+                        HYPRE_Int                st )
+{
+   HYPRE_Int              num_offl      = (line_data -> num_offl);
+   HYPRE_Int             *offl          = (line_data -> offl);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+   hypre_Box             *x_dbox        = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), bi);
+   HYPRE_Complex         *xp            = hypre_StructVectorBoxData(x, bi);
+   HYPRE_Complex         *bp            = hypre_StructVectorBoxData(b, bi);
+   HYPRE_Complex         *tp            = hypre_StructVectorBoxData(t, bi);
+
+   HYPRE_Complex         *Ap, *xl, *tl;
+   HYPRE_Int              k, m, e, Al, var;
+   HYPRE_Int              xoff;
+
+   for (k = 0; k < num_lines; k++)
+   {
+      xl = xp + line_starts[4 * k];
+      tl = tp + line_starts[4 * k + 3];
+      Al = line_starts[4 * k + 1];
+
+      for (m = 0; m < n; m++)
+      {
+         tl[m * st] = bp[line_starts[4 * k + 2] + m * sb];
+      }
+      for (e = 0; e < num_offl; e++)
+      {
+         Ap   = hypre_StructMatrixBoxData(A, bi, offl[e]);
+         var  = (hypre_StructMatrixEntryType(A, offl[e]) != HYPRE_STRUCT_ENTRY_CONSTANT);
+         xoff = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offl[e]]);
+         if (var)
+         {
+            for (m = 0; m < n; m++)
+            {
+               tl[m * st] -= Ap[Al + m * sA] * xl[m * sx + xoff];
+            }
+         }
+         else
+         {
+            for (m = 0; m < n; m++)
+            {
+               tl[m * st] -= Ap[0] * xl[m * sx + xoff];
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGLineRelaxSolve
+ *
+ * Solves the tridiagonal systems of num_lines (at most HYPRE_PFMG_LINE_BATCH)
+ * lines of box b at once.  The right-hand sides are in t, and the values of x
+ * just beyond both ends of each line are used as boundary values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGLineRelaxSolve( hypre_PFMGLineRelaxData *line_data,
+                          hypre_StructMatrix      *A,
+                          hypre_StructVector      *x,
+                          hypre_StructVector      *t,
+                          HYPRE_Int                bi,
+                          HYPRE_Int               *line_starts,
+                          HYPRE_Int                num_lines,
+                          HYPRE_Int                n,
+                          HYPRE_Int                sA,
+                          HYPRE_Int                sx,
+                          HYPRE_Int                st,
+                          HYPRE_Complex           *work )
+{
+   HYPRE_Int              ranks[3];
+   HYPRE_Complex         *Ap[3];
+   HYPRE_Int              Ainc[3];
+   HYPRE_Complex          zero = 0.0;
+   HYPRE_Complex         *xp  = hypre_StructVectorBoxData(x, bi);
+   HYPRE_Complex         *tp  = hypre_StructVectorBoxData(t, bi);
+   HYPRE_Complex         *lo  = work;
+   HYPRE_Complex         *di  = lo + num_lines * n;
+   HYPRE_Complex         *up  = di + num_lines * n;
+   HYPRE_Complex         *rhs = up + num_lines * n;
+   HYPRE_Int              j, k, m, mk, Ai, xi;
+
+   /* lower, diagonal and upper coefficients; a missing or constant entry is
+      read at a fixed location */
+   ranks[0] = (line_data -> lower_rank);
+   ranks[1] = (line_data -> diag_rank);
+   ranks[2] = (line_data -> upper_rank);
+   for (j = 0; j < 3; j++)
+   {
+      if (ranks[j] < 0)
+      {
+         Ap[j]   = &zero;
+         Ainc[j] = 0;
+      }
+      else
+      {
+         Ap[j]   = hypre_StructMatrixBoxData(A, bi, ranks[j]);
+         Ainc[j] = (hypre_StructMatrixEntryType(A, ranks[j]) != HYPRE_STRUCT_ENTRY_CONSTANT);
+      }
+   }
+
+   /* gather into structure-of-arrays form, with the values of x beyond the
+      ends on the right */
+   for (m = 0; m < n; m++)
+   {
+      for (k = 0; k < num_lines; k++)
+      {
+         mk  = m * num_lines + k;
+         Ai  = line_starts[4 * k + 1] + m * sA;
+         lo[mk]  = Ap[0][Ainc[0] * Ai];
+         di[mk]  = Ap[1][Ainc[1] * Ai];
+         up[mk]  = Ap[2][Ainc[2] * Ai];
+         rhs[mk] = tp[line_starts[4 * k + 3] + m * st];
+      }
+   }
+   for (k = 0; k < num_lines; k++)
+   {
+      xi = line_starts[4 * k];
+      rhs[k] -= lo[k] * xp[xi - sx];
+      rhs[(n - 1) * num_lines + k] -= up[(n - 1) * num_lines + k] * xp[xi + n * sx];
+   }
+
+   hypre_CycRedSolveLines(num_lines, n, lo, di, up, rhs, rhs + num_lines * n);
+
+   /* scatter the solution */
+   for (m = 0; m < n; m++)
+   {
+      for (k = 0; k < num_lines; k++)
+      {
+         xp[line_starts[4 * k] + m * sx] = rhs[m * num_lines + k];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGLineRelax
+ *
+ * Does max_iter sweeps of zebra line Gauss-Seidel, each relaxing the lines of
+ * every color in increasing order (or in decreasing order if start_color is
+ * 1).  The temporary vector t must be on the grid of x.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGLineRelax( void               *line_vdata,
+                     hypre_StructMatrix *A,
+                     hypre_StructVector *b,
+                     hypre_StructVector *x,
+                     hypre_StructVector *t,
+                     HYPRE_Int           max_iter,
+                     HYPRE_Int           zero_guess,
+                     HYPRE_Int           start_color )
+{
+   hypre_PFMGLineRelaxData *line_data = (hypre_PFMGLineRelaxData *)line_vdata;
+
+   HYPRE_Int              ldir        = (line_data -> ldir);
+   HYPRE_Int              num_colors  = (line_data -> num_colors);
+   HYPRE_Int              cut         = (line_data -> cut);
+   HYPRE_Int             *line_starts = (line_data -> line_starts);
+   HYPRE_Int              ndim        = hypre_StructVectorNDim(x);
+   hypre_BoxArray        *boxes       = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *A_dbox, *x_dbox, *b_dbox, *t_dbox;
+   hypre_Index            unit, index, plane_size;
+   HYPRE_Int              sA, sx, sb, st;
+   HYPRE_Int              iter, c, color, i, d, j, l, k, n, num_lines, parity, num_batches;
+   HYPRE_Int              batch;
+
+   if (max_iter == 0)
+   {
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+      return hypre_error_flag;
+   }
+
+   if (zero_guess)
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+   }
+
+   hypre_SetIndex(unit, 0);
+   hypre_IndexD(unit, ldir) = 1;
+   hypre_SetIndex(index, 0);
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      for (c = 0; c < num_colors; c++)
+      {
+         color = start_color ? (num_colors - 1 - c) : c;
+
+         hypre_InitializeCommunication(line_data -> comm_pkg,
+                                       hypre_StructVectorData(x), hypre_StructVectorData(x),
+                                       0, 0, &comm_handle);
+         hypre_FinalizeCommunication(comm_handle);
+
+         hypre_ForBoxI(i, boxes)
+         {
+            box = hypre_BoxArrayBox(boxes, i);
+            if (hypre_BoxVolume(box) == 0)
+            {
+               continue;
+            }
+            A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+            b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+            t_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+
+            n  = hypre_BoxSizeD(box, ldir);
+            sA = hypre_BoxOffsetDistance(A_dbox, unit);
+            sx = hypre_BoxOffsetDistance(x_dbox, unit);
+            sb = hypre_BoxOffsetDistance(b_dbox, unit);
+            st = hypre_BoxOffsetDistance(t_dbox, unit);
+
+            /* first point of each line of this color */
+            hypre_BoxGetSize(box, plane_size);
+            hypre_IndexD(plane_size, ldir) = 1;
+            num_lines = 0;
+            for (l = 0; l < hypre_BoxVolume(box) / n; l++)
+            {
+               k = l;
+               j = 0;
+               parity = 0;
+               for (d = 0; d < ndim; d++)
+               {
+                  hypre_IndexD(index, d) = hypre_BoxIMinD(box, d) + k % hypre_IndexD(plane_size, d);
+                  k /= hypre_IndexD(plane_size, d);
+                  if (d != ldir)
+                  {
+                     if (cut)
+                     {
+                        parity += ((hypre_IndexD(index, d) % 2 + 2) % 2) << j++;
+                     }
+                     else
+                     {
+                        parity += hypre_IndexD(index, d);
+                     }
+                  }
+               }
+               if ((cut ? parity : ((parity % 2) + 2) % 2) != color)
+               {
+                  continue;
+               }
+               line_starts[4 * num_lines]     = hypre_BoxIndexRank(x_dbox, index);
+               line_starts[4 * num_lines + 1] = hypre_BoxIndexRank(A_dbox, index);
+               line_starts[4 * num_lines + 2] = hypre_BoxIndexRank(b_dbox, index);
+               line_starts[4 * num_lines + 3] = hypre_BoxIndexRank(t_dbox, index);
+               num_lines++;
+            }
+            num_batches = (num_lines + HYPRE_PFMG_LINE_BATCH - 1) / HYPRE_PFMG_LINE_BATCH;
+
+            /* all right-hand sides of this color first, then the solves */
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(batch) HYPRE_SMP_SCHEDULE
+#endif
+            for (batch = 0; batch < num_batches; batch++)
+            {
+               hypre_PFMGLineRelaxRHS(line_data, A, b, x, t, i,
+                                      &line_starts[4 * batch * HYPRE_PFMG_LINE_BATCH],
+                                      hypre_min(HYPRE_PFMG_LINE_BATCH,
+                                                num_lines - batch * HYPRE_PFMG_LINE_BATCH),
+                                      n, sA, sx, sb, st);
+            }
+            if (cut)
+            {
+               continue;
+            }
+#ifdef HYPRE_USING_OPENMP
+            #pragma omp parallel for private(batch) HYPRE_SMP_SCHEDULE
+#endif
+            for (batch = 0; batch < num_batches; batch++)
+            {
+               hypre_PFMGLineRelaxSolve(line_data, A, x, t, i,
+                                        &line_starts[4 * batch * HYPRE_PFMG_LINE_BATCH],
+                                        hypre_min(HYPRE_PFMG_LINE_BATCH,
+                                                  num_lines - batch * HYPRE_PFMG_LINE_BATCH),
+                                        n, sA, sx, st,
+                                        (line_data -> work) + hypre_GetThreadNum() * 5 *
+                                        HYPRE_PFMG_LINE_BATCH * (line_data -> max_length));
+            }
+         }
+
+         /* lines that cross box boundaries are solved together */
+         if (cut)
+         {
+            hypre_CyclicReduction((line_data -> cyc_red_data)[color],
+                                  (line_data -> A_line), t, x);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,410 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * PFMG relaxation with a matrix-free matrix
+ *
+ * The coefficients of a matrix-free matrix (see HYPRE_StructMatrixSetCoeffFunction)
+ * are evaluated one grid row at a time into a small per-thread buffer, and the
+ * row is relaxed right away.  Weighted Jacobi and red/black Gauss-Seidel are
+ * supported, with the same update order as hypre_PointRelax and
+ * hypre_RedBlackGS.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+typedef struct
+{
+   hypre_ComputePkg       *compute_pkg;
+   HYPRE_Int               diag_rank;
+
+} hypre_PFMGMFRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PFMGMFRelaxCreate( MPI_Comm  comm )
+{
+   hypre_PFMGMFRelaxData *mf_data;
+
+   mf_data = hypre_CTAlloc(hypre_PFMGMFRelaxData, 1, HYPRE_MEMORY_HOST);
+   (mf_data -> compute_pkg) = NULL;
+   (mf_data -> diag_rank)   = -1;
+
+   return (void *) mf_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGMFRelaxDestroy( void *mf_vdata )
+{
+   hypre_PFMGMFRelaxData *mf_data = (hypre_PFMGMFRelaxData *)mf_vdata;
+
+   if (mf_data)
+   {
+      hypre_ComputePkgDestroy(mf_data -> compute_pkg);
+      hypre_TFree(mf_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGMFRelaxSetup( void               *mf_vdata,
+                        hypre_StructMatrix *A,
+                        hypre_StructVector *x )
+{
+   hypre_PFMGMFRelaxData *mf_data = (hypre_PFMGMFRelaxData *)mf_vdata;
+   hypre_StructGrid      *grid    = hypre_StructMatrixGrid(A);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(A);
+   hypre_ComputeInfo     *compute_info;
+   hypre_Index            diag_index;
+
+   hypre_ComputePkgDestroy(mf_data -> compute_pkg);
+   (mf_data -> compute_pkg) = NULL;
+
+   hypre_SetIndex3(diag_index, 0, 0, 0);
+   (mf_data -> diag_rank) = hypre_StructStencilElementRank(stencil, diag_index);
+   if ((mf_data -> diag_rank) < 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The stencil has no diagonal entry");
+      return hypre_error_flag;
+   }
+
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
+                          grid, &(mf_data -> compute_pkg));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Relaxes the points of the boxes in compute_box_aa.  With rb < 0 this is a
+ * Jacobi step that writes the new iterate to t; otherwise only the points
+ * whose coordinates add up to rb (mod 2) are updated, in place in x.  With
+ * zero set, the off-diagonal terms are skipped (x is taken to be zero).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGMFRelaxBoxes( hypre_StructMatrix  *A,
+                        hypre_StructVector  *b,
+                        hypre_StructVector  *x,
+                        hypre_StructVector  *t,
+                        hypre_BoxArrayArray *compute_box_aa,
+                        HYPRE_Int            diag_rank,
+                        HYPRE_Int            rb,
+                        HYPRE_Int            zero )
+{
+   HYPRE_Int                    ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil         *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index                 *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_StructMatrixCoeffFcn   coeff_fcn     = hypre_StructMatrixCoeffFcn(A);
+   void                        *coeff_data    = hypre_StructMatrixCoeffData(A);
+   HYPRE_Int                    num_threads   = hypre_NumThreads();
+
+   hypre_BoxArray              *compute_box_a;
+   hypre_Box                   *compute_box;
+   hypre_Box                   *b_data_box;
+   hypre_Box                   *x_data_box;
+   hypre_Box                   *t_data_box = NULL;
+   HYPRE_Complex               *bp, *xp, *tp = NULL, *buffer;
+   HYPRE_Int                   *xoff;
+   hypre_Index                  loop_size, start;
+   HYPRE_Int                    i, j, si, n, r, num_rows, buffer_size;
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      bp = hypre_StructVectorBoxData(b, i);
+      xp = hypre_StructVectorBoxData(x, i);
+      if (rb < 0)
+      {
+         t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+         tp = hypre_StructVectorBoxData(t, i);
+      }
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_SetIndex(loop_size, 1);
+         hypre_BoxGetSize(compute_box, loop_size);
+         hypre_CopyToCleanIndex(hypre_BoxIMin(compute_box), ndim, start);
+         n           = loop_size[0];
+         num_rows    = loop_size[1] * loop_size[2];
+         buffer_size = (stencil_size + 1) * n;
+         buffer      = hypre_TAlloc(HYPRE_Complex, buffer_size * num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = 0; r < num_rows; r++)
+         {
+            HYPRE_Complex *values = buffer + hypre_GetThreadNum() * buffer_size;
+            HYPRE_Complex *sum    = values + stencil_size * n;
+            HYPRE_Complex *vp, *dp, *xsp;
+            hypre_Index    index;
+            HYPRE_Int      bi, xi, ti, s, ii, i0, di;
+
+            hypre_CopyIndex(start, index);
+            index[1] += r % loop_size[1];
+            index[2] += r / loop_size[1];
+            coeff_fcn(coeff_data, index, n, values);
+
+            bi = hypre_BoxIndexRank(b_data_box, index);
+            xi = hypre_BoxIndexRank(x_data_box, index);
+            dp = values + diag_rank * n;
+
+            if (rb < 0)
+            {
+               /* Jacobi: all points of the row, result in t */
+               ti = hypre_BoxIndexRank(t_data_box, index);
+               for (ii = 0; ii < n; ii++)
+               {
+                  sum[ii] = bp[bi + ii];
+               }
+               if (!zero)
+               {
+                  for (s = 0; s < stencil_size; s++)
+                  {
+                     if (s != diag_rank)
+                     {
+                        vp  = values + s * n;
+                        xsp = xp + xi + xoff[s];
+                        for (ii = 0; ii < n; ii++)
+                        {
+                           sum[ii] -= vp[ii] * xsp[ii];
+                        }
+                     }
+                  }
+               }
+               for (ii = 0; ii < n; ii++)
+               {
+                  tp[ti + ii] = sum[ii] / dp[ii];
+               }
+            }
+            else
+            {
+               /* red/black: every other point of the row, in place */
+               i0 = 0;
+               for (di = 0; di < ndim; di++)
+               {
+                  i0 += index[di];
+               }
+               i0 = hypre_abs(i0 + rb) % 2;
+               for (ii = i0; ii < n; ii += 2)
+               {
+                  HYPRE_Complex v = bp[bi + ii];
+
+                  if (!zero)
+                  {
+                     for (s = 0; s < stencil_size; s++)
+                     {
+                        if (s != diag_rank)
+                        {
+                           v -= values[s * n + ii] * xp[xi + ii + xoff[s]];
+                        }
+                     }
+                  }
+                  xp[xi + ii] = v / dp[ii];
+               }
+            }
+         }
+
+         hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets x = weight * t + (1 - weight) * x on the grid, or x = weight * t if
+ * zero is set.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGMFRelaxUpdate( hypre_StructVector *x,
+                         hypre_StructVector *t,
+                         HYPRE_Real          weight,
+                         HYPRE_Int           zero )
+{
+   HYPRE_Int          ndim  = hypre_StructVectorNDim(x);
+   hypre_BoxArray    *boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   HYPRE_Real         weightc = zero ? 0.0 : (1.0 - weight);
+   hypre_Box         *box, *x_data_box, *t_data_box;
+   HYPRE_Complex     *xp, *tp;
+   hypre_Index        loop_size, start;
+   HYPRE_Int          i, r, n, num_rows;
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box        = hypre_BoxArrayBox(boxes, i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+      xp         = hypre_StructVectorBoxData(x, i);
+      tp         = hypre_StructVectorBoxData(t, i);
+
+      hypre_SetIndex(loop_size, 1);
+      hypre_BoxGetSize(box, loop_size);
+      hypre_CopyToCleanIndex(hypre_BoxIMin(box), ndim, start);
+      n        = loop_size[0];
+      num_rows = loop_size[1] * loop_size[2];
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+      for (r = 0; r < num_rows; r++)
+      {
+         hypre_Index  index;
+         HYPRE_Int    xi, ti, ii;
+
+         hypre_CopyIndex(start, index);
+         index[1] += r % loop_size[1];
+         index[2] += r / loop_size[1];
+         xi = hypre_BoxIndexRank(x_data_box, index);
+         ti = hypre_BoxIndexRank(t_data_box, index);
+
+         if (weight == 1.0)
+         {
+            for (ii = 0; ii < n; ii++)
+            {
+               xp[xi + ii] = tp[ti + ii];
+            }
+         }
+         else if (zero)
+         {
+            for (ii = 0; ii < n; ii++)
+            {
+               xp[xi + ii] = weight * tp[ti + ii];
+            }
+         }
+         else
+         {
+            for (ii = 0; ii < n; ii++)
+            {
+               xp[xi + ii] = weight * tp[ti + ii] + weightc * xp[xi + ii];
+            }
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Does max_iter sweeps of weighted Jacobi (relax_type 0/1, using the temporary
+ * vector t) or red/black Gauss-Seidel (relax_type 2/3, starting with color
+ * rb_start) with the matrix-free matrix A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGMFRelax( void               *mf_vdata,
+                   hypre_StructMatrix *A,
+                   hypre_StructVector *b,
+                   hypre_StructVector *x,
+                   hypre_StructVector *t,
+                   HYPRE_Int           relax_type,
+                   HYPRE_Int           max_iter,
+                   HYPRE_Int           zero_guess,
+                   HYPRE_Real          weight,
+                   HYPRE_Int           rb_start )
+{
+   hypre_PFMGMFRelaxData *mf_data     = (hypre_PFMGMFRelaxData *)mf_vdata;
+   hypre_ComputePkg      *compute_pkg = (mf_data -> compute_pkg);
+   HYPRE_Int              diag_rank   = (mf_data -> diag_rank);
+   HYPRE_Int              redblack    = (relax_type == 2 || relax_type == 3);
+
+   hypre_BoxArrayArray   *compute_box_aa;
+   hypre_CommHandle      *comm_handle;
+   HYPRE_Int              iter, half, num_half, rb, zero, compute_i;
+
+   if (compute_pkg == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free relaxation is not set up");
+      return hypre_error_flag;
+   }
+
+   if (max_iter == 0)
+   {
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+      return hypre_error_flag;
+   }
+
+   num_half = redblack ? 2 : 1;
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      for (half = 0; half < num_half; half++)
+      {
+         rb   = redblack ? ((rb_start + half) % 2) : -1;
+         zero = (zero_guess && iter == 0 && half == 0);
+
+         for (compute_i = 0; compute_i < 2; compute_i++)
+         {
+            switch (compute_i)
+            {
+               case 0:
+               {
+                  if (!zero)
+                  {
+                     hypre_InitializeIndtComputations(compute_pkg, hypre_StructVectorData(x),
+                                                      &comm_handle);
+                  }
+                  compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+               }
+               break;
+
+               case 1:
+               {
+                  if (!zero)
+                  {
+                     hypre_FinalizeIndtComputations(comm_handle);
+                  }
+                  compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+               }
+               break;
+            }
+
+            hypre_PFMGMFRelaxBoxes(A, b, x, t, compute_box_aa, diag_rank, rb, zero);
+         }
+
+         if (!redblack)
+         {
+            hypre_PFMGMFRelaxUpdate(x, t, weight, zero);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -14,8 +14,16 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *tb_relax_data;
+   void                   *mf_relax_data;
+   void                   *line_relax_data;
+   hypre_StructVector     *t;             /* Jacobi temp vector */
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
+   HYPRE_Int               tb_depth;      /* sweeps per halo exchange */
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Int               rb_start;
 
 } hypre_PFMGRelaxData;
 
@@ -30,8 +38,15 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> tb_relax_data) = hypre_PFMGTBRelaxCreate(comm);
+   (pfmg_relax_data -> mf_relax_data) = hypre_PFMGMFRelaxCreate(comm);
+   (pfmg_relax_data -> line_relax_data) = hypre_PFMGLineRelaxCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> tb_depth) = 0;
+   (pfmg_relax_data -> max_iter) = 1;
+   (pfmg_relax_data -> zero_guess) = 0;
+   (pfmg_relax_data -> rb_start) = 1;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +63,10 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_PFMGTBRelaxDestroy(pfmg_relax_data -> tb_relax_data);
+      hypre_PFMGMFRelaxDestroy(pfmg_relax_data -> mf_relax_data);
+      hypre_PFMGLineRelaxDestroy(pfmg_relax_data -> line_relax_data);
+      hypre_StructVectorDestroy(pfmg_relax_data -> t);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -66,6 +85,32 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
    HYPRE_Int    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Int    max_iter = (pfmg_relax_data -> max_iter);
+   HYPRE_Real   weight;
+
+   /* coefficients evaluated on the fly (line relaxation is replaced by
+      red/black Gauss-Seidel) */
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      weight = (relax_type == 1) ? (pfmg_relax_data -> jacobi_weight) : 1.0;
+      hypre_PFMGMFRelax((pfmg_relax_data -> mf_relax_data), A, b, x,
+                        (pfmg_relax_data -> t), (relax_type == 4) ? 2 : relax_type, max_iter,
+                        (pfmg_relax_data -> zero_guess), weight,
+                        (pfmg_relax_data -> rb_start));
+
+      return hypre_error_flag;
+   }
+
+   /* several sweeps per halo exchange */
+   if (max_iter > 1 && hypre_PFMGTBRelaxDepth(pfmg_relax_data -> tb_relax_data) > 1)
+   {
+      weight = (relax_type == 1) ? (pfmg_relax_data -> jacobi_weight) : 1.0;
+      hypre_PFMGTBRelax((pfmg_relax_data -> tb_relax_data), A, b, x, max_iter,
+                        (pfmg_relax_data -> zero_guess), weight,
+                        (pfmg_relax_data -> rb_start));
+
+      return hypre_error_flag;
+   }
 
    switch (relax_type)
    {
@@ -85,6 +130,20 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+         if (hypre_PFMGLineRelaxDirection(pfmg_relax_data -> line_relax_data) >= 0)
+         {
+            hypre_PFMGLineRelax((pfmg_relax_data -> line_relax_data), A, b, x,
+                                (pfmg_relax_data -> t), max_iter,
+                                (pfmg_relax_data -> zero_guess),
+                                1 - (pfmg_relax_data -> rb_start));
+         }
+         else
+         {
+            /* not available for device data */
+            hypre_PointRelax((pfmg_relax_data -> relax_data), A, b, x);
+         }
          break;
    }
 
@@ -104,6 +163,13 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
 
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      hypre_PFMGMFRelaxSetup((pfmg_relax_data -> mf_relax_data), A, x);
+
+      return hypre_error_flag;
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -114,6 +180,13 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_PFMGLineRelaxSetup((pfmg_relax_data -> line_relax_data), A, x);
+         if (hypre_PFMGLineRelaxDirection(pfmg_relax_data -> line_relax_data) < 0)
+         {
+            hypre_PointRelaxSetup((pfmg_relax_data -> relax_data), A, b, x);
+         }
+         break;
    }
 
    if (relax_type == 1)
@@ -121,6 +194,10 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       hypre_PointRelaxSetWeight(pfmg_relax_data -> relax_data, jacobi_weight);
    }
 
+   /* line relaxation does not use temporal blocking */
+   hypre_PFMGTBRelaxSetup((pfmg_relax_data -> tb_relax_data), A, relax_type,
+                          (relax_type == 4) ? 0 : (pfmg_relax_data -> tb_depth));
+
    return hypre_error_flag;
 }
 
@@ -139,6 +216,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
    switch (relax_type)
    {
       case 0: /* Jacobi */
+      case 4: /* Zebra line Gauss-Seidel (Jacobi if not available) */
       {
          hypre_Index  stride;
          hypre_Index  indices[1];
@@ -174,6 +252,24 @@ hypre_PFMGRelaxSetJacobiWeight(void  *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PFMGRelaxSetTemporalBlocking
+ *
+ * Sets the number of sweeps done per halo exchange (see pfmg_tb_relax.c).
+ * Values less than 2 turn temporal blocking off.  Takes effect at setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlocking( void      *pfmg_relax_vdata,
+                                    HYPRE_Int  tb_depth )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> tb_depth) = tb_depth;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -191,10 +287,16 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
+         break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         (pfmg_relax_data -> rb_start) = 1;
          break;
    }
 
@@ -218,10 +320,16 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartBlack((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 0;
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         (pfmg_relax_data -> rb_start) = 1;
+         break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         (pfmg_relax_data -> rb_start) = 0;
          break;
    }
 
@@ -254,6 +362,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   (pfmg_relax_data -> max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -269,6 +378,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   (pfmg_relax_data -> zero_guess) = zero_guess;
 
    return hypre_error_flag;
 }
@@ -283,6 +393,8 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
+   hypre_StructVectorDestroy(pfmg_relax_data -> t);
+   (pfmg_relax_data -> t) = hypre_StructVectorRef(t);
 
    return hypre_error_flag;
 }
@@ -100,6 +100,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
 
+   hypre_StructMatrix   *A_mf = NULL;
    hypre_StructMatrix  **A_l;
    hypre_StructMatrix  **P_l;
    hypre_StructMatrix  **RT_l;
@@ -151,6 +152,15 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    grid  = hypre_StructMatrixGrid(A);
    ndim  = hypre_StructGridNDim(grid);
 
+   /* The coefficients of a matrix-free matrix are stored for the duration of
+    * the setup, to compute dxyz and the coarse-grid operators.  The fine grid
+    * relaxation and residual evaluate them on the fly. */
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      A_mf = A;
+      A    = hypre_StructMatrixMaterialize(A_mf);
+   }
+
    /* Compute a new max_levels value based on the grid */
    cbox = hypre_BoxDuplicate(hypre_StructGridBoundingBox(grid));
    max_levels = 1;
@@ -648,6 +658,15 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       active_l[l] = 0;
    }
 
+   /* release the stored copy of a matrix-free matrix */
+   if (A_mf != NULL)
+   {
+      hypre_StructMatrixDestroy(A_l[0]);
+      hypre_StructMatrixDestroy(A);
+      A      = A_mf;
+      A_l[0] = hypre_StructMatrixRef(A);
+   }
+
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    if (hypre_StructGridDataLocation(grid) != HYPRE_MEMORY_HOST)
    {
@@ -666,6 +685,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[0], (pfmg_data -> tb_depth));
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
@@ -686,6 +706,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[l], (pfmg_data -> tb_depth));
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
          }
       }
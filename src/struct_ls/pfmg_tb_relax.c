@@ -0,0 +1,790 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Temporal blocking of PFMG relaxation
+ *
+ * Instead of one halo exchange and one pass over the grid per sweep, a ghost
+ * layer 'halo' cells deep is exchanged once, and then 'depth' sweeps are done
+ * tile by tile: each tile is copied with its halo into a small buffer, and
+ * sweep s updates the tile grown by (halo - s) layers, so that after the last
+ * sweep the values on the tile itself are exact.  A Jacobi sweep uses one
+ * halo layer (halo = depth), a red/black sweep uses two (halo = 2*depth).
+ *
+ * The matrix and the right-hand side are needed on the halo as well.  The
+ * matrix is copied once at setup into a matrix with 'halo' ghost layers; its
+ * assemble fills the ghost layers from the neighbors and sets those outside of
+ * the domain to the identity, so that the halo points outside of the domain
+ * stay zero.  The right-hand side is exchanged once per relaxation call.
+ *
+ * The arithmetic is the same as in hypre_PointRelax and hypre_RedBlackGS, so
+ * the results do not depend on whether temporal blocking is used.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+typedef struct
+{
+   HYPRE_Int               depth;        /* sweeps per halo exchange, 0 if not used */
+   HYPRE_Int               halo;         /* ghost layers of xw, bw and Aw */
+   HYPRE_Int               relax_type;   /* 0/1 = (weighted) Jacobi, 2/3 = red/black */
+
+   hypre_StructMatrix     *Aw;
+   hypre_StructVector     *bw;
+   hypre_StructVector     *xw;
+   hypre_CommPkg          *b_comm_pkg;
+   hypre_CommPkg          *x_comm_pkg;
+
+   HYPRE_Int               diag_rank;
+   HYPRE_Int               num_offd;
+   HYPRE_Int              *offd;         /* off-diagonal entries, in stencil order */
+   HYPRE_Int              *offd_chunk;   /* the hypre_PointRelax chunk of each entry */
+
+   hypre_BoxArray         *tiles;
+   HYPRE_Int              *tile_boxnums;
+   HYPRE_Int               buffer_size;  /* per thread */
+   HYPRE_Int               row_size;
+   HYPRE_Complex          *buffers;
+
+} hypre_PFMGTBRelaxData;
+
+/* hypre_PointRelax sums at most this many off-diagonal terms at once */
+#define HYPRE_PFMG_TB_CHUNK 7
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_PFMGTBRelaxCreate( MPI_Comm  comm )
+{
+   hypre_PFMGTBRelaxData *tb_data;
+
+   tb_data = hypre_CTAlloc(hypre_PFMGTBRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   return (void *) tb_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGTBRelaxFree( hypre_PFMGTBRelaxData *tb_data )
+{
+   hypre_StructMatrixDestroy(tb_data -> Aw);
+   hypre_StructVectorDestroy(tb_data -> bw);
+   hypre_StructVectorDestroy(tb_data -> xw);
+   hypre_CommPkgDestroy(tb_data -> b_comm_pkg);
+   hypre_CommPkgDestroy(tb_data -> x_comm_pkg);
+   hypre_TFree(tb_data -> offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(tb_data -> offd_chunk, HYPRE_MEMORY_HOST);
+   hypre_BoxArrayDestroy(tb_data -> tiles);
+   hypre_TFree(tb_data -> tile_boxnums, HYPRE_MEMORY_HOST);
+   hypre_TFree(tb_data -> buffers, HYPRE_MEMORY_HOST);
+
+   (tb_data -> Aw)           = NULL;
+   (tb_data -> bw)           = NULL;
+   (tb_data -> xw)           = NULL;
+   (tb_data -> b_comm_pkg)   = NULL;
+   (tb_data -> x_comm_pkg)   = NULL;
+   (tb_data -> tiles)        = NULL;
+   (tb_data -> tile_boxnums) = NULL;
+   (tb_data -> depth)        = 0;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGTBRelaxDestroy( void *tb_vdata )
+{
+   hypre_PFMGTBRelaxData *tb_data = (hypre_PFMGTBRelaxData *)tb_vdata;
+
+   if (tb_data)
+   {
+      hypre_PFMGTBRelaxFree(tb_data);
+      hypre_TFree(tb_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGTBRelaxTileSize
+ *
+ * Splits the box along its outer dimensions until a tile together with its
+ * halo fits into the cache, and until there is a tile for each thread.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGTBRelaxTileSize( hypre_Box   *box,
+                           HYPRE_Int    halo,
+                           HYPRE_Int    num_arrays,
+                           hypre_Index  tile_size )
+{
+   HYPRE_Int  ndim        = hypre_BoxNDim(box);
+   HYPRE_Int  num_threads = hypre_NumThreads();
+   HYPRE_Int  max_points;
+   HYPRE_Int  d, dmax, volume, num_tiles;
+
+   max_points = hypre_GetStructTileCacheSize() /
+                (HYPRE_Int) (num_arrays * sizeof(HYPRE_Complex));
+
+   hypre_SetIndex(tile_size, 1);
+   for (d = 0; d < ndim; d++)
+   {
+      tile_size[d] = hypre_BoxSizeD(box, d);
+   }
+
+   while (1)
+   {
+      volume    = 1;
+      num_tiles = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         volume    *= tile_size[d] + 2 * halo;
+         num_tiles *= (hypre_BoxSizeD(box, d) + tile_size[d] - 1) / tile_size[d];
+      }
+      if (volume <= max_points && num_tiles >= num_threads)
+      {
+         break;
+      }
+
+      /* halve the largest outer tile size, but not below the halo */
+      dmax = -1;
+      for (d = 1; d < ndim; d++)
+      {
+         if (tile_size[d] > hypre_max(4 * halo, 1) &&
+             (dmax < 0 || tile_size[d] > tile_size[dmax]))
+         {
+            dmax = d;
+         }
+      }
+      if (dmax < 0)
+      {
+         break;
+      }
+      tile_size[dmax] = (tile_size[dmax] + 1) / 2;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGTBRelaxSetup
+ *
+ * Sets up 'depth' sweeps per halo exchange for relaxation of the given type
+ * with A.  Temporal blocking is not used (and hypre_PFMGTBRelaxDepth returns
+ * 0) if depth < 2, for device data, for constant coefficients, for stencils
+ * reaching beyond the nearest neighbors, for red/black relaxation with other
+ * than 3-, 5- or 7-point stencils, or if the halo would be wider than the
+ * neighborhood known to the grid's box manager.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGTBRelaxSetup( void               *tb_vdata,
+                        hypre_StructMatrix *A,
+                        HYPRE_Int           relax_type,
+                        HYPRE_Int           depth )
+{
+   hypre_PFMGTBRelaxData *tb_data = (hypre_PFMGTBRelaxData *)tb_vdata;
+
+   MPI_Comm               comm          = hypre_StructMatrixComm(A);
+   hypre_StructGrid      *grid          = hypre_StructMatrixGrid(A);
+   HYPRE_Int              ndim          = hypre_StructGridNDim(grid);
+   hypre_BoxArray        *boxes         = hypre_StructGridBoxes(grid);
+   hypre_StructStencil   *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *symm_elements = hypre_StructMatrixSymmElements(A);
+   hypre_IndexRef         max_distance  = hypre_StructGridMaxDistance(grid);
+
+   HYPRE_Int              num_ghost[2 * HYPRE_MAXDIM];
+   hypre_CommInfo        *comm_info;
+   hypre_StructMatrix    *Aw;
+   hypre_StructVector    *bw, *xw;
+   hypre_Box             *box, *tile;
+   hypre_Box             *A_dbox, *Aw_dbox;
+   HYPRE_Complex         *Ap, *Awp;
+   hypre_Index            tile_size, num_tiles, loop_size, unit_stride, index;
+   HYPRE_Int              halo, rb, i, k, d, si, t, size, num_buffers, num_all_tiles;
+   HYPRE_Int              extra, global_depth;
+
+   hypre_PFMGTBRelaxFree(tb_data);
+
+   if (depth < 2)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_error_flag;
+#endif
+
+   if (hypre_StructMatrixConstantCoefficient(A) != 0 ||
+       hypre_StructMatrixMatrixFree(A) ||
+       stencil_size > HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM)
+   {
+      return hypre_error_flag;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return hypre_error_flag;
+         }
+      }
+   }
+
+   rb = (relax_type == 2 || relax_type == 3);
+   if (rb && !(stencil_size == 3 || stencil_size == 5 || stencil_size == 7))
+   {
+      return hypre_error_flag;
+   }
+
+   /* a symmetric matrix has one more ghost layer for the transposed entries */
+   extra = hypre_StructMatrixSymmetric(A) ? 1 : 0;
+   halo  = rb ? 2 * depth : depth;
+   for (d = 0; d < ndim; d++)
+   {
+      if (halo + extra > hypre_IndexD(max_distance, d))
+      {
+         depth = (hypre_IndexD(max_distance, d) - extra) / (rb ? 2 : 1);
+         halo  = rb ? 2 * depth : depth;
+      }
+   }
+   /* the max distance may differ between processes, but the depth may not */
+   hypre_MPI_Allreduce(&depth, &global_depth, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   depth = global_depth;
+   halo  = rb ? 2 * depth : depth;
+   if (depth < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   (tb_data -> depth)      = depth;
+   (tb_data -> halo)       = halo;
+   (tb_data -> relax_type) = relax_type;
+
+   /*-----------------------------------------------------------------------
+    * Off-diagonal entries, grouped like in hypre_PointRelax
+    *-----------------------------------------------------------------------*/
+
+   hypre_SetIndex(index, 0);
+   (tb_data -> diag_rank)  = hypre_StructStencilElementRank(stencil, index);
+   (tb_data -> offd)       = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   (tb_data -> offd_chunk) = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (si != (tb_data -> diag_rank))
+      {
+         (tb_data -> offd)[k]       = si;
+         (tb_data -> offd_chunk)[k] = si / HYPRE_PFMG_TB_CHUNK;
+         k++;
+      }
+   }
+   (tb_data -> num_offd) = k;
+
+   /*-----------------------------------------------------------------------
+    * Copy A into a matrix with wide ghost layers
+    *-----------------------------------------------------------------------*/
+
+   for (d = 0; d < 2 * HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2 * ndim) ? halo : 0;
+   }
+
+   Aw = hypre_StructMatrixCreate(comm, grid, stencil);
+   hypre_StructMatrixSymmetric(Aw) = hypre_StructMatrixSymmetric(A);
+   hypre_StructMatrixSetNumGhost(Aw, num_ghost);
+   hypre_StructMatrixInitialize(Aw);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      Aw_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(Aw), i);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         /* symmetric matrices store only one of each pair of entries */
+         if (symm_elements && symm_elements[si] >= 0)
+         {
+            continue;
+         }
+
+         Ap  = hypre_StructMatrixBoxData(A, i, si);
+         Awp = hypre_StructMatrixBoxData(Aw, i, si);
+
+#define DEVICE_VAR is_device_ptr(Awp,Ap)
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             A_dbox, hypre_BoxIMin(box), unit_stride, Ai,
+                             Aw_dbox, hypre_BoxIMin(box), unit_stride, Awi);
+         {
+            Awp[Awi] = Ap[Ai];
+         }
+         hypre_BoxLoop2End(Ai, Awi);
+#undef DEVICE_VAR
+      }
+   }
+   hypre_StructMatrixAssemble(Aw);
+
+   bw = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(bw, num_ghost);
+   hypre_StructVectorInitialize(bw);
+   hypre_StructVectorAssemble(bw);
+
+   xw = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(xw, num_ghost);
+   hypre_StructVectorInitialize(xw);
+   hypre_StructVectorAssemble(xw);
+
+   /* one package each, since b and x are exchanged at the same time */
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(bw), hypre_StructVectorDataSpace(bw),
+                       1, NULL, 0, comm, &(tb_data -> b_comm_pkg));
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(xw), hypre_StructVectorDataSpace(xw),
+                       1, NULL, 0, comm, &(tb_data -> x_comm_pkg));
+   hypre_CommInfoDestroy(comm_info);
+
+   (tb_data -> Aw) = Aw;
+   (tb_data -> bw) = bw;
+   (tb_data -> xw) = xw;
+
+   /*-----------------------------------------------------------------------
+    * Tiles and per-thread buffers
+    *-----------------------------------------------------------------------*/
+
+   num_buffers = rb ? 1 : 2;
+
+   num_all_tiles = 0;
+   (tb_data -> tiles)        = hypre_BoxArrayCreate(0, ndim);
+   (tb_data -> buffer_size)  = 0;
+   (tb_data -> row_size)     = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+
+      hypre_PFMGTBRelaxTileSize(box, halo, stencil_size + num_buffers + 1, tile_size);
+
+      size = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         num_tiles[d] = (hypre_BoxSizeD(box, d) + tile_size[d] - 1) / tile_size[d];
+         size *= num_tiles[d];
+      }
+
+      for (t = 0; t < size; t++)
+      {
+         hypre_BoxArraySetSize(tb_data -> tiles, num_all_tiles + 1);
+         tile = hypre_BoxArrayBox(tb_data -> tiles, num_all_tiles);
+         k = t;
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(tile, d) = hypre_BoxIMinD(box, d) + (k % num_tiles[d]) * tile_size[d];
+            hypre_BoxIMaxD(tile, d) = hypre_min(hypre_BoxIMinD(tile, d) + tile_size[d] - 1,
+                                                hypre_BoxIMaxD(box, d));
+            k /= num_tiles[d];
+         }
+         num_all_tiles++;
+      }
+
+      k = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         k *= hypre_min(tile_size[d], hypre_BoxSizeD(box, d)) + 2 * halo;
+      }
+      (tb_data -> buffer_size) = hypre_max((tb_data -> buffer_size), num_buffers * k);
+      (tb_data -> row_size)    = hypre_max((tb_data -> row_size),
+                                           hypre_BoxSizeD(box, 0) + 2 * halo);
+   }
+
+   (tb_data -> tile_boxnums) = hypre_TAlloc(HYPRE_Int, num_all_tiles, HYPRE_MEMORY_HOST);
+   t = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      while (t < num_all_tiles &&
+             hypre_IndexInBox(hypre_BoxIMin(hypre_BoxArrayBox(tb_data -> tiles, t)), box))
+      {
+         (tb_data -> tile_boxnums)[t++] = i;
+      }
+   }
+
+   /* each thread needs the buffers of one tile and two rows */
+   (tb_data -> buffer_size) += 2 * (tb_data -> row_size);
+   (tb_data -> buffers) = hypre_TAlloc(HYPRE_Complex,
+                                       hypre_NumThreads() * (tb_data -> buffer_size),
+                                       HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGTBRelaxDepth( void *tb_vdata )
+{
+   hypre_PFMGTBRelaxData *tb_data = (hypre_PFMGTBRelaxData *)tb_vdata;
+
+   return (tb_data -> depth);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGTBRelaxTile
+ *
+ * Does num_sweeps sweeps on tile t and writes the result into x.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGTBRelaxTile( hypre_PFMGTBRelaxData *tb_data,
+                       HYPRE_Int              t,
+                       HYPRE_Int              num_sweeps,
+                       HYPRE_Real             weight,
+                       HYPRE_Int              rb_start,
+                       hypre_StructVector    *x )
+{
+   hypre_StructMatrix    *Aw         = (tb_data -> Aw);
+   hypre_StructVector    *bw         = (tb_data -> bw);
+   hypre_StructVector    *xw         = (tb_data -> xw);
+   HYPRE_Int              halo       = (tb_data -> halo);
+   HYPRE_Int              rb         = ((tb_data -> relax_type) == 2 ||
+                                        (tb_data -> relax_type) == 3);
+   HYPRE_Int              num_offd   = (tb_data -> num_offd);
+   HYPRE_Int             *offd       = (tb_data -> offd);
+   HYPRE_Int             *offd_chunk = (tb_data -> offd_chunk);
+   HYPRE_Int              ndim       = hypre_StructMatrixNDim(Aw);
+   hypre_Index           *shape      = hypre_StructStencilShape(hypre_StructMatrixStencil(Aw));
+   hypre_Box             *tile       = hypre_BoxArrayBox((tb_data -> tiles), t);
+   HYPRE_Int              b          = (tb_data -> tile_boxnums)[t];
+
+   hypre_Box             *A_dbox     = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(Aw), b);
+   hypre_Box             *b_dbox     = hypre_BoxArrayBox(hypre_StructVectorDataSpace(bw), b);
+   hypre_Box             *xw_dbox    = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xw), b);
+   hypre_Box             *x_dbox     = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), b);
+   HYPRE_Complex         *Ad         = hypre_StructMatrixBoxData(Aw, b, (tb_data -> diag_rank));
+   HYPRE_Complex         *bp         = hypre_StructVectorBoxData(bw, b);
+   HYPRE_Complex         *xwp        = hypre_StructVectorBoxData(xw, b);
+   HYPRE_Complex         *xp         = hypre_StructVectorBoxData(x, b);
+
+   HYPRE_Complex         *Ap[HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM];
+   HYPRE_Int              xoff[HYPRE_MAXDIM * HYPRE_MAXDIM * HYPRE_MAXDIM];
+   HYPRE_Complex         *cur, *next, *tmp, *trow, *srow;
+   HYPRE_Real             weightc = 1.0 - weight;
+   HYPRE_Int              lo[3], hi[3], glo[3], gn[3];
+   HYPRE_Int              s, num_steps, grow, color, e, c, d;
+   HYPRE_Int              ii, jj, kk, i0, n, xi, Ai, bi, gi;
+   hypre_Index            index;
+
+   /* the buffer box G is the tile grown by the halo */
+   for (d = 0; d < 3; d++)
+   {
+      if (d < ndim)
+      {
+         glo[d] = hypre_BoxIMinD(tile, d) - halo;
+         gn[d]  = hypre_BoxSizeD(tile, d) + 2 * halo;
+      }
+      else
+      {
+         glo[d] = 0;
+         gn[d]  = 1;
+      }
+   }
+
+   cur  = (tb_data -> buffers) + hypre_GetThreadNum() * (tb_data -> buffer_size);
+   next = cur + (rb ? 0 : gn[0] * gn[1] * gn[2]);
+   trow = next + gn[0] * gn[1] * gn[2];
+   srow = trow + (tb_data -> row_size);
+
+   for (e = 0; e < num_offd; e++)
+   {
+      Ap[e]   = hypre_StructMatrixBoxData(Aw, b, offd[e]);
+      xoff[e] = 0;
+      for (d = ndim - 1; d >= 0; d--)
+      {
+         xoff[e] = xoff[e] * gn[d] + hypre_IndexD(shape[offd[e]], d);
+      }
+   }
+
+   /* copy x on G into the buffer */
+   hypre_SetIndex(index, 0);
+   for (kk = 0; kk < gn[2]; kk++)
+   {
+      for (jj = 0; jj < gn[1]; jj++)
+      {
+         index[0] = glo[0];
+         index[1] = glo[1] + jj;
+         index[2] = glo[2] + kk;
+         xi = hypre_BoxIndexRank(xw_dbox, index);
+         gi = (kk * gn[1] + jj) * gn[0];
+         for (ii = 0; ii < gn[0]; ii++)
+         {
+            cur[gi + ii] = xwp[xi + ii];
+         }
+      }
+   }
+
+   /* a Jacobi sweep, or a half sweep of red/black, uses up one halo layer */
+   num_steps = rb ? 2 * num_sweeps : num_sweeps;
+   for (s = 0; s < num_steps; s++)
+   {
+      grow = num_steps - 1 - s;
+      for (d = 0; d < 3; d++)
+      {
+         lo[d] = (d < ndim) ? hypre_BoxIMinD(tile, d) - grow : 0;
+         hi[d] = (d < ndim) ? hypre_BoxIMaxD(tile, d) + grow : 0;
+      }
+      color = (rb_start + s) % 2;
+
+      for (kk = lo[2]; kk <= hi[2]; kk++)
+      {
+         for (jj = lo[1]; jj <= hi[1]; jj++)
+         {
+            if (rb)
+            {
+               /* points with (i + j + k) % 2 == color */
+               i0 = lo[0] + ((lo[0] + jj + kk + color) & 1);
+            }
+            else
+            {
+               i0 = lo[0];
+            }
+            if (i0 > hi[0])
+            {
+               continue;
+            }
+
+            index[0] = i0;
+            index[1] = jj;
+            index[2] = kk;
+            Ai = hypre_BoxIndexRank(A_dbox, index);
+            bi = hypre_BoxIndexRank(b_dbox, index);
+            gi = ((kk - glo[2]) * gn[1] + (jj - glo[1])) * gn[0] + (i0 - glo[0]);
+            n  = hi[0] - i0 + 1;
+
+            if (rb)
+            {
+               /* same as hypre_RedBlackGS */
+               for (ii = 0; ii < n; ii += 2)
+               {
+                  HYPRE_Complex v = bp[bi + ii];
+
+                  for (e = 0; e < num_offd; e++)
+                  {
+                     v -= Ap[e][Ai + ii] * cur[gi + ii + xoff[e]];
+                  }
+                  cur[gi + ii] = v / Ad[Ai + ii];
+               }
+            }
+            else
+            {
+               /* same as hypre_PointRelax */
+               for (ii = 0; ii < n; ii++)
+               {
+                  trow[ii] = bp[bi + ii];
+               }
+               for (e = 0; e < num_offd; e = c)
+               {
+                  for (ii = 0; ii < n; ii++)
+                  {
+                     srow[ii] = Ap[e][Ai + ii] * cur[gi + ii + xoff[e]];
+                  }
+                  for (c = e + 1; c < num_offd && offd_chunk[c] == offd_chunk[e]; c++)
+                  {
+                     for (ii = 0; ii < n; ii++)
+                     {
+                        srow[ii] += Ap[c][Ai + ii] * cur[gi + ii + xoff[c]];
+                     }
+                  }
+                  for (ii = 0; ii < n; ii++)
+                  {
+                     trow[ii] -= srow[ii];
+                  }
+               }
+               for (ii = 0; ii < n; ii++)
+               {
+                  trow[ii] /= Ad[Ai + ii];
+               }
+               if (weight != 1.0)
+               {
+                  for (ii = 0; ii < n; ii++)
+                  {
+                     next[gi + ii] = weight * trow[ii] + weightc * cur[gi + ii];
+                  }
+               }
+               else
+               {
+                  for (ii = 0; ii < n; ii++)
+                  {
+                     next[gi + ii] = trow[ii];
+                  }
+               }
+            }
+         }
+      }
+
+      if (!rb)
+      {
+         tmp  = cur;
+         cur  = next;
+         next = tmp;
+      }
+   }
+
+   /* write the tile back into x */
+   for (kk = 0; kk < ((ndim > 2) ? hypre_BoxSizeD(tile, 2) : 1); kk++)
+   {
+      for (jj = 0; jj < ((ndim > 1) ? hypre_BoxSizeD(tile, 1) : 1); jj++)
+      {
+         index[0] = hypre_BoxIMinD(tile, 0);
+         index[1] = (ndim > 1) ? hypre_BoxIMinD(tile, 1) + jj : 0;
+         index[2] = (ndim > 2) ? hypre_BoxIMinD(tile, 2) + kk : 0;
+         xi = hypre_BoxIndexRank(x_dbox, index);
+         gi = ((index[2] - glo[2]) * gn[1] + (index[1] - glo[1])) * gn[0] + halo;
+         for (ii = 0; ii < hypre_BoxSizeD(tile, 0); ii++)
+         {
+            xp[xi + ii] = cur[gi + ii];
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGTBRelax
+ *
+ * Does max_iter sweeps of the relaxation set up by hypre_PFMGTBRelaxSetup,
+ * in groups of up to 'depth' sweeps per halo exchange.  For Jacobi, 'weight'
+ * is the Jacobi weight; for red/black, 'rb_start' is the color relaxed first.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGTBRelax( void               *tb_vdata,
+                   hypre_StructMatrix *A,
+                   hypre_StructVector *b,
+                   hypre_StructVector *x,
+                   HYPRE_Int           max_iter,
+                   HYPRE_Int           zero_guess,
+                   HYPRE_Real          weight,
+                   HYPRE_Int           rb_start )
+{
+   hypre_PFMGTBRelaxData *tb_data   = (hypre_PFMGTBRelaxData *)tb_vdata;
+   hypre_StructVector    *bw        = (tb_data -> bw);
+   hypre_StructVector    *xw        = (tb_data -> xw);
+   HYPRE_Int              depth     = (tb_data -> depth);
+   HYPRE_Int              num_tiles = hypre_BoxArraySize(tb_data -> tiles);
+   HYPRE_Int              ndim      = hypre_StructVectorNDim(x);
+   hypre_BoxArray        *boxes     = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+
+   hypre_CommHandle      *b_comm_handle, *x_comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *v_dbox, *vw_dbox;
+   HYPRE_Complex         *vp, *vwp;
+   hypre_Index            loop_size, unit_stride;
+   HYPRE_Int              iter, num_sweeps, i, t;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   /* b onto the wide vector, exchanged once for all sweeps */
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      v_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      vw_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(bw), i);
+      vp      = hypre_StructVectorBoxData(b, i);
+      vwp     = hypre_StructVectorBoxData(bw, i);
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(vwp,vp)
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          v_dbox, hypre_BoxIMin(box), unit_stride, vi,
+                          vw_dbox, hypre_BoxIMin(box), unit_stride, vwi);
+      {
+         vwp[vwi] = vp[vi];
+      }
+      hypre_BoxLoop2End(vi, vwi);
+#undef DEVICE_VAR
+   }
+   hypre_InitializeCommunication(tb_data -> b_comm_pkg,
+                                 hypre_StructVectorData(bw), hypre_StructVectorData(bw),
+                                 0, 0, &b_comm_handle);
+
+   for (iter = 0; iter < max_iter; iter += num_sweeps)
+   {
+      num_sweeps = hypre_min(depth, max_iter - iter);
+
+      x_comm_handle = NULL;
+      if (zero_guess && iter == 0)
+      {
+         /* zero everywhere, including the halo */
+         hypre_Memset(hypre_StructVectorData(xw), 0,
+                      hypre_StructVectorDataSize(xw) * sizeof(HYPRE_Complex),
+                      HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         hypre_ForBoxI(i, boxes)
+         {
+            box     = hypre_BoxArrayBox(boxes, i);
+            v_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+            vw_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(xw), i);
+            vp      = hypre_StructVectorBoxData(x, i);
+            vwp     = hypre_StructVectorBoxData(xw, i);
+            hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(vwp,vp)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                v_dbox, hypre_BoxIMin(box), unit_stride, vi,
+                                vw_dbox, hypre_BoxIMin(box), unit_stride, vwi);
+            {
+               vwp[vwi] = vp[vi];
+            }
+            hypre_BoxLoop2End(vi, vwi);
+#undef DEVICE_VAR
+         }
+         hypre_InitializeCommunication(tb_data -> x_comm_pkg,
+                                       hypre_StructVectorData(xw), hypre_StructVectorData(xw),
+                                       0, 1, &x_comm_handle);
+      }
+
+      if (b_comm_handle)
+      {
+         hypre_FinalizeCommunication(b_comm_handle);
+         b_comm_handle = NULL;
+      }
+      if (x_comm_handle)
+      {
+         hypre_FinalizeCommunication(x_comm_handle);
+      }
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(t) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_tiles; t++)
+      {
+         hypre_PFMGTBRelaxTile(tb_data, t, num_sweeps, weight, rb_start, x);
+      }
+   }
+
+   if (b_comm_handle)
+   {
+      hypre_FinalizeCommunication(b_comm_handle);
+   }
+
+   return hypre_error_flag;
+}
@@ -782,10 +782,10 @@ hypre_PointRelax_core0( void               *relax_vdata,
       {
          case 7:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -796,16 +796,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap5[Ai] * xp[xi + xoff5] +
                   Ap6[Ai] * xp[xi + xoff6];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 6:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -815,16 +815,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap4[Ai] * xp[xi + xoff4] +
                   Ap5[Ai] * xp[xi + xoff5];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 5:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -833,16 +833,16 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap3[Ai] * xp[xi + xoff3] +
                   Ap4[Ai] * xp[xi + xoff4];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 4:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,Ap3,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
@@ -850,52 +850,52 @@ hypre_PointRelax_core0( void               *relax_vdata,
                   Ap2[Ai] * xp[xi + xoff2] +
                   Ap3[Ai] * xp[xi + xoff3];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 3:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,Ap2,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
                   Ap1[Ai] * xp[xi + xoff1] +
                   Ap2[Ai] * xp[xi + xoff2];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 2:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,Ap1,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0] +
                   Ap1[Ai] * xp[xi + xoff1];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
          case 1:
 #define DEVICE_VAR is_device_ptr(tp,Ap0,xp)
-            hypre_BoxLoop3Begin(hypre_StructMatrixNDim(A), loop_size,
-                                A_data_box, start, stride, Ai,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop3TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     A_data_box, start, stride, Ai,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   Ap0[Ai] * xp[xi + xoff0];
             }
-            hypre_BoxLoop3End(Ai, xi, ti);
+            hypre_BoxLoop3TiledEnd(Ai, xi, ti);
 #undef DEVICE_VAR
             break;
 
@@ -1075,9 +1075,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp4 = Ap4[Ai] * AApd;
             AAp5 = Ap5[Ai] * AApd;
             AAp6 = Ap6[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1088,7 +1088,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp5 * xp[xi + xoff5] +
                   AAp6 * xp[xi + xoff6];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 6:
@@ -1098,9 +1098,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp3 = Ap3[Ai] * AApd;
             AAp4 = Ap4[Ai] * AApd;
             AAp5 = Ap5[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1110,7 +1110,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp4 * xp[xi + xoff4] +
                   AAp5 * xp[xi + xoff5];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 5:
@@ -1119,9 +1119,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp2 = Ap2[Ai] * AApd;
             AAp3 = Ap3[Ai] * AApd;
             AAp4 = Ap4[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1130,7 +1130,7 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp3 * xp[xi + xoff3] +
                   AAp4 * xp[xi + xoff4];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 4:
@@ -1138,9 +1138,9 @@ hypre_PointRelax_core12( void               *relax_vdata,
             AAp1 = Ap1[Ai] * AApd;
             AAp2 = Ap2[Ai] * AApd;
             AAp3 = Ap3[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
@@ -1148,49 +1148,49 @@ hypre_PointRelax_core12( void               *relax_vdata,
                   AAp2 * xp[xi + xoff2] +
                   AAp3 * xp[xi + xoff3];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 3:
             AAp0 = Ap0[Ai] * AApd;
             AAp1 = Ap1[Ai] * AApd;
             AAp2 = Ap2[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
                   AAp1 * xp[xi + xoff1] +
                   AAp2 * xp[xi + xoff2];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 2:
             AAp0 = Ap0[Ai] * AApd;
             AAp1 = Ap1[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0] +
                   AAp1 * xp[xi + xoff1];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 1:
             AAp0 = Ap0[Ai] * AApd;
-            hypre_BoxLoop2Begin(hypre_StructMatrixNDim(A), loop_size,
-                                x_data_box, start, stride, xi,
-                                t_data_box, start, stride, ti);
+            hypre_BoxLoop2TiledBegin(hypre_StructMatrixNDim(A), loop_size,
+                                     x_data_box, start, stride, xi,
+                                     t_data_box, start, stride, ti);
             {
                tp[ti] -=
                   AAp0 * xp[xi + xoff0];
             }
-            hypre_BoxLoop2End(xi, ti);
+            hypre_BoxLoop2TiledEnd(xi, ti);
             break;
 
          case 0:
@@ -348,12 +348,14 @@ typedef struct
 
 #else
 
-/* CPU */
+/* CPU: the points of one color are swept tile by tile (see
+ * hypre_BoxLoopGetTileSize), and the tiles are distributed over the threads */
 #define HYPRE_REDBLACK_PRIVATE hypre__kk
 
 #define hypre_RedBlackLoopInit()\
 {\
-   HYPRE_Int hypre__kk;
+   HYPRE_Int hypre__kk, hypre__rb_tile, hypre__rb_num_tiles;\
+   hypre_Index hypre__rb_n, hypre__rb_ts, hypre__rb_tn;
 
 #ifdef HYPRE_USING_OPENMP
 #define HYPRE_BOX_REDUCTION
@@ -367,21 +369,46 @@ typedef struct
 #define OMPRB1
 #endif
 
+#define hypre_RedBlackLoopTiles(ni,nj,nk)\
+   hypre_SetIndex3(hypre__rb_n, ni, nj, nk);\
+   hypre_BoxLoopGetTileSize(3, hypre__rb_n, 3, hypre__rb_ts);\
+   hypre__rb_num_tiles = 1;\
+   for (hypre__kk = 0; hypre__kk < 3; hypre__kk++)\
+   {\
+      hypre__rb_tn[hypre__kk] = (hypre__rb_n[hypre__kk] + hypre__rb_ts[hypre__kk] - 1) /\
+                                hypre__rb_ts[hypre__kk];\
+      hypre__rb_num_tiles *= hypre__rb_tn[hypre__kk];\
+   }
+
+#define hypre_RedBlackLoopTileSet()\
+   HYPRE_Int hypre__rb_o[3], hypre__rb_e[3], hypre__rb_t, hypre__rb_d;\
+   hypre__rb_t = hypre__rb_tile;\
+   for (hypre__rb_d = 0; hypre__rb_d < 3; hypre__rb_d++)\
+   {\
+      hypre__rb_o[hypre__rb_d] = (hypre__rb_t % hypre__rb_tn[hypre__rb_d]) * hypre__rb_ts[hypre__rb_d];\
+      hypre__rb_t /= hypre__rb_tn[hypre__rb_d];\
+      hypre__rb_e[hypre__rb_d] = hypre_min(hypre__rb_o[hypre__rb_d] + hypre__rb_ts[hypre__rb_d],\
+                                           hypre__rb_n[hypre__rb_d]);\
+   }
+
 #define hypre_RedBlackLoopBegin(ni,nj,nk,redblack,  \
                                 Astart,Ani,Anj,Ai,  \
                                 bstart,bni,bnj,bi,  \
                                 xstart,xni,xnj,xi)  \
+   hypre_RedBlackLoopTiles(ni,nj,nk) \
    OMPRB1 \
-   for (hypre__kk = 0; hypre__kk < nk; hypre__kk++) \
+   for (hypre__rb_tile = 0; hypre__rb_tile < hypre__rb_num_tiles; hypre__rb_tile++) \
    {\
       HYPRE_Int ii,jj,Ai,bi,xi;\
-      for (jj = 0; jj < nj; jj++)\
+      hypre_RedBlackLoopTileSet()\
+      for (hypre__kk = hypre__rb_o[2]; hypre__kk < hypre__rb_e[2]; hypre__kk++)\
+      for (jj = hypre__rb_o[1]; jj < hypre__rb_e[1]; jj++)\
       {\
-         ii = (hypre__kk + jj + redblack) % 2;\
+         ii = hypre__rb_o[0] + (hypre__rb_o[0] + hypre__kk + jj + redblack) % 2;\
          Ai = Astart + hypre__kk*Anj*Ani + jj*Ani + ii; \
          bi = bstart + hypre__kk*bnj*bni + jj*bni + ii; \
          xi = xstart + hypre__kk*xnj*xni + jj*xni + ii; \
-         for (; ii < ni; ii+=2, Ai+=2, bi+=2, xi+=2)\
+         for (; ii < hypre__rb_e[0]; ii+=2, Ai+=2, bi+=2, xi+=2)\
          {
 
 #define hypre_RedBlackLoopEnd()\
@@ -393,16 +420,19 @@ typedef struct
 #define hypre_RedBlackConstantcoefLoopBegin(ni,nj,nk,redblack, \
                                             bstart,bni,bnj,bi, \
                                             xstart,xni,xnj,xi) \
+   hypre_RedBlackLoopTiles(ni,nj,nk) \
    OMPRB1 \
-   for (hypre__kk = 0; hypre__kk < nk; hypre__kk++)\
+   for (hypre__rb_tile = 0; hypre__rb_tile < hypre__rb_num_tiles; hypre__rb_tile++)\
    {\
       HYPRE_Int ii,jj,bi,xi;\
-      for (jj = 0; jj < nj; jj++)\
+      hypre_RedBlackLoopTileSet()\
+      for (hypre__kk = hypre__rb_o[2]; hypre__kk < hypre__rb_e[2]; hypre__kk++)\
+      for (jj = hypre__rb_o[1]; jj < hypre__rb_e[1]; jj++)\
       {\
-         ii = (hypre__kk + jj + redblack) % 2;\
+         ii = hypre__rb_o[0] + (hypre__rb_o[0] + hypre__kk + jj + redblack) % 2;\
          bi = bstart + hypre__kk*bnj*bni + jj*bni + ii;\
          xi = xstart + hypre__kk*xnj*xni + jj*xni + ii;\
-         for (; ii < ni; ii+=2, Ai+=2, bi+=2, xi+=2)\
+         for (; ii < hypre__rb_e[0]; ii+=2, Ai+=2, bi+=2, xi+=2)\
          {
 
 #define hypre_RedBlackConstantcoefLoopEnd()\
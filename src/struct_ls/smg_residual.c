@@ -22,6 +22,7 @@ typedef struct
    hypre_StructVector  *r;
    hypre_BoxArray      *base_points;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            stencil_kernel;
 
    HYPRE_Int            time_index;
    HYPRE_BigInt         flops;
@@ -94,6 +95,7 @@ hypre_SMGResidualSetup( void               *residual_vdata,
    (residual_data -> r)           = hypre_StructVectorRef(r);
    (residual_data -> base_points) = base_points;
    (residual_data -> compute_pkg) = compute_pkg;
+   (residual_data -> stencil_kernel) = hypre_StructMatvecStencilKernel(A);
 
    /*-----------------------------------------------------
     * Compute flops
@@ -123,6 +125,7 @@ hypre_SMGResidual( void               *residual_vdata,
    hypre_IndexRef          base_stride = (residual_data -> base_stride);
    hypre_BoxArray         *base_points = (residual_data -> base_points);
    hypre_ComputePkg       *compute_pkg = (residual_data -> compute_pkg);
+   HYPRE_Int               stencil_kernel = (residual_data -> stencil_kernel);
 
    hypre_CommHandle       *comm_handle;
 
@@ -214,6 +217,13 @@ hypre_SMGResidual( void               *residual_vdata,
        * Compute r -= A*x
        *--------------------------------------------------------------------*/
 
+      if (stencil_kernel)
+      {
+         hypre_StructMatvecStencil(-1.0, A, x, r, compute_box_aa, base_stride,
+                                   stencil_kernel);
+         continue;
+      }
+
       hypre_ForBoxArrayI(i, compute_box_aa)
       {
          compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -345,6 +345,35 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
                                                 HYPRE_Int          nentries,
                                                 HYPRE_Int         *entries );
 
+/**
+ * The coefficient function of a matrix-free matrix.  It evaluates the
+ * coefficients of the \e n grid points \e index, \e index + (1,0,0), ...,
+ * \e index + (\e n - 1,0,0), and stores the coefficient of stencil entry
+ * \e s at point \e i in \e values[\e s * \e n + \e i].  The function may be
+ * called from several threads at the same time.
+ **/
+typedef HYPRE_Int (*HYPRE_StructMatrixCoeffFcn)(void          *coeff_data,
+                                                HYPRE_Int     *index,
+                                                HYPRE_Int      n,
+                                                HYPRE_Complex *values);
+
+/**
+ * (Optional) Make the matrix matrix-free.  Its coefficients are not stored,
+ * but are evaluated by \e coeff_fcn (see \ref HYPRE_StructMatrixCoeffFcn)
+ * whenever they are needed.  This must be called before
+ * \ref HYPRE_StructMatrixInitialize, and the matrix must be nonsymmetric and
+ * have no constant entries.  Setting and getting values is not possible.
+ *
+ * Matrix-free matrices are supported by \ref HYPRE_StructMatrixMatvec, by
+ * PFMG, and by the Krylov solvers without a preconditioner or with PFMG, on
+ * the host.  PFMG evaluates the fine-level residual and relaxation on the fly,
+ * and stores the coarse-level operators.  The other struct solvers and
+ * preconditioners need stored coefficients.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffFunction(HYPRE_StructMatrix          matrix,
+                                             HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                                             void                       *coeff_data);
+
 /**
  * Set the ghost layer in the matrix
  **/
@@ -799,10 +799,24 @@ typedef struct hypre_BoxManEntry_struct
 
    void *boxman; /* The owning manager (populated in addentry) */
 
-   struct hypre_BoxManEntry_struct  *next;
-
 } hypre_BoxManEntry;
 
+/*---------------------------------------------------------------------------
+ * Box Manager BVH node: a node of the bounding volume hierarchy built over
+ * the entries in the assemble.  Nodes are stored depth-first, so the left
+ * child of an interior node immediately follows it.
+ *----------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int imin[HYPRE_MAXDIM]; /* Bounding box of the entries below */
+   HYPRE_Int imax[HYPRE_MAXDIM];
+   HYPRE_Int first; /* Leaf: start in the bvh_order array.  Interior: index
+                       of the right child */
+   HYPRE_Int count; /* Leaf: number of entries.  Interior: 0 */
+
+} hypre_BoxManBVHNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -859,18 +873,11 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
-   HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
-                                                 imax of each box in the entries
-                                                 array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   /* Here is the hierarchy that organizes the entries spatially */
+   hypre_BoxManBVHNode *bvh_nodes; /* Tree nodes (root is node 0) */
+   HYPRE_Int            bvh_nnodes; /* Number of tree nodes */
+   HYPRE_Int           *bvh_order; /* Positions into the 'entries' array,
+                                      grouped by leaf */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -923,10 +930,9 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
-#define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
-#define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManBVHNodes(manager)           ((manager) -> bvh_nodes)
+#define hypre_BoxManBVHNNodes(manager)          ((manager) -> bvh_nnodes)
+#define hypre_BoxManBVHOrder(manager)           ((manager) -> bvh_order)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -939,10 +945,6 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
-#define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
-#define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
-
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
 
@@ -957,7 +959,6 @@ typedef struct
 #define hypre_BoxManEntryId(entry)       ((entry) -> id)
 #define hypre_BoxManEntryPosition(entry) ((entry) -> position)
 #define hypre_BoxManEntryNumGhost(entry) ((entry) -> num_ghost)
-#define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
 #endif
@@ -1009,6 +1010,12 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication info computed from this grid, cached by stencil pattern
+      (see hypre_CreateCommInfoFromStencil) */
+   HYPRE_Int            comm_cache_size;
+   HYPRE_Int           *comm_cache_keys;
+   struct hypre_CommInfo_struct **comm_cache_infos;
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_MemoryLocation data_location;
 #endif
@@ -1034,6 +1041,9 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridCommCacheSize(grid) ((grid) -> comm_cache_size)
+#define hypre_StructGridCommCacheKeys(grid) ((grid) -> comm_cache_keys)
+#define hypre_StructGridCommCacheInfos(grid) ((grid) -> comm_cache_infos)
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -1169,6 +1179,11 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* MPI datatype describing the entries in place in the data array, used
+      instead of a packed buffer when 'use_datatype' is set */
+   HYPRE_Int             use_datatype;
+   hypre_MPI_Datatype    datatype;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -1295,6 +1310,9 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+#define hypre_CommTypeUseDatatype(type)   (type -> use_datatype)
+#define hypre_CommTypeDatatype(type)      (type -> datatype)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -1475,16 +1493,35 @@ typedef struct hypre_StructMatrix_struct
 
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
+   HYPRE_Int            *entry_types;               /* How each stencil entry is stored
+                                                       (HYPRE_STRUCT_ENTRY_*) */
    HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM]; /* Num ghost layers in each direction */
 
    HYPRE_BigInt          global_size;               /* Total number of nonzero coeffs */
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn;           /* Coefficient function of a
+                                                       matrix-free matrix (or NULL) */
+   void                 *coeff_data;                /* Data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
 
+/*--------------------------------------------------------------------------
+ * Storage of a stencil entry of hypre_StructMatrix (entry_types):
+ *
+ * VARIABLE - one coefficient per grid point
+ * CONSTANT - one coefficient for all grid points
+ * MIRRORED - one coefficient per grid point, not stored, but taken from the
+ *            transpose coefficient at a neighboring point (symmetric storage)
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_STRUCT_ENTRY_VARIABLE 0
+#define HYPRE_STRUCT_ENTRY_CONSTANT 1
+#define HYPRE_STRUCT_ENTRY_MIRRORED 2
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_StructMatrix
  *--------------------------------------------------------------------------*/
@@ -1505,10 +1542,17 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
+#define hypre_StructMatrixEntryTypes(matrix)          ((matrix) -> entry_types)
+#define hypre_StructMatrixEntryType(matrix, s)        ((matrix) -> entry_types[s])
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
+
+#define hypre_StructMatrixMatrixFree(matrix) \
+(hypre_StructMatrixCoeffFcn(matrix) != NULL)
 
 #define hypre_StructMatrixNDim(matrix) \
 hypre_StructGridNDim(hypre_StructMatrixGrid(matrix))
@@ -1679,6 +1723,8 @@ HYPRE_Int hypre_IndexInBox ( hypre_Index index, hypre_Box *box );
 HYPRE_Int hypre_BoxGetSize ( hypre_Box *box, hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideSize ( hypre_Box *box, hypre_Index stride, hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideVolume ( hypre_Box *box, hypre_Index stride, HYPRE_Int *volume_ptr );
+HYPRE_Int hypre_BoxLoopGetTileSize ( HYPRE_Int ndim, hypre_Index loop_size, HYPRE_Int num_arrays,
+                                     hypre_Index tile_size );
 HYPRE_Int hypre_BoxIndexRank( hypre_Box *box, hypre_Index index );
 HYPRE_Int hypre_BoxRankIndex( hypre_Box *box, HYPRE_Int rank, hypre_Index index );
 HYPRE_Int hypre_BoxOffsetDistance( hypre_Box *box, hypre_Index index );
@@ -1738,6 +1784,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManIntersectBoxArray ( hypre_BoxManager *manager, hypre_BoxArray *boxes,
+                                          hypre_BoxManEntry ***entries_ptr, HYPRE_Int **offsets_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -1759,6 +1807,9 @@ HYPRE_Int hypre_CommInfoProjectSend ( hypre_CommInfo *comm_info, hypre_Index ind
 HYPRE_Int hypre_CommInfoProjectRecv ( hypre_CommInfo *comm_info, hypre_Index index,
                                       hypre_Index stride );
 HYPRE_Int hypre_CommInfoDestroy ( hypre_CommInfo *comm_info );
+hypre_CommInfo *hypre_CommInfoDuplicate ( hypre_CommInfo *comm_info );
+HYPRE_Int hypre_CommInfoCacheGetStats ( HYPRE_Int *hits, HYPRE_Int *misses );
+HYPRE_Int hypre_CommInfoCacheResetStats ( void );
 HYPRE_Int hypre_CreateCommInfoFromStencil ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                             hypre_CommInfo **comm_info_ptr );
 HYPRE_Int hypre_CreateCommInfoFromNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
@@ -1829,6 +1880,8 @@ HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename, HYPRE_StructMatrix mat
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha, HYPRE_StructMatrix A,
                                      HYPRE_StructVector x, HYPRE_Complex beta, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixSetCoeffFunction ( HYPRE_StructMatrix matrix,
+                                               HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
 
 /* HYPRE_struct_stencil.c */
 HYPRE_Int HYPRE_StructStencilCreate ( HYPRE_Int dim, HYPRE_Int size, HYPRE_StructStencil *stencil );
@@ -1877,6 +1930,9 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
+HYPRE_Int hypre_CommSetUseDatatypes ( HYPRE_Int use_datatypes );
+HYPRE_Int hypre_CommGetPackStats ( HYPRE_Int *num_typed_msgs, HYPRE_Int *num_packed_msgs );
+HYPRE_Int hypre_CommResetPackStats ( void );
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
                                 hypre_BoxArray *recv_data_space, HYPRE_Int num_values, HYPRE_Int **orders, HYPRE_Int reverse,
                                 MPI_Comm comm, hypre_CommPkg **comm_pkg_ptr );
@@ -1886,6 +1942,8 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeSetDatatype ( hypre_CommType *comm_type, HYPRE_Int ndim,
+                                      HYPRE_Int num_values );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -1977,6 +2035,9 @@ HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
+HYPRE_Int hypre_StructMatrixSetCoeffFunction ( hypre_StructMatrix *matrix,
+                                               HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+hypre_StructMatrix *hypre_StructMatrixMaterialize ( hypre_StructMatrix *matrix );
 
 /* struct_matrix_mask.c */
 hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
@@ -1990,10 +2051,17 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencilKernel ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecStencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                      hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                      hypre_IndexRef stride, HYPRE_Int kernel );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMatrixFree ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                         hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                         hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -2111,6 +2179,16 @@ hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 #define hypre_BoxLoop1Begin  zypre_omp4_dist_BoxLoop1Begin
 #define hypre_BoxLoop1End    zypre_omp4_dist_BoxLoopEnd
 #define hypre_BasicBoxLoop2Begin    zypre_omp4_dist_BoxLoop2_v2_Begin
+
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
 #define hypre_BoxLoop2Begin  zypre_omp4_dist_BoxLoop2Begin
 #define hypre_BoxLoop2End    zypre_omp4_dist_BoxLoopEnd
 #define hypre_BoxLoop3Begin  zypre_omp4_dist_BoxLoop3Begin
@@ -2866,6 +2944,286 @@ typedef struct hypre_Boxloop_struct
          {
 
 
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoops
+ *
+ * Same arguments and semantics as the BoxLoops above, but the iteration space
+ * is cut into tiles (see hypre_BoxLoopGetTileSize) that are distributed over
+ * the threads, and each tile is traversed plane by plane.  This improves the
+ * cache reuse of stencil sweeps over large boxes.  Tiling is off by default
+ * (see HYPRE_SetStructTiling), and the loops then run as the BoxLoops above.
+ * The loop body must not depend on the iteration order, and
+ * hypre_BoxLoopGetIndex cannot be used.
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TiledBoxLoopDeclare()                                           \
+HYPRE_Int  hypre__d, hypre__ndim, hypre__m, hypre__tiled;                     \
+HYPRE_Int  hypre__tile, hypre__num_tiles, hypre__div = 0, hypre__mod = 0;     \
+HYPRE_Int  hypre__n[HYPRE_MAXDIM], hypre__tn[HYPRE_MAXDIM] = {0};             \
+hypre_Index hypre__ts = {0}
+
+#define zypre_TiledBoxLoopDeclareK(k)                                         \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[HYPRE_MAXDIM]
+
+/* With tiling off, the "tiles" are the blocks of rows of the regular BoxLoops,
+ * so that the loops are distributed and traversed in the same way */
+#define zypre_TiledBoxLoopInit(ndim, loop_size, num_arrays)                   \
+hypre__ndim = ndim;                                                           \
+hypre__tiled = hypre_HandleStructTiling(hypre_handle());                      \
+hypre__m = 1;                                                                 \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                       \
+{                                                                             \
+   hypre__n[hypre__d] = (hypre__d < hypre__ndim) ? loop_size[hypre__d] : 1;   \
+   hypre__m *= (hypre__d > 0) ? hypre__n[hypre__d] : 1;                       \
+}                                                                             \
+if (hypre__tiled)                                                             \
+{                                                                             \
+   hypre_BoxLoopGetTileSize(hypre__ndim, loop_size, num_arrays, hypre__ts);   \
+   hypre__num_tiles = 1;                                                      \
+   for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                    \
+   {                                                                          \
+      hypre__tn[hypre__d] = (hypre__n[hypre__d] + hypre__ts[hypre__d] - 1) /  \
+                            hypre__ts[hypre__d];                              \
+      hypre__num_tiles *= hypre__tn[hypre__d];                                \
+   }                                                                          \
+}                                                                             \
+else                                                                          \
+{                                                                             \
+   hypre__num_tiles = hypre_min(hypre_NumThreads(), hypre__m);                \
+   if (hypre__num_tiles > 0)                                                  \
+   {                                                                          \
+      hypre__div = hypre__m / hypre__num_tiles;                               \
+      hypre__mod = hypre__m % hypre__num_tiles;                               \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoopInitK(k, dboxk, startk, stridek)                    \
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk);                        \
+hypre__m = 1;                                                                 \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                       \
+{                                                                             \
+   hypre__sk##k[hypre__d] = 0;                                                \
+   if (hypre__d < hypre__ndim)                                                \
+   {                                                                          \
+      hypre__sk##k[hypre__d] = hypre__m * stridek[hypre__d];                  \
+      hypre__m *= hypre_BoxSizeD(dboxk, hypre__d);                            \
+   }                                                                          \
+}
+
+/* first (o) and last + 1 (e) loop index of the current tile in x, and its
+ * rows [rb, re), numbered from (o[1], o[2]) with w rows per plane */
+#define zypre_TiledBoxLoopSet()                                               \
+HYPRE_Int  hypre__I, hypre__J, hypre__K, hypre__t, hypre__dd;                 \
+HYPRE_Int  hypre__r, hypre__rb, hypre__re, hypre__w;                          \
+HYPRE_Int  hypre__o[HYPRE_MAXDIM], hypre__e[HYPRE_MAXDIM];                    \
+if (hypre__tiled)                                                             \
+{                                                                             \
+   hypre__t = hypre__tile;                                                    \
+   for (hypre__dd = 0; hypre__dd < HYPRE_MAXDIM; hypre__dd++)                 \
+   {                                                                          \
+      hypre__o[hypre__dd] = (hypre__t % hypre__tn[hypre__dd]) * hypre__ts[hypre__dd]; \
+      hypre__t /= hypre__tn[hypre__dd];                                       \
+      hypre__e[hypre__dd] = hypre_min(hypre__o[hypre__dd] + hypre__ts[hypre__dd], \
+                                      hypre__n[hypre__dd]);                   \
+   }                                                                          \
+   hypre__w  = hypre__e[1] - hypre__o[1];                                     \
+   hypre__rb = 0;                                                             \
+   hypre__re = hypre__w * (hypre__e[2] - hypre__o[2]);                        \
+}                                                                             \
+else                                                                          \
+{                                                                             \
+   for (hypre__dd = 0; hypre__dd < HYPRE_MAXDIM; hypre__dd++)                 \
+   {                                                                          \
+      hypre__o[hypre__dd] = 0;                                                \
+      hypre__e[hypre__dd] = hypre__n[hypre__dd];                              \
+   }                                                                          \
+   hypre__w  = hypre__n[1];                                                   \
+   hypre__rb = hypre__tile * hypre__div + hypre_min(hypre__mod, hypre__tile); \
+   hypre__re = hypre__rb + hypre__div + ((hypre__mod > hypre__tile) ? 1 : 0); \
+}
+
+#define zypre_TiledBoxLoopSetK(k, ik)                                         \
+ik = hypre__ikstart##k + hypre__o[0] * hypre__sk##k[0] +                      \
+     hypre__J * hypre__sk##k[1] + hypre__K * hypre__sk##k[2]
+
+#define zypre_TiledBoxLoopFor()                                               \
+   for (hypre__r = hypre__rb; hypre__r < hypre__re; hypre__r++)
+
+#define zypre_TiledBoxLoopSetRow()                                            \
+hypre__J = hypre__o[1] + hypre__r % hypre__w;                                 \
+hypre__K = hypre__o[2] + hypre__r / hypre__w
+
+#define zypre_TiledBoxLoop1Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 1);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop1End(i1)                                            \
+            i1 += hypre__sk1[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop2Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 2);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop2End(i1, i2)                                        \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop3Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 3);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop3End(i1, i2, i3)                                    \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+            i3 += hypre__sk3[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop4Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3,                  \
+                                 dbox4, start4, stride4, i4)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopDeclareK(4);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 4);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   zypre_TiledBoxLoopInitK(4, dbox4, start4, stride4);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, i4;                                               \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         zypre_TiledBoxLoopSetK(4, i4);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop4End(i1, i2, i3, i4)                                \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+            i3 += hypre__sk3[0];                                              \
+            i4 += hypre__sk4[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+/* Row version of the tiled BoxLoop3, for kernels that vectorize along rows
+ * themselves: the body is executed once per row segment of a tile, with i1,
+ * i2, i3 the indexes of its first point and nrow its number of points */
+#define zypre_TiledBoxLoop3RowsBegin(ndim, loop_size,                         \
+                                     dbox1, start1, stride1, i1,              \
+                                     dbox2, start2, stride2, i2,              \
+                                     dbox3, start3, stride3, i3, nrow)        \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 3);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, nrow;                                             \
+      zypre_TiledBoxLoopSet();                                                \
+      hypre__I = hypre__o[0];                                                 \
+      nrow = hypre__e[0] - hypre__I;                                          \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         {
+
+#define zypre_TiledBoxLoop3RowsEnd(i1, i2, i3)                                \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
 #define hypre_LoopBegin(size, idx)                                            \
 {                                                                             \
    HYPRE_Int idx;                                                             \
@@ -2892,6 +3250,17 @@ typedef struct hypre_Boxloop_struct
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
+#define hypre_BoxLoop1TiledBegin zypre_TiledBoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   zypre_TiledBoxLoop1End
+#define hypre_BoxLoop2TiledBegin zypre_TiledBoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   zypre_TiledBoxLoop2End
+#define hypre_BoxLoop3TiledBegin zypre_TiledBoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   zypre_TiledBoxLoop3End
+#define hypre_BoxLoop4TiledBegin zypre_TiledBoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   zypre_TiledBoxLoop4End
+#define hypre_BoxLoop3TiledRowsBegin zypre_TiledBoxLoop3RowsBegin
+#define hypre_BoxLoop3TiledRowsEnd   zypre_TiledBoxLoop3RowsEnd
+
 /* Reduction */
 #define hypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
         hypre_BoxLoop1Begin(ndim, loop_size, dbox1, start1, stride1, i1)
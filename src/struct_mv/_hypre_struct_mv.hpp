@@ -329,6 +329,16 @@ hypre_CheckErrorDevice(cudaDeviceSynchronize());
 
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
+
 /* Reduction */
 #define hypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
         hypre_BoxLoop1Begin(ndim, loop_size, dbox1, start1, stride1, i1)
@@ -721,6 +731,16 @@ struct ColumnSums
 #define hypre_BoxLoop4End        hypre_newBoxLoop4End
 
 #define hypre_BasicBoxLoop2Begin hypre_newBasicBoxLoop2Begin
+
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
 #endif
 
 #elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -1150,6 +1170,16 @@ else                                                            \
 #define hypre_BasicBoxLoop1Begin zypre_newBasicBoxLoop1Begin
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
+
 #endif /* #ifndef HYPRE_BOXLOOP_CUDA_HEADER */
 
 #elif defined(HYPRE_USING_SYCL)
@@ -1566,6 +1596,16 @@ else                                                            \
 #define hypre_BasicBoxLoop1Begin hypre_newBasicBoxLoop1Begin
 #define hypre_BasicBoxLoop2Begin hypre_newBasicBoxLoop2Begin
 
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
+
 /* Reduction */
 #define hypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
         hypre_newBoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum)
@@ -411,6 +411,104 @@ hypre_BoxGetStrideVolume( hypre_Box   *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Computes the tile size of a tiled BoxLoop (see boxloop_host.h) over a box
+ * of size loop_size that accesses num_arrays arrays.
+ *
+ * With tiling on, all dimensions but the last one are tiled, so that three
+ * consecutive planes of each array (the reuse window of a compact stencil)
+ * fit in cache while the last dimension is streamed through.  Rows (the x
+ * direction) are only cut if a single row is too long.  The last dimension
+ * is then split so that the number of tiles is a multiple of the number of
+ * threads.  With tiling off, only this split is done (the tiled BoxLoops
+ * then use the blocks of the regular BoxLoops instead).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxLoopGetTileSize( HYPRE_Int    ndim,
+                          hypre_Index  loop_size,
+                          HYPRE_Int    num_arrays,
+                          hypre_Index  tile_size )
+{
+   HYPRE_Int  *user_tile_size = hypre_HandleStructTileSize(hypre_handle());
+   HYPRE_Int   num_threads    = hypre_NumThreads();
+   HYPRE_Int   last           = ndim - 1;
+   HYPRE_Int   d, n, plane_size, num_tiles, num_splits, gcd, a, b;
+
+   for (d = 0; d < HYPRE_MAXDIM; d++)
+   {
+      hypre_IndexD(tile_size, d) = (d < ndim) ? hypre_max(hypre_IndexD(loop_size, d), 1) : 1;
+   }
+
+   if (hypre_HandleStructTiling(hypre_handle()) && last > 0)
+   {
+      /* number of points of one plane of one array that fit in cache */
+      plane_size = hypre_GetStructTileCacheSize() /
+                   (3 * hypre_max(num_arrays, 1) * (HYPRE_Int) sizeof(HYPRE_Complex));
+      plane_size = hypre_max(plane_size, 1);
+
+      if (last == 1)
+      {
+         hypre_IndexD(tile_size, 0) = hypre_min(hypre_IndexD(tile_size, 0), plane_size);
+      }
+      else
+      {
+         n = hypre_IndexD(tile_size, 0);
+         if (n > plane_size)
+         {
+            hypre_IndexD(tile_size, 0) = plane_size;
+            hypre_IndexD(tile_size, 1) = 1;
+         }
+         else
+         {
+            hypre_IndexD(tile_size, 1) = hypre_min(hypre_IndexD(tile_size, 1), plane_size / n);
+         }
+      }
+
+      /* user-defined tile sizes */
+      for (d = 0; d < hypre_min(last, 2); d++)
+      {
+         if (user_tile_size[d] > 0)
+         {
+            hypre_IndexD(tile_size, d) = hypre_min(hypre_IndexD(tile_size, d), user_tile_size[d]);
+         }
+      }
+   }
+
+   /* split the last dimension for the threads */
+   if (num_threads > 1)
+   {
+      num_tiles = 1;
+      for (d = 0; d < last; d++)
+      {
+         n = hypre_max(hypre_IndexD(loop_size, d), 1);
+         num_tiles *= (n + hypre_IndexD(tile_size, d) - 1) / hypre_IndexD(tile_size, d);
+      }
+
+      /* num_splits = num_threads / gcd(num_tiles, num_threads) */
+      a = num_tiles;
+      b = num_threads;
+      while (b > 0)
+      {
+         gcd = a % b;
+         a = b;
+         b = gcd;
+      }
+      num_splits = num_threads / a;
+
+      /* split the last dimension, then the next ones if it is too short
+       * (rows are not split, except in 1D) */
+      for (d = last; d >= hypre_min(last, 1) && num_splits > 1; d--)
+      {
+         n = hypre_min(num_splits, hypre_IndexD(tile_size, d));
+         hypre_IndexD(tile_size, d) = (hypre_IndexD(tile_size, d) + n - 1) / n;
+         num_splits = (num_splits + n - 1) / n;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Returns the rank of an index into a multi-D box where the assumed ordering is
  * dimension 0 first, then dimension 1, etc.
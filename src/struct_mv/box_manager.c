@@ -208,9 +208,6 @@ hypre_BoxManEntryCopy( hypre_BoxManEntry *fromentry,
 
    /* position - we don't copy this! */
 
-   /* copy list pointer */
-   hypre_BoxManEntryNext(toentry) =  hypre_BoxManEntryNext(fromentry);
-
    return hypre_error_flag;
 }
 
@@ -434,7 +431,7 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManager   *manager;
    hypre_Box          *bbox;
 
-   HYPRE_Int  i, d;
+   HYPRE_Int  i;
    /* allocate object */
    manager = hypre_CTAlloc(hypre_BoxManager,  1, HYPRE_MEMORY_HOST);
 
@@ -445,18 +442,15 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManNDim(manager) = ndim;
    hypre_BoxManIsAssembled(manager) = 0;
 
-   for (d = 0; d < ndim; d++)
-   {
-      hypre_BoxManIndexesD(manager, d) = NULL;
-   }
-
    hypre_BoxManNEntries(manager) = 0;
    hypre_BoxManEntries(manager)  = hypre_CTAlloc(hypre_BoxManEntry,  max_nentries, HYPRE_MEMORY_HOST);
 
    hypre_BoxManInfoObjects(manager) = NULL;
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries * info_size, HYPRE_MEMORY_HOST);
 
-   hypre_BoxManIndexTable(manager) = NULL;
+   hypre_BoxManBVHNodes(manager)  = NULL;
+   hypre_BoxManBVHNNodes(manager) = 0;
+   hypre_BoxManBVHOrder(manager)  = NULL;
 
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -561,21 +555,14 @@ hypre_BoxManIncSize ( hypre_BoxManager *manager,
 HYPRE_Int
 hypre_BoxManDestroy( hypre_BoxManager *manager )
 {
-   HYPRE_Int ndim = hypre_BoxManNDim(manager);
-   HYPRE_Int d;
-
    if (manager)
    {
-      for (d = 0; d < ndim; d++)
-      {
-         hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
-      }
-
       hypre_TFree(hypre_BoxManEntries(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
 
-      hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManBVHNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManBVHOrder(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -724,7 +711,6 @@ hypre_BoxManAddEntry( hypre_BoxManager *manager,
       {
          hypre_BoxManEntryNumGhost(entry)[d] = num_ghost[d];
       }
-      hypre_BoxManEntryNext(entry) = NULL;
 
       /* add proc and id to procs_sort and ids_sort array */
       hypre_BoxManProcsSort(manager)[nentries] = proc_id;
@@ -1082,6 +1068,227 @@ hypre_BoxManGatherEntries(hypre_BoxManager *manager,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Recursively build the bounding volume hierarchy over the entries listed in
+ * order[lo], ..., order[hi-1].  Each interior node splits its entries at the
+ * median box center along the direction where the centers are most spread
+ * out, so the tree depth is O(log n).  The 'keys' array is workspace of the
+ * same size as 'order'.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_BOXMAN_BVH_LEAF_SIZE  4
+#define HYPRE_BOXMAN_BVH_MAX_DEPTH  64
+
+static HYPRE_Int
+hypre_BoxManBVHBuild( HYPRE_Int            ndim,
+                      hypre_BoxManEntry   *entries,
+                      HYPRE_Int           *order,
+                      HYPRE_Int           *keys,
+                      HYPRE_Int            lo,
+                      HYPRE_Int            hi,
+                      hypre_BoxManBVHNode *nodes,
+                      HYPRE_Int           *nnodes_ptr )
+{
+   hypre_BoxManBVHNode *node;
+   hypre_BoxManEntry   *entry;
+   HYPRE_Int            cmin[HYPRE_MAXDIM];
+   HYPRE_Int            cmax[HYPRE_MAXDIM];
+   HYPRE_Int            center, split_d, i, j, d, mid;
+   HYPRE_Int            left, right, pivot;
+
+   node = &nodes[*nnodes_ptr];
+   (*nnodes_ptr)++;
+
+   /* compute the node bounding box and the range of the box centers */
+   for (i = lo; i < hi; i++)
+   {
+      entry = &entries[order[i]];
+      for (d = 0; d < ndim; d++)
+      {
+         center = hypre_BoxManEntryIMin(entry)[d] +
+                  (hypre_BoxManEntryIMax(entry)[d] - hypre_BoxManEntryIMin(entry)[d]) / 2;
+         if (i == lo)
+         {
+            node -> imin[d] = hypre_BoxManEntryIMin(entry)[d];
+            node -> imax[d] = hypre_BoxManEntryIMax(entry)[d];
+            cmin[d] = center;
+            cmax[d] = center;
+         }
+         else
+         {
+            node -> imin[d] = hypre_min(node -> imin[d], hypre_BoxManEntryIMin(entry)[d]);
+            node -> imax[d] = hypre_max(node -> imax[d], hypre_BoxManEntryIMax(entry)[d]);
+            cmin[d] = hypre_min(cmin[d], center);
+            cmax[d] = hypre_max(cmax[d], center);
+         }
+      }
+   }
+
+   if ((hi - lo) <= HYPRE_BOXMAN_BVH_LEAF_SIZE)
+   {
+      node -> first = lo;
+      node -> count = hi - lo;
+      return hypre_error_flag;
+   }
+
+   split_d = 0;
+   for (d = 1; d < ndim; d++)
+   {
+      if ((cmax[d] - cmin[d]) > (cmax[split_d] - cmin[split_d]))
+      {
+         split_d = d;
+      }
+   }
+
+   /* partition about the median box center along split_d (quickselect) */
+   for (i = lo; i < hi; i++)
+   {
+      entry = &entries[order[i]];
+      keys[i] = hypre_BoxManEntryIMin(entry)[split_d] +
+                (hypre_BoxManEntryIMax(entry)[split_d] -
+                 hypre_BoxManEntryIMin(entry)[split_d]) / 2;
+   }
+   mid = lo + (hi - lo) / 2;
+   left = lo;
+   right = hi - 1;
+   while (left < right)
+   {
+      pivot = keys[(left + right) / 2];
+      i = left;
+      j = right;
+      while (i <= j)
+      {
+         while (keys[i] < pivot) { i++; }
+         while (keys[j] > pivot) { j--; }
+         if (i <= j)
+         {
+            hypre_swap2i(keys, order, i, j);
+            i++;
+            j--;
+         }
+      }
+      if (mid <= j)
+      {
+         right = j;
+      }
+      else if (mid >= i)
+      {
+         left = i;
+      }
+      else
+      {
+         break;
+      }
+   }
+
+   node -> count = 0;
+   hypre_BoxManBVHBuild(ndim, entries, order, keys, lo, mid, nodes, nnodes_ptr);
+   node -> first = *nnodes_ptr;
+   hypre_BoxManBVHBuild(ndim, entries, order, keys, mid, hi, nodes, nnodes_ptr);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Append to 'found' the positions (in the entries array) of all entries that
+ * intersect the box [ilower, iupper].  The 'found' array is reallocated as
+ * needed, and the number of positions found is returned in 'nfound_ptr'.  The
+ * positions are not sorted.
+ *
+ * If iupper[d] < ilower[d], the box is treated as the plane ilower[d] in that
+ * direction.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManBVHQuery( hypre_BoxManager  *manager,
+                      hypre_Index        ilower,
+                      hypre_Index        iupper,
+                      HYPRE_Int        **found_ptr,
+                      HYPRE_Int         *found_alloc_ptr,
+                      HYPRE_Int         *nfound_ptr )
+{
+   HYPRE_Int            ndim      = hypre_BoxManNDim(manager);
+   hypre_BoxManEntry   *entries   = hypre_BoxManEntries(manager);
+   hypre_BoxManBVHNode *nodes     = hypre_BoxManBVHNodes(manager);
+   HYPRE_Int           *order     = hypre_BoxManBVHOrder(manager);
+   HYPRE_Int           *found     = *found_ptr;
+   HYPRE_Int            found_alloc = *found_alloc_ptr;
+   HYPRE_Int            nfound    = *nfound_ptr;
+
+   hypre_BoxManBVHNode *node;
+   hypre_BoxManEntry   *entry;
+   hypre_Index          qlower, qupper;
+   HYPRE_Int            stack[HYPRE_BOXMAN_BVH_MAX_DEPTH];
+   HYPRE_Int            nstack, i, d;
+
+   if (hypre_BoxManBVHNNodes(manager) == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   for (d = 0; d < ndim; d++)
+   {
+      qlower[d] = ilower[d];
+      qupper[d] = hypre_max(iupper[d], ilower[d]);
+   }
+
+   nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0)
+   {
+      node = &nodes[stack[--nstack]];
+
+      for (d = 0; d < ndim; d++)
+      {
+         if ((qupper[d] < node -> imin[d]) || (qlower[d] > node -> imax[d]))
+         {
+            break;
+         }
+      }
+      if (d < ndim)
+      {
+         continue;
+      }
+
+      if (node -> count)
+      {
+         for (i = node -> first; i < (node -> first + node -> count); i++)
+         {
+            entry = &entries[order[i]];
+            for (d = 0; d < ndim; d++)
+            {
+               if ((qupper[d] < hypre_BoxManEntryIMin(entry)[d]) ||
+                   (qlower[d] > hypre_BoxManEntryIMax(entry)[d]))
+               {
+                  break;
+               }
+            }
+            if (d == ndim)
+            {
+               if (nfound == found_alloc)
+               {
+                  found_alloc = 2 * found_alloc + 8;
+                  found = hypre_TReAlloc(found, HYPRE_Int, found_alloc, HYPRE_MEMORY_HOST);
+               }
+               found[nfound++] = order[i];
+            }
+         }
+      }
+      else
+      {
+         /* the left child immediately follows its parent */
+         stack[nstack++] = node -> first;
+         stack[nstack++] = (HYPRE_Int) (node - nodes) + 1;
+      }
+   }
+
+   *found_ptr       = found;
+   *found_alloc_ptr = found_alloc;
+   *nfound_ptr      = nfound;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * In the assemble, we populate the local box manager with global box
  * information to be used by calls to BoxManIntersect().  Global box information
@@ -1134,7 +1341,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    HYPRE_Int  is_gather, global_is_gather;
    HYPRE_Int  nentries;
    HYPRE_Int *procs_sort, *ids_sort;
-   HYPRE_Int  i, j, k;
+   HYPRE_Int  i, j;
 
    HYPRE_Int need_to_sort = 1; /* default it to sort */
    //HYPRE_Int short_sort = 0; /*do abreviated sort */
@@ -2209,213 +2416,61 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
       }
    }
 
-   /*------------------------------INDEX TABLE ---------------------------*/
+   /*------------------------------BVH ------------------------------------*/
 
-   /* now build the index_table and indexes array */
-   /* Note: for now we are using the same scheme as in BoxMap  */
+   /* now build the bounding volume hierarchy over the entries (empty entries
+      can never be intersected, so they are left out) */
    {
-      HYPRE_Int *indexes[HYPRE_MAXDIM];
-      HYPRE_Int  size[HYPRE_MAXDIM];
-      HYPRE_Int  iminmax[2];
-      HYPRE_Int  index_not_there;
-      HYPRE_Int  d, e, itsize;
-      HYPRE_Int  mystart, myfinish;
-      HYPRE_Int  imin[HYPRE_MAXDIM];
-      HYPRE_Int  imax[HYPRE_MAXDIM];
-      HYPRE_Int  start_loop[HYPRE_MAXDIM];
-      HYPRE_Int  end_loop[HYPRE_MAXDIM];
-      HYPRE_Int  loop, range, loop_num;
-      HYPRE_Int *proc_offsets;
+      hypre_BoxManBVHNode *bvh_nodes = NULL;
+      HYPRE_Int           *bvh_order;
+      HYPRE_Int            bvh_nnodes = 0;
+      HYPRE_Int           *keys;
+      HYPRE_Int            d, e, nbvh;
+      hypre_IndexRef       entry_imin;
+      hypre_IndexRef       entry_imax;
 
-      HYPRE_Int location, spot;
-
-      hypre_BoxManEntry  **index_table;
-      hypre_BoxManEntry   *entry;
-      hypre_Box           *index_box, *table_box;
-      hypre_Index          stride, loop_size;
-
-      hypre_IndexRef entry_imin;
-      hypre_IndexRef entry_imax;
-
-      /* initial */
-      nentries     = hypre_BoxManNEntries(manager);
-      entries      = hypre_BoxManEntries(manager);
-      proc_offsets = hypre_BoxManProcsSortOffsets(manager);
+      nentries = hypre_BoxManNEntries(manager);
+      entries  = hypre_BoxManEntries(manager);
 
-      /*------------------------------------------------------
-       * Set up the indexes array and record the processor's
-       * entries. This will be used in ordering the link list
-       * of BoxManEntry- ones on this processor listed first.
-       *------------------------------------------------------*/
-      itsize = 0;
-      for (d = 0; d < ndim; d++)
-      {
-         /* room for min and max of each entry in each dim */
-         indexes[d] = hypre_CTAlloc(HYPRE_Int,  2 * nentries, HYPRE_MEMORY_HOST);
-         size[d] = 0;
-      }
-      /* loop through each entry and get index */
+      bvh_order = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      nbvh = 0;
       for (e = 0; e < nentries; e++)
       {
-         entry  = &entries[e]; /* grab the entry - get min and max extents */
-         entry_imin = hypre_BoxManEntryIMin(entry);
-         entry_imax = hypre_BoxManEntryIMax(entry);
-
-         /* in each dim, check if min/max positions are already in the table */
+         entry_imin = hypre_BoxManEntryIMin(&entries[e]);
+         entry_imax = hypre_BoxManEntryIMax(&entries[e]);
          for (d = 0; d < ndim; d++)
          {
-            iminmax[0] = hypre_IndexD(entry_imin, d);
-            iminmax[1] = hypre_IndexD(entry_imax, d) + 1;
-
-            /* do the min then the max */
-            for (i = 0; i < 2; i++)
+            if (hypre_IndexD(entry_imax, d) < hypre_IndexD(entry_imin, d))
             {
-               /* find the new index position in the indexes array */
-               index_not_there = 1;
-
-               if (!i)
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], 0,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-               else /* for max, we can start seach at min position */
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], j,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-
-               /* if the index is already there, don't add it again */
-               if (index_not_there)
-               {
-                  for (k = size[d]; k > j; k--) /* make room for new index */
-                  {
-                     indexes[d][k] = indexes[d][k - 1];
-                  }
-                  indexes[d][j] = iminmax[i];
-                  size[d]++; /* increase the size in that dimension */
-               }
-            } /* end of for min and max */
-         } /* end of for each dimension of the entry */
-      } /* end of for each entry loop */
-
-      if (nentries)
-      {
-         itsize = 1;
-         for (d = 0; d < ndim; d++)
+               break;
+            }
+         }
+         if (d == ndim)
          {
-            size[d]--;
-            itsize *= size[d];
+            bvh_order[nbvh++] = e;
          }
       }
 
-      /*------------------------------------------------------
-       * Set up the table - do offprocessor then on-processor
-       *------------------------------------------------------*/
-
-      /* allocate space for table */
-      index_table = hypre_CTAlloc(hypre_BoxManEntry *,  itsize, HYPRE_MEMORY_HOST);
-
-      index_box = hypre_BoxCreate(ndim);
-      table_box = hypre_BoxCreate(ndim);
-
-      /* create a table_box for use below */
-      hypre_SetIndex(stride, 1);
-      hypre_BoxSetExtents(table_box, stride, size);
-      hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
-
-      /* which are my entries? (on-processor) */
-      mystart = hypre_BoxManFirstLocal(manager);
-      if (mystart >= 0 ) /*  we have local entries) because
-                             firstlocal = -1 if no local entries */
-      {
-         loop_num = 3;
-         /* basically we have need to do the same code fragment repeated three
-            times so that we can do off-proc then on proc entries - this
-            ordering is because creating the linked list for overlapping
-            boxes */
-
-         myfinish =  proc_offsets[hypre_BoxManLocalProcOffset(manager) + 1];
-         /* #1 do off proc. entries - lower range */
-         start_loop[0] = 0;
-         end_loop[0] = mystart;
-         /* #2 do off proc. entries - upper range */
-         start_loop[1] = myfinish;
-         end_loop[1] = nentries;
-         /* #3 do ON proc. entries */
-         start_loop[2] = mystart;
-         end_loop[2] = myfinish;
-      }
-      else /* no on-proc entries */
+      if (nbvh)
       {
-         loop_num = 1;
-         start_loop[0] = 0;
-         end_loop[0] = nentries;
+         /* a binary tree with at most nbvh leaves has fewer than 2*nbvh nodes */
+         keys      = hypre_TAlloc(HYPRE_Int, nbvh, HYPRE_MEMORY_HOST);
+         bvh_nodes = hypre_TAlloc(hypre_BoxManBVHNode, 2 * nbvh, HYPRE_MEMORY_HOST);
+         hypre_BoxManBVHBuild(ndim, entries, bvh_order, keys, 0, nbvh,
+                              bvh_nodes, &bvh_nnodes);
+         bvh_nodes = hypre_TReAlloc(bvh_nodes, hypre_BoxManBVHNode, bvh_nnodes,
+                                    HYPRE_MEMORY_HOST);
+         hypre_TFree(keys, HYPRE_MEMORY_HOST);
       }
 
-      for (loop = 0; loop < loop_num; loop++)
-      {
-         for (range = start_loop[loop]; range < end_loop[loop]; range++)
-         {
-            entry = &entries[range];
-            entry_imin = hypre_BoxManEntryIMin(entry);
-            entry_imax = hypre_BoxManEntryIMax(entry);
+      /* in case this is a re-assemble - shouldn't be though */
+      hypre_TFree(hypre_BoxManBVHNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManBVHOrder(manager), HYPRE_MEMORY_HOST);
+      hypre_BoxManBVHNodes(manager)  = bvh_nodes;
+      hypre_BoxManBVHNNodes(manager) = bvh_nnodes;
+      hypre_BoxManBVHOrder(manager)  = bvh_order;
 
-            /* find the indexes corresponding to the current box - put in imin
-               and imax */
-            for (d = 0; d < ndim; d++)
-            {
-               /* need to go to size[d] because that contains the last element */
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imin, d), 0, size[d], &spot);
-               hypre_IndexD(imin, d) = location;
-
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imax, d) + 1, 0, size[d], &spot);
-               hypre_IndexD(imax, d) = location - 1;
-
-            } /* now have imin and imax location in index array*/
-
-            /* set up index table */
-            hypre_BoxSetExtents(index_box, imin, imax);
-            hypre_BoxGetSize(index_box, loop_size);
-            hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, imin, stride, ii);
-            {
-               if (!index_table[ii]) /* no entry- add one */
-               {
-                  index_table[ii] = entry;
-               }
-               else /* already an entry there - so add to link list for
-                       BoxMapEntry - overlapping */
-               {
-                  hypre_BoxManEntryNext(entry) = index_table[ii];
-                  index_table[ii] = entry;
-               }
-            }
-            hypre_SerialBoxLoop1End(ii);
-
-         } /* end of subset of entries */
-      }/* end of three loops over subsets */
-
-      /* done with the index_table! */
-      hypre_TFree( hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST); /* in case this is a
-                                                        re-assemble - shouldn't
-                                                        be though */
-      hypre_BoxManIndexTable(manager) = index_table;
-
-      for (d = 0; d < ndim; d++)
-      {
-         hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
-         hypre_BoxManIndexesD(manager, d) = indexes[d];
-         hypre_BoxManSizeD(manager, d) = size[d];
-         hypre_BoxManLastIndexD(manager, d) = 0;
-      }
-
-      hypre_BoxDestroy(index_box);
-      hypre_BoxDestroy(table_box);
-
-   } /* end of building index table group */
+   } /* end of building BVH group */
 
    /* clean up and update*/
 
@@ -2434,8 +2489,9 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 /*--------------------------------------------------------------------------
  * Given a box (lower and upper indices), return a list of boxes in the global
  * grid that are intersected by this box. The user must insure that a processor
- * owns the correct global information to do the intersection. For now this is
- * virtually the same as the box map intersect.
+ * owns the correct global information to do the intersection. The entries are
+ * found by descending the bounding volume hierarchy built in the assemble, and
+ * are returned in the order of the entries array (sorted by proc, then id).
  *
  * Notes:
  *
@@ -2453,25 +2509,12 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
                         hypre_BoxManEntry ***entries_ptr,
                         HYPRE_Int *nentries_ptr )
 {
-   HYPRE_Int           ndim = hypre_BoxManNDim(manager);
-   HYPRE_Int           d;
-   HYPRE_Int           find_index_d, current_index_d;
-   HYPRE_Int          *man_indexes_d;
-   HYPRE_Int           man_index_size_d;
-   HYPRE_Int           nentries;
-   HYPRE_Int          *marker, position;
-   hypre_Box          *index_box, *table_box;
-   hypre_Index         stride, loop_size;
-   hypre_Index         man_ilower, man_iupper;
-   hypre_BoxManEntry **index_table;
+   hypre_BoxManEntry  *man_entries = hypre_BoxManEntries(manager);
    hypre_BoxManEntry **entries;
-   hypre_BoxManEntry  *entry;
-
-#if 0
-   HYPRE_Int   i, cnt;
-   HYPRE_Int  *proc_ids, *ids, *unsort;
-   HYPRE_Int   tmp_id, start;
-#endif
+   HYPRE_Int          *found = NULL;
+   HYPRE_Int           found_alloc = 0;
+   HYPRE_Int           nentries = 0;
+   HYPRE_Int           i;
 
    /* can only use after assembling */
    if (!hypre_BoxManIsAssembled(manager))
@@ -2480,131 +2523,84 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
-   /* Check whether the box manager contains any entries */
-   if (hypre_BoxManNEntries(manager) == 0)
-   {
-      *entries_ptr  = NULL;
-      *nentries_ptr = 0;
-      return hypre_error_flag;
-   }
+   hypre_BoxManBVHQuery(manager, ilower, iupper, &found, &found_alloc, &nentries);
 
-   /* Loop through each dimension */
-   for (d = 0; d < ndim; d++)
+   /* return the entries in the order of the (sorted) entries array */
+   entries = NULL;
+   if (nentries)
    {
-      /* Initialize */
-      man_ilower[d] = 0;
-      man_iupper[d] = 0;
-
-      man_indexes_d = hypre_BoxManIndexesD(manager, d);
-      man_index_size_d = hypre_BoxManSizeD(manager, d);
-
-      /* -----find location of ilower[d] in  indexes-----*/
-      find_index_d = hypre_IndexD(ilower, d);
-
-      /* Start looking in place indicated by last_index stored in map */
-      current_index_d = hypre_BoxManLastIndexD(manager, d);
-
-      /* Loop downward if target index is less than current location */
-      while ( (current_index_d >= 0 ) &&
-              (find_index_d < man_indexes_d[current_index_d]) )
-      {
-         current_index_d --;
-      }
-
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
-      {
-         current_index_d ++;
-      }
-
-      if ( current_index_d > (man_index_size_d - 1) )
-      {
-         *entries_ptr  = NULL;
-         *nentries_ptr = 0;
-         return hypre_error_flag;
-      }
-      else
-      {
-         man_ilower[d] = hypre_max(current_index_d, 0);
-      }
-
-      /* -----find location of iupper[d] in  indexes-----*/
-
-      find_index_d = hypre_IndexD(iupper, d);
-
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
-      {
-         current_index_d ++;
-      }
-      if ( current_index_d < 0 )
-      {
-         *entries_ptr  = NULL;
-         *nentries_ptr = 0;
-         return hypre_error_flag;
-      }
-      else
+      hypre_qsort0(found, 0, nentries - 1);
+      entries = hypre_TAlloc(hypre_BoxManEntry *, nentries, HYPRE_MEMORY_HOST);
+      for (i = 0; i < nentries; i++)
       {
-         man_iupper[d] = hypre_min(current_index_d, (man_index_size_d - 1));
+         entries[i] = &man_entries[found[i]];
       }
    }
+   hypre_TFree(found, HYPRE_MEMORY_HOST);
 
-   /*-----------------------------------------------------------------
-    * If we reach this point, then set up the entries array.
-    * Use a marker array to ensure unique entries.
-    *-----------------------------------------------------------------*/
+   *entries_ptr  = entries;
+   *nentries_ptr = nentries;
 
-   nentries = hypre_BoxManMaxNEntries(manager);
-   entries  = hypre_CTAlloc(hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST); /* realloc below */
-   marker   = hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
-   index_table = hypre_BoxManIndexTable(manager);
+   return hypre_error_flag;
+}
 
-   nentries = 0;
+/*--------------------------------------------------------------------------
+ * Batched version of hypre_BoxManIntersect().  Intersect each box in 'boxes'
+ * with the box manager and return the results in CSR format: the entries
+ * intersected by box i are entries[offsets[i]], ..., entries[offsets[i+1]-1].
+ * The entries for each box are ordered as in hypre_BoxManIntersect().  The
+ * user is responsible for freeing both arrays.
+ *--------------------------------------------------------------------------*/
 
-   table_box = hypre_BoxCreate(ndim);
-   index_box = hypre_BoxCreate(ndim);
+HYPRE_Int
+hypre_BoxManIntersectBoxArray( hypre_BoxManager *manager,
+                               hypre_BoxArray *boxes,
+                               hypre_BoxManEntry ***entries_ptr,
+                               HYPRE_Int **offsets_ptr )
+{
+   hypre_BoxManEntry  *man_entries = hypre_BoxManEntries(manager);
+   hypre_BoxManEntry **entries;
+   hypre_Box          *box;
+   HYPRE_Int          *offsets;
+   HYPRE_Int          *found = NULL;
+   HYPRE_Int           found_alloc = 0;
+   HYPRE_Int           nfound = 0;
+   HYPRE_Int           b, i;
 
-   hypre_SetIndex(stride, 1);
-   hypre_BoxSetExtents(table_box, stride, hypre_BoxManSize(manager));
-   hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
-   hypre_BoxSetExtents(index_box, man_ilower, man_iupper);
-   hypre_BoxGetSize(index_box, loop_size);
-   hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, man_ilower, stride, ii);
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
    {
-      entry = index_table[ii];
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
 
-      while (entry != NULL)
+   offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(boxes) + 1, HYPRE_MEMORY_HOST);
+   offsets[0] = 0;
+   hypre_ForBoxI(b, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, b);
+      hypre_BoxManBVHQuery(manager, hypre_BoxIMin(box), hypre_BoxIMax(box),
+                           &found, &found_alloc, &nfound);
+      if (nfound > offsets[b])
       {
-         position = hypre_BoxManEntryPosition(entry);
-
-         if (marker[position] == 0) /* Add entry and mark as added */
-         {
-            entries[nentries] = entry;
-            marker[position]  = 1;
-            nentries++;
-         }
-
-         entry = hypre_BoxManEntryNext(entry);
+         hypre_qsort0(found, offsets[b], nfound - 1);
       }
+      offsets[b + 1] = nfound;
    }
-   hypre_SerialBoxLoop1End(ii);
-
-   entries  = hypre_TReAlloc(entries,  hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST);
 
-   /* Reset the last index in the manager */
-   for (d = 0; d < ndim; d++)
+   entries = NULL;
+   if (nfound)
    {
-      hypre_BoxManLastIndexD(manager, d) = man_ilower[d];
+      entries = hypre_TAlloc(hypre_BoxManEntry *, nfound, HYPRE_MEMORY_HOST);
+      for (i = 0; i < nfound; i++)
+      {
+         entries[i] = &man_entries[found[i]];
+      }
    }
+   hypre_TFree(found, HYPRE_MEMORY_HOST);
 
-   hypre_BoxDestroy(table_box);
-   hypre_BoxDestroy(index_box);
-   hypre_TFree(marker, HYPRE_MEMORY_HOST);
-
-   *entries_ptr  = entries;
-   *nentries_ptr = nentries;
+   *entries_ptr = entries;
+   *offsets_ptr = offsets;
 
    return hypre_error_flag;
 }
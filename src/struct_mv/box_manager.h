@@ -28,10 +28,24 @@ typedef struct hypre_BoxManEntry_struct
 
    void *boxman; /* The owning manager (populated in addentry) */
 
-   struct hypre_BoxManEntry_struct  *next;
-
 } hypre_BoxManEntry;
 
+/*---------------------------------------------------------------------------
+ * Box Manager BVH node: a node of the bounding volume hierarchy built over
+ * the entries in the assemble.  Nodes are stored depth-first, so the left
+ * child of an interior node immediately follows it.
+ *----------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int imin[HYPRE_MAXDIM]; /* Bounding box of the entries below */
+   HYPRE_Int imax[HYPRE_MAXDIM];
+   HYPRE_Int first; /* Leaf: start in the bvh_order array.  Interior: index
+                       of the right child */
+   HYPRE_Int count; /* Leaf: number of entries.  Interior: 0 */
+
+} hypre_BoxManBVHNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -88,18 +102,11 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
-   HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
-                                                 imax of each box in the entries
-                                                 array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   /* Here is the hierarchy that organizes the entries spatially */
+   hypre_BoxManBVHNode *bvh_nodes; /* Tree nodes (root is node 0) */
+   HYPRE_Int            bvh_nnodes; /* Number of tree nodes */
+   HYPRE_Int           *bvh_order; /* Positions into the 'entries' array,
+                                      grouped by leaf */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -152,10 +159,9 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
-#define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
-#define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManBVHNodes(manager)           ((manager) -> bvh_nodes)
+#define hypre_BoxManBVHNNodes(manager)          ((manager) -> bvh_nnodes)
+#define hypre_BoxManBVHOrder(manager)           ((manager) -> bvh_order)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -168,10 +174,6 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
-#define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
-#define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
-
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
 
@@ -186,7 +188,6 @@ typedef struct
 #define hypre_BoxManEntryId(entry)       ((entry) -> id)
 #define hypre_BoxManEntryPosition(entry) ((entry) -> position)
 #define hypre_BoxManEntryNumGhost(entry) ((entry) -> num_ghost)
-#define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
 #endif
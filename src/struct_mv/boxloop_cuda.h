@@ -424,4 +424,14 @@ else                                                            \
 #define hypre_BasicBoxLoop1Begin zypre_newBasicBoxLoop1Begin
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
+/* tiling is only done by the host BoxLoops (boxloop_host.h) */
+#define hypre_BoxLoop1TiledBegin hypre_BoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   hypre_BoxLoop1End
+#define hypre_BoxLoop2TiledBegin hypre_BoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   hypre_BoxLoop2End
+#define hypre_BoxLoop3TiledBegin hypre_BoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   hypre_BoxLoop3End
+#define hypre_BoxLoop4TiledBegin hypre_BoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   hypre_BoxLoop4End
+
 #endif /* #ifndef HYPRE_BOXLOOP_CUDA_HEADER */
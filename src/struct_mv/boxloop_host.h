@@ -238,6 +238,286 @@ typedef struct hypre_Boxloop_struct
          {
 
 
+/*--------------------------------------------------------------------------
+ * Tiled BoxLoops
+ *
+ * Same arguments and semantics as the BoxLoops above, but the iteration space
+ * is cut into tiles (see hypre_BoxLoopGetTileSize) that are distributed over
+ * the threads, and each tile is traversed plane by plane.  This improves the
+ * cache reuse of stencil sweeps over large boxes.  Tiling is off by default
+ * (see HYPRE_SetStructTiling), and the loops then run as the BoxLoops above.
+ * The loop body must not depend on the iteration order, and
+ * hypre_BoxLoopGetIndex cannot be used.
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TiledBoxLoopDeclare()                                           \
+HYPRE_Int  hypre__d, hypre__ndim, hypre__m, hypre__tiled;                     \
+HYPRE_Int  hypre__tile, hypre__num_tiles, hypre__div = 0, hypre__mod = 0;     \
+HYPRE_Int  hypre__n[HYPRE_MAXDIM], hypre__tn[HYPRE_MAXDIM] = {0};             \
+hypre_Index hypre__ts = {0}
+
+#define zypre_TiledBoxLoopDeclareK(k)                                         \
+HYPRE_Int  hypre__ikstart##k, hypre__sk##k[HYPRE_MAXDIM]
+
+/* With tiling off, the "tiles" are the blocks of rows of the regular BoxLoops,
+ * so that the loops are distributed and traversed in the same way */
+#define zypre_TiledBoxLoopInit(ndim, loop_size, num_arrays)                   \
+hypre__ndim = ndim;                                                           \
+hypre__tiled = hypre_HandleStructTiling(hypre_handle());                      \
+hypre__m = 1;                                                                 \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                       \
+{                                                                             \
+   hypre__n[hypre__d] = (hypre__d < hypre__ndim) ? loop_size[hypre__d] : 1;   \
+   hypre__m *= (hypre__d > 0) ? hypre__n[hypre__d] : 1;                       \
+}                                                                             \
+if (hypre__tiled)                                                             \
+{                                                                             \
+   hypre_BoxLoopGetTileSize(hypre__ndim, loop_size, num_arrays, hypre__ts);   \
+   hypre__num_tiles = 1;                                                      \
+   for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                    \
+   {                                                                          \
+      hypre__tn[hypre__d] = (hypre__n[hypre__d] + hypre__ts[hypre__d] - 1) /  \
+                            hypre__ts[hypre__d];                              \
+      hypre__num_tiles *= hypre__tn[hypre__d];                                \
+   }                                                                          \
+}                                                                             \
+else                                                                          \
+{                                                                             \
+   hypre__num_tiles = hypre_min(hypre_NumThreads(), hypre__m);                \
+   if (hypre__num_tiles > 0)                                                  \
+   {                                                                          \
+      hypre__div = hypre__m / hypre__num_tiles;                               \
+      hypre__mod = hypre__m % hypre__num_tiles;                               \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoopInitK(k, dboxk, startk, stridek)                    \
+hypre__ikstart##k = hypre_BoxIndexRank(dboxk, startk);                        \
+hypre__m = 1;                                                                 \
+for (hypre__d = 0; hypre__d < HYPRE_MAXDIM; hypre__d++)                       \
+{                                                                             \
+   hypre__sk##k[hypre__d] = 0;                                                \
+   if (hypre__d < hypre__ndim)                                                \
+   {                                                                          \
+      hypre__sk##k[hypre__d] = hypre__m * stridek[hypre__d];                  \
+      hypre__m *= hypre_BoxSizeD(dboxk, hypre__d);                            \
+   }                                                                          \
+}
+
+/* first (o) and last + 1 (e) loop index of the current tile in x, and its
+ * rows [rb, re), numbered from (o[1], o[2]) with w rows per plane */
+#define zypre_TiledBoxLoopSet()                                               \
+HYPRE_Int  hypre__I, hypre__J, hypre__K, hypre__t, hypre__dd;                 \
+HYPRE_Int  hypre__r, hypre__rb, hypre__re, hypre__w;                          \
+HYPRE_Int  hypre__o[HYPRE_MAXDIM], hypre__e[HYPRE_MAXDIM];                    \
+if (hypre__tiled)                                                             \
+{                                                                             \
+   hypre__t = hypre__tile;                                                    \
+   for (hypre__dd = 0; hypre__dd < HYPRE_MAXDIM; hypre__dd++)                 \
+   {                                                                          \
+      hypre__o[hypre__dd] = (hypre__t % hypre__tn[hypre__dd]) * hypre__ts[hypre__dd]; \
+      hypre__t /= hypre__tn[hypre__dd];                                       \
+      hypre__e[hypre__dd] = hypre_min(hypre__o[hypre__dd] + hypre__ts[hypre__dd], \
+                                      hypre__n[hypre__dd]);                   \
+   }                                                                          \
+   hypre__w  = hypre__e[1] - hypre__o[1];                                     \
+   hypre__rb = 0;                                                             \
+   hypre__re = hypre__w * (hypre__e[2] - hypre__o[2]);                        \
+}                                                                             \
+else                                                                          \
+{                                                                             \
+   for (hypre__dd = 0; hypre__dd < HYPRE_MAXDIM; hypre__dd++)                 \
+   {                                                                          \
+      hypre__o[hypre__dd] = 0;                                                \
+      hypre__e[hypre__dd] = hypre__n[hypre__dd];                              \
+   }                                                                          \
+   hypre__w  = hypre__n[1];                                                   \
+   hypre__rb = hypre__tile * hypre__div + hypre_min(hypre__mod, hypre__tile); \
+   hypre__re = hypre__rb + hypre__div + ((hypre__mod > hypre__tile) ? 1 : 0); \
+}
+
+#define zypre_TiledBoxLoopSetK(k, ik)                                         \
+ik = hypre__ikstart##k + hypre__o[0] * hypre__sk##k[0] +                      \
+     hypre__J * hypre__sk##k[1] + hypre__K * hypre__sk##k[2]
+
+#define zypre_TiledBoxLoopFor()                                               \
+   for (hypre__r = hypre__rb; hypre__r < hypre__re; hypre__r++)
+
+#define zypre_TiledBoxLoopSetRow()                                            \
+hypre__J = hypre__o[1] + hypre__r % hypre__w;                                 \
+hypre__K = hypre__o[2] + hypre__r / hypre__w
+
+#define zypre_TiledBoxLoop1Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 1);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1;                                                           \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop1End(i1)                                            \
+            i1 += hypre__sk1[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop2Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 2);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2;                                                       \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop2End(i1, i2)                                        \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop3Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 3);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3;                                                   \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop3End(i1, i2, i3)                                    \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+            i3 += hypre__sk3[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+#define zypre_TiledBoxLoop4Begin(ndim, loop_size,                             \
+                                 dbox1, start1, stride1, i1,                  \
+                                 dbox2, start2, stride2, i2,                  \
+                                 dbox3, start3, stride3, i3,                  \
+                                 dbox4, start4, stride4, i4)                  \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopDeclareK(4);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 4);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   zypre_TiledBoxLoopInitK(4, dbox4, start4, stride4);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, i4;                                               \
+      zypre_TiledBoxLoopSet();                                                \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         zypre_TiledBoxLoopSetK(4, i4);                                       \
+         for (hypre__I = hypre__o[0]; hypre__I < hypre__e[0]; hypre__I++)     \
+         {
+
+#define zypre_TiledBoxLoop4End(i1, i2, i3, i4)                                \
+            i1 += hypre__sk1[0];                                              \
+            i2 += hypre__sk2[0];                                              \
+            i3 += hypre__sk3[0];                                              \
+            i4 += hypre__sk4[0];                                              \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
+/* Row version of the tiled BoxLoop3, for kernels that vectorize along rows
+ * themselves: the body is executed once per row segment of a tile, with i1,
+ * i2, i3 the indexes of its first point and nrow its number of points */
+#define zypre_TiledBoxLoop3RowsBegin(ndim, loop_size,                         \
+                                     dbox1, start1, stride1, i1,              \
+                                     dbox2, start2, stride2, i2,              \
+                                     dbox3, start3, stride3, i3, nrow)        \
+{                                                                             \
+   zypre_TiledBoxLoopDeclare();                                               \
+   zypre_TiledBoxLoopDeclareK(1);                                             \
+   zypre_TiledBoxLoopDeclareK(2);                                             \
+   zypre_TiledBoxLoopDeclareK(3);                                             \
+   zypre_TiledBoxLoopInit(ndim, loop_size, 3);                                \
+   zypre_TiledBoxLoopInitK(1, dbox1, start1, stride1);                        \
+   zypre_TiledBoxLoopInitK(2, dbox2, start2, stride2);                        \
+   zypre_TiledBoxLoopInitK(3, dbox3, start3, stride3);                        \
+   OMP0                                                                       \
+   for (hypre__tile = 0; hypre__tile < hypre__num_tiles; hypre__tile++)       \
+   {                                                                          \
+      HYPRE_Int i1, i2, i3, nrow;                                             \
+      zypre_TiledBoxLoopSet();                                                \
+      hypre__I = hypre__o[0];                                                 \
+      nrow = hypre__e[0] - hypre__I;                                          \
+      zypre_TiledBoxLoopFor()                                                 \
+      {                                                                       \
+         zypre_TiledBoxLoopSetRow();                                          \
+         zypre_TiledBoxLoopSetK(1, i1);                                       \
+         zypre_TiledBoxLoopSetK(2, i2);                                       \
+         zypre_TiledBoxLoopSetK(3, i3);                                       \
+         {
+
+#define zypre_TiledBoxLoop3RowsEnd(i1, i2, i3)                                \
+         }                                                                    \
+      }                                                                       \
+   }                                                                          \
+}
+
 #define hypre_LoopBegin(size, idx)                                            \
 {                                                                             \
    HYPRE_Int idx;                                                             \
@@ -264,6 +544,17 @@ typedef struct hypre_Boxloop_struct
 #define hypre_BoxLoop4End        zypre_newBoxLoop4End
 #define hypre_BasicBoxLoop2Begin zypre_newBasicBoxLoop2Begin
 
+#define hypre_BoxLoop1TiledBegin zypre_TiledBoxLoop1Begin
+#define hypre_BoxLoop1TiledEnd   zypre_TiledBoxLoop1End
+#define hypre_BoxLoop2TiledBegin zypre_TiledBoxLoop2Begin
+#define hypre_BoxLoop2TiledEnd   zypre_TiledBoxLoop2End
+#define hypre_BoxLoop3TiledBegin zypre_TiledBoxLoop3Begin
+#define hypre_BoxLoop3TiledEnd   zypre_TiledBoxLoop3End
+#define hypre_BoxLoop4TiledBegin zypre_TiledBoxLoop4Begin
+#define hypre_BoxLoop4TiledEnd   zypre_TiledBoxLoop4End
+#define hypre_BoxLoop3TiledRowsBegin zypre_TiledBoxLoop3RowsBegin
+#define hypre_BoxLoop3TiledRowsEnd   zypre_TiledBoxLoop3RowsEnd
+
 /* Reduction */
 #define hypre_BoxLoop1ReductionBegin(ndim, loop_size, dbox1, start1, stride1, i1, reducesum) \
         hypre_BoxLoop1Begin(ndim, loop_size, dbox1, start1, stride1, i1)
@@ -7,6 +7,10 @@
 
 #include "_hypre_struct_mv.h"
 
+/* cache key: the stencil grow extents (2 per dimension), then the 3^ndim
+   stencil grid (see hypre_CreateCommInfoFromStencil) */
+#define HYPRE_COMM_INFO_CACHE_KEY_SIZE  (2 * HYPRE_MAXDIM + 27)
+
 /*--------------------------------------------------------------------------
  * Note that send_coords, recv_coords, send_dirs, recv_dirs may be NULL to
  * represent an identity transform.
@@ -198,6 +202,108 @@ hypre_CommInfoDestroy( hypre_CommInfo  *comm_info )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Return a deep copy of comm_info.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int **
+hypre_CommInfoDuplicateArrays( HYPRE_Int           **arrays,
+                               hypre_BoxArrayArray  *boxes )
+{
+   HYPRE_Int  **new_arrays = NULL;
+   HYPRE_Int    i, j, size, size_j;
+
+   if (arrays != NULL)
+   {
+      size = hypre_BoxArrayArraySize(boxes);
+      new_arrays = hypre_TAlloc(HYPRE_Int *, size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < size; i++)
+      {
+         size_j = hypre_BoxArraySize(hypre_BoxArrayArrayBoxArray(boxes, i));
+         new_arrays[i] = hypre_TAlloc(HYPRE_Int, size_j, HYPRE_MEMORY_HOST);
+         for (j = 0; j < size_j; j++)
+         {
+            new_arrays[i][j] = arrays[i][j];
+         }
+      }
+   }
+
+   return new_arrays;
+}
+
+hypre_CommInfo *
+hypre_CommInfoDuplicate( hypre_CommInfo  *comm_info )
+{
+   hypre_CommInfo       *new_comm_info;
+   hypre_BoxArrayArray  *send_boxes = hypre_CommInfoSendBoxes(comm_info);
+   hypre_BoxArrayArray  *recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+   HYPRE_Int             num_transforms = hypre_CommInfoNumTransforms(comm_info);
+   hypre_Index          *coords = NULL;
+   hypre_Index          *dirs = NULL;
+   HYPRE_Int             t;
+
+   hypre_CommInfoCreate(
+      hypre_BoxArrayArrayDuplicate(send_boxes),
+      hypre_BoxArrayArrayDuplicate(recv_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendProcesses(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvProcesses(comm_info), recv_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendRBoxnums(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvRBoxnums(comm_info), recv_boxes),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoSendRBoxes(comm_info)),
+      hypre_BoxArrayArrayDuplicate(hypre_CommInfoRecvRBoxes(comm_info)),
+      hypre_CommInfoBoxesMatch(comm_info), &new_comm_info);
+
+   hypre_CopyIndex(hypre_CommInfoSendStride(comm_info),
+                   hypre_CommInfoSendStride(new_comm_info));
+   hypre_CopyIndex(hypre_CommInfoRecvStride(comm_info),
+                   hypre_CommInfoRecvStride(new_comm_info));
+
+   if (hypre_CommInfoCoords(comm_info) != NULL)
+   {
+      coords = hypre_TAlloc(hypre_Index, num_transforms, HYPRE_MEMORY_HOST);
+      dirs   = hypre_TAlloc(hypre_Index, num_transforms, HYPRE_MEMORY_HOST);
+      for (t = 0; t < num_transforms; t++)
+      {
+         hypre_CopyIndex(hypre_CommInfoCoords(comm_info)[t], coords[t]);
+         hypre_CopyIndex(hypre_CommInfoDirs(comm_info)[t], dirs[t]);
+      }
+   }
+   hypre_CommInfoSetTransforms(
+      new_comm_info, num_transforms, coords, dirs,
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoSendTransforms(comm_info), send_boxes),
+      hypre_CommInfoDuplicateArrays(hypre_CommInfoRecvTransforms(comm_info), recv_boxes));
+
+   return new_comm_info;
+}
+
+/*--------------------------------------------------------------------------
+ * Statistics for the communication info cache kept on each grid by
+ * hypre_CreateCommInfoFromStencil().  The counts are summed over all grids
+ * on this process.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int hypre_comm_info_cache_hits   = 0;
+static HYPRE_Int hypre_comm_info_cache_misses = 0;
+
+HYPRE_Int
+hypre_CommInfoCacheGetStats( HYPRE_Int  *hits,
+                             HYPRE_Int  *misses )
+{
+   *hits   = hypre_comm_info_cache_hits;
+   *misses = hypre_comm_info_cache_misses;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CommInfoCacheResetStats( void )
+{
+   hypre_comm_info_cache_hits   = 0;
+   hypre_comm_info_cache_misses = 0;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * NEW version that uses the box manager to find neighbors boxes.
  * AHB 9/06
@@ -288,6 +394,10 @@ hypre_CommInfoDestroy( hypre_CommInfo  *comm_info )
  *    B. Boxes in the send and recv regions do not need to be in any
  *       particular order (including those that are periodic).
  *
+ *    C. The result is cached on the grid and keyed on the "grow" extents
+ *       and the stencil grid above, so later calls with the same grid and
+ *       an equivalent stencil (or number of ghost layers) return a copy.
+ *
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -358,6 +468,10 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
    HYPRE_Int              num_periods, loc, box_id, id, proc_id;
    HYPRE_Int              myid;
 
+   HYPRE_Int              cache_key[HYPRE_COMM_INFO_CACHE_KEY_SIZE];
+   HYPRE_Int              cache_size;
+   HYPRE_Int             *cache_keys;
+
    MPI_Comm               comm;
 
    /*------------------------------------------------------
@@ -437,6 +551,51 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
       hypre_SerialBoxLoop1End(si);
    }
 
+   /*------------------------------------------------------
+    * The result depends on the stencil only through 'grow' and
+    * 'stencil_grid', so use them to look in the grid's cache
+    *------------------------------------------------------*/
+
+   for (k = 0; k < HYPRE_COMM_INFO_CACHE_KEY_SIZE; k++)
+   {
+      cache_key[k] = 0;
+   }
+   for (d = 0; d < ndim; d++)
+   {
+      cache_key[2 * d]     = grow[d][0];
+      cache_key[2 * d + 1] = grow[d][1];
+   }
+   for (si = 0; si < hypre_BoxVolume(stencil_box); si++)
+   {
+      cache_key[2 * HYPRE_MAXDIM + si] = stencil_grid[si];
+   }
+
+   cache_size = hypre_StructGridCommCacheSize(grid);
+   cache_keys = hypre_StructGridCommCacheKeys(grid);
+   for (i = 0; i < cache_size; i++)
+   {
+      for (k = 0; k < HYPRE_COMM_INFO_CACHE_KEY_SIZE; k++)
+      {
+         if (cache_keys[i * HYPRE_COMM_INFO_CACHE_KEY_SIZE + k] != cache_key[k])
+         {
+            break;
+         }
+      }
+      if (k == HYPRE_COMM_INFO_CACHE_KEY_SIZE)
+      {
+         hypre_comm_info_cache_hits++;
+
+         hypre_BoxDestroy(stencil_box);
+         hypre_BoxDestroy(sbox);
+         hypre_TFree(stencil_grid, HYPRE_MEMORY_HOST);
+
+         *comm_info_ptr = hypre_CommInfoDuplicate(hypre_StructGridCommCacheInfos(grid)[i]);
+
+         return hypre_error_flag;
+      }
+   }
+   hypre_comm_info_cache_misses++;
+
    /*------------------------------------------------------
     * Compute send/recv boxes and procs for each local box
     *------------------------------------------------------*/
@@ -778,6 +937,21 @@ hypre_CreateCommInfoFromStencil( hypre_StructGrid      *grid,
                         send_rboxnums, recv_rboxnums, send_rboxes, recv_rboxes,
                         1, comm_info_ptr);
 
+   /* add a copy to the grid's cache */
+   hypre_StructGridCommCacheKeys(grid) =
+      hypre_TReAlloc(cache_keys, HYPRE_Int,
+                     (cache_size + 1) * HYPRE_COMM_INFO_CACHE_KEY_SIZE, HYPRE_MEMORY_HOST);
+   hypre_StructGridCommCacheInfos(grid) =
+      hypre_TReAlloc(hypre_StructGridCommCacheInfos(grid), hypre_CommInfo *,
+                     (cache_size + 1), HYPRE_MEMORY_HOST);
+   for (k = 0; k < HYPRE_COMM_INFO_CACHE_KEY_SIZE; k++)
+   {
+      hypre_StructGridCommCacheKeys(grid)[cache_size * HYPRE_COMM_INFO_CACHE_KEY_SIZE + k] =
+         cache_key[k];
+   }
+   hypre_StructGridCommCacheInfos(grid)[cache_size] = hypre_CommInfoDuplicate(*comm_info_ptr);
+   hypre_StructGridCommCacheSize(grid) = cache_size + 1;
+
    return hypre_error_flag;
 }
 
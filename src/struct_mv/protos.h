@@ -73,6 +73,8 @@ HYPRE_Int hypre_IndexInBox ( hypre_Index index, hypre_Box *box );
 HYPRE_Int hypre_BoxGetSize ( hypre_Box *box, hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideSize ( hypre_Box *box, hypre_Index stride, hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideVolume ( hypre_Box *box, hypre_Index stride, HYPRE_Int *volume_ptr );
+HYPRE_Int hypre_BoxLoopGetTileSize ( HYPRE_Int ndim, hypre_Index loop_size, HYPRE_Int num_arrays,
+                                     hypre_Index tile_size );
 HYPRE_Int hypre_BoxIndexRank( hypre_Box *box, hypre_Index index );
 HYPRE_Int hypre_BoxRankIndex( hypre_Box *box, HYPRE_Int rank, hypre_Index index );
 HYPRE_Int hypre_BoxOffsetDistance( hypre_Box *box, hypre_Index index );
@@ -132,6 +134,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManIntersectBoxArray ( hypre_BoxManager *manager, hypre_BoxArray *boxes,
+                                          hypre_BoxManEntry ***entries_ptr, HYPRE_Int **offsets_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -153,6 +157,9 @@ HYPRE_Int hypre_CommInfoProjectSend ( hypre_CommInfo *comm_info, hypre_Index ind
 HYPRE_Int hypre_CommInfoProjectRecv ( hypre_CommInfo *comm_info, hypre_Index index,
                                       hypre_Index stride );
 HYPRE_Int hypre_CommInfoDestroy ( hypre_CommInfo *comm_info );
+hypre_CommInfo *hypre_CommInfoDuplicate ( hypre_CommInfo *comm_info );
+HYPRE_Int hypre_CommInfoCacheGetStats ( HYPRE_Int *hits, HYPRE_Int *misses );
+HYPRE_Int hypre_CommInfoCacheResetStats ( void );
 HYPRE_Int hypre_CreateCommInfoFromStencil ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                             hypre_CommInfo **comm_info_ptr );
 HYPRE_Int hypre_CreateCommInfoFromNumGhost ( hypre_StructGrid *grid, HYPRE_Int *num_ghost,
@@ -223,6 +230,8 @@ HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename, HYPRE_StructMatrix mat
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha, HYPRE_StructMatrix A,
                                      HYPRE_StructVector x, HYPRE_Complex beta, HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
+HYPRE_Int HYPRE_StructMatrixSetCoeffFunction ( HYPRE_StructMatrix matrix,
+                                               HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
 
 /* HYPRE_struct_stencil.c */
 HYPRE_Int HYPRE_StructStencilCreate ( HYPRE_Int dim, HYPRE_Int size, HYPRE_StructStencil *stencil );
@@ -271,6 +280,9 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
 
 /* struct_communication.c */
+HYPRE_Int hypre_CommSetUseDatatypes ( HYPRE_Int use_datatypes );
+HYPRE_Int hypre_CommGetPackStats ( HYPRE_Int *num_typed_msgs, HYPRE_Int *num_packed_msgs );
+HYPRE_Int hypre_CommResetPackStats ( void );
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
                                 hypre_BoxArray *recv_data_space, HYPRE_Int num_values, HYPRE_Int **orders, HYPRE_Int reverse,
                                 MPI_Comm comm, hypre_CommPkg **comm_pkg_ptr );
@@ -280,6 +292,8 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type, HYPRE_Int *boxnu
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box, hypre_Index stride, hypre_Index coord,
                                    hypre_Index dir, HYPRE_Int *order, hypre_Box *data_box, HYPRE_Int data_box_offset,
                                    hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommTypeSetDatatype ( hypre_CommType *comm_type, HYPRE_Int ndim,
+                                      HYPRE_Int num_values );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg, HYPRE_Complex *send_data,
                                           HYPRE_Complex *recv_data, HYPRE_Int action, HYPRE_Int tag, hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
@@ -371,6 +385,9 @@ HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
+HYPRE_Int hypre_StructMatrixSetCoeffFunction ( hypre_StructMatrix *matrix,
+                                               HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+hypre_StructMatrix *hypre_StructMatrixMaterialize ( hypre_StructMatrix *matrix );
 
 /* struct_matrix_mask.c */
 hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix,
@@ -384,10 +401,17 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecStencilKernel ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecStencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                      hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                      hypre_IndexRef stride, HYPRE_Int kernel );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMatrixFree ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                         hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                         hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
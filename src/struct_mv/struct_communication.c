@@ -7,6 +7,9 @@
 
 #include "_hypre_struct_mv.h"
 #include "_hypre_struct_mv.hpp"
+#ifdef HYPRE_PROFILE
+#include "HYPRE_seq_mv.h"  /* for hypre_profile_times */
+#endif
 
 #define DEBUG 0
 
@@ -19,6 +22,129 @@ FILE      *file;
 #define hypre_CommPrefixSize(ne)                                        \
    ( (((1+ne)*sizeof(HYPRE_Int) + ne*sizeof(hypre_Box))/sizeof(HYPRE_Complex)) + 1 )
 
+/* a recv CommType is received in place with an MPI datatype when its
+   contiguous runs average at least this many values; otherwise (e.g., for
+   corner fragments and faces normal to the unit-stride direction) it is
+   received into a buffer and unpacked */
+#define HYPRE_COMM_DATATYPE_MIN_BLOCK 8
+
+/*--------------------------------------------------------------------------
+ * Turn the MPI datatype path on or off for communication packages that have
+ * not yet done their first communication.  It is on by default.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommSetUseDatatypes( HYPRE_Int use_datatypes )
+{
+   hypre_HandleStructCommDatatypes(hypre_handle()) = use_datatypes;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Number of messages sent/received with and without MPI datatypes by
+ * hypre_InitializeCommunication().  The time spent packing and unpacking
+ * buffers goes to the HYPRE_TIMER_ID_PACK_UNPACK profiling timer.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommGetPackStats( HYPRE_Int  *num_typed_msgs,
+                        HYPRE_Int  *num_packed_msgs )
+{
+   *num_typed_msgs  = hypre_HandleStructCommNumTypedMsgs(hypre_handle());
+   *num_packed_msgs = hypre_HandleStructCommNumPackedMsgs(hypre_handle());
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_CommResetPackStats( void )
+{
+   hypre_HandleStructCommNumTypedMsgs(hypre_handle())  = 0;
+   hypre_HandleStructCommNumPackedMsgs(hypre_handle()) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Stable sort of the comm boxes on their process number 'p'.  The boxes are
+ * generated in (i,j) order, so this sorts on (p,i,j).  A quicksort on 'p'
+ * alone degenerates to quadratic cost because most boxes usually share only a
+ * few process numbers.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgSortBoxes( HYPRE_Int  *comm_boxes_p,
+                        HYPRE_Int  *comm_boxes_i,
+                        HYPRE_Int  *comm_boxes_j,
+                        HYPRE_Int   num_boxes )
+{
+   HYPRE_Int  *p, *i, *j, *tp, *ti, *tj, *swap;
+   HYPRE_Int   width, lo, mid, hi, a, b, m;
+
+   /* nothing to do if already sorted */
+   for (m = 1; m < num_boxes; m++)
+   {
+      if (comm_boxes_p[m] < comm_boxes_p[m - 1])
+      {
+         break;
+      }
+   }
+   if (m >= num_boxes)
+   {
+      return hypre_error_flag;
+   }
+
+   /* bottom-up merge sort */
+   p  = comm_boxes_p;
+   i  = comm_boxes_i;
+   j  = comm_boxes_j;
+   tp = hypre_TAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   ti = hypre_TAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   tj = hypre_TAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   for (width = 1; width < num_boxes; width *= 2)
+   {
+      for (lo = 0; lo < num_boxes; lo += 2 * width)
+      {
+         mid = hypre_min(lo + width, num_boxes);
+         hi  = hypre_min(lo + 2 * width, num_boxes);
+         a = lo;
+         b = mid;
+         for (m = lo; m < hi; m++)
+         {
+            if (a < mid && (b >= hi || p[a] <= p[b]))
+            {
+               tp[m] = p[a]; ti[m] = i[a]; tj[m] = j[a]; a++;
+            }
+            else
+            {
+               tp[m] = p[b]; ti[m] = i[b]; tj[m] = j[b]; b++;
+            }
+         }
+      }
+      swap = p; p = tp; tp = swap;
+      swap = i; i = ti; ti = swap;
+      swap = j; j = tj; tj = swap;
+   }
+
+   /* copy back if the result ended up in the work arrays */
+   if (p != comm_boxes_p)
+   {
+      for (m = 0; m < num_boxes; m++)
+      {
+         comm_boxes_p[m] = p[m];
+         comm_boxes_i[m] = i[m];
+         comm_boxes_j[m] = j[m];
+      }
+      tp = p; ti = i; tj = j;
+   }
+   hypre_TFree(tp, HYPRE_MEMORY_HOST);
+   hypre_TFree(ti, HYPRE_MEMORY_HOST);
+   hypre_TFree(tj, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Create a communication package.  A grid-based description of a communication
  * exchange is passed in.  This description is then compiled into an
@@ -212,7 +338,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
          num_boxes++;
       }
    }
-   hypre_qsort3i(comm_boxes_p, comm_boxes_i, comm_boxes_j, 0, num_boxes - 1);
+   hypre_CommPkgSortBoxes(comm_boxes_p, comm_boxes_i, comm_boxes_j, num_boxes);
 
    /* compute comm_types */
 
@@ -350,7 +476,7 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
          num_boxes++;
       }
    }
-   hypre_qsort3i(comm_boxes_p, comm_boxes_i, comm_boxes_j, 0, num_boxes - 1);
+   hypre_CommPkgSortBoxes(comm_boxes_p, comm_boxes_i, comm_boxes_j, num_boxes);
 
    /* compute comm_types */
 
@@ -762,6 +888,290 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Set up an MPI datatype that describes the entries of 'comm_type' in place
+ * in the data array, in the same order as the packed buffer.  This is only
+ * done when the entries are made of long enough contiguous runs (see
+ * HYPRE_COMM_DATATYPE_MIN_BLOCK) and no values are zero-filled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommTypeSetDatatype( hypre_CommType  *comm_type,
+                           HYPRE_Int        ndim,
+                           HYPRE_Int        num_values )
+{
+   HYPRE_Int             num_entries = hypre_CommTypeNumEntries(comm_type);
+   hypre_CommEntryType  *comm_entry;
+   HYPRE_Int            *length_array;
+   HYPRE_Int            *stride_array;
+   HYPRE_Int            *order;
+
+   HYPRE_Int            *blocklengths;
+   hypre_MPI_Aint       *displacements;
+   hypre_MPI_Datatype   *types;
+   HYPRE_Int            *own_types;
+   hypre_MPI_Datatype    new_type;
+
+   HYPRE_Int             size, count, num_blocks;
+   HYPRE_Int             j, d, ll, k;
+
+   hypre_CommTypeUseDatatype(comm_type) = 0;
+
+   if (num_entries == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* count values and contiguous runs */
+   size = 0;
+   num_blocks = 0;
+   for (j = 0; j < num_entries; j++)
+   {
+      comm_entry = hypre_CommTypeEntry(comm_type, j);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      order = hypre_CommEntryTypeOrder(comm_entry);
+
+      count = 1;
+      for (d = 0; d < ndim; d++)
+      {
+         count *= length_array[d];
+      }
+      for (ll = 0; ll < num_values; ll++)
+      {
+         if (order[ll] < 0)
+         {
+            /* zero-filled values have to be packed */
+            return hypre_error_flag;
+         }
+         size += count;
+         num_blocks += (stride_array[0] == 1) ? (count / length_array[0]) : count;
+      }
+   }
+   if (size < HYPRE_COMM_DATATYPE_MIN_BLOCK * num_blocks)
+   {
+      return hypre_error_flag;
+   }
+
+   /* create one strided type per entry and value, then combine them */
+   blocklengths  = hypre_TAlloc(HYPRE_Int, num_entries * num_values, HYPRE_MEMORY_HOST);
+   displacements = hypre_TAlloc(hypre_MPI_Aint, num_entries * num_values, HYPRE_MEMORY_HOST);
+   types         = hypre_TAlloc(hypre_MPI_Datatype, num_entries * num_values, HYPRE_MEMORY_HOST);
+   own_types     = hypre_TAlloc(HYPRE_Int, num_entries * num_values, HYPRE_MEMORY_HOST);
+   k = 0;
+   for (j = 0; j < num_entries; j++)
+   {
+      comm_entry = hypre_CommTypeEntry(comm_type, j);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      order = hypre_CommEntryTypeOrder(comm_entry);
+
+      for (ll = 0; ll < num_values; ll++)
+      {
+         blocklengths[k]  = 1;
+         displacements[k] = (hypre_MPI_Aint) sizeof(HYPRE_Complex) *
+                            (hypre_CommEntryTypeOffset(comm_entry) +
+                             order[ll] * stride_array[ndim]);
+         types[k]         = HYPRE_MPI_COMPLEX;
+         own_types[k]     = 0;
+         for (d = 0; d < ndim; d++)
+         {
+            if (length_array[d] > 1)
+            {
+               if (!own_types[k] && stride_array[d] == 1)
+               {
+                  hypre_MPI_Type_contiguous(length_array[d], types[k], &new_type);
+               }
+               else
+               {
+                  hypre_MPI_Type_hvector(length_array[d], 1,
+                                         (hypre_MPI_Aint) sizeof(HYPRE_Complex) * stride_array[d],
+                                         types[k], &new_type);
+               }
+               if (own_types[k])
+               {
+                  hypre_MPI_Type_free(&types[k]);
+               }
+               types[k] = new_type;
+               own_types[k] = 1;
+            }
+         }
+         k++;
+      }
+   }
+
+   hypre_MPI_Type_struct(k, blocklengths, displacements, types,
+                         &hypre_CommTypeDatatype(comm_type));
+   hypre_MPI_Type_commit(&hypre_CommTypeDatatype(comm_type));
+   hypre_CommTypeUseDatatype(comm_type) = 1;
+
+   for (k = 0; k < num_entries * num_values; k++)
+   {
+      if (own_types[k])
+      {
+         hypre_MPI_Type_free(&types[k]);
+      }
+   }
+   hypre_TFree(blocklengths, HYPRE_MEMORY_HOST);
+   hypre_TFree(displacements, HYPRE_MEMORY_HOST);
+   hypre_TFree(types, HYPRE_MEMORY_HOST);
+   hypre_TFree(own_types, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Appends the data locations of the entries of 'comm_type' to 'points', each
+ * tagged with 'id'.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CommTypeGetPoints( hypre_CommType  *comm_type,
+                         HYPRE_Int        ndim,
+                         HYPRE_Int        num_values,
+                         HYPRE_Int        id,
+                         HYPRE_Int      **points_ptr,
+                         HYPRE_Int      **ids_ptr,
+                         HYPRE_Int       *num_points_ptr,
+                         HYPRE_Int       *alloc_points_ptr )
+{
+   HYPRE_Int            *points = *points_ptr;
+   HYPRE_Int            *ids    = *ids_ptr;
+   HYPRE_Int             num_points = *num_points_ptr;
+   HYPRE_Int             alloc_points = *alloc_points_ptr;
+   hypre_CommEntryType  *comm_entry;
+   HYPRE_Int            *length_array, *stride_array, *order;
+   HYPRE_Int             n[3], st[3];
+   HYPRE_Int             j, d, ll, i0, i1, i2, base;
+
+   for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+   {
+      comm_entry = hypre_CommTypeEntry(comm_type, j);
+      length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+      stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+      order = hypre_CommEntryTypeOrder(comm_entry);
+      for (d = 0; d < 3; d++)
+      {
+         n[d]  = (d < ndim) ? length_array[d] : 1;
+         st[d] = (d < ndim) ? stride_array[d] : 0;
+      }
+
+      if (num_points + num_values * n[0] * n[1] * n[2] > alloc_points)
+      {
+         alloc_points = 2 * (num_points + num_values * n[0] * n[1] * n[2]);
+         points = hypre_TReAlloc(points, HYPRE_Int, alloc_points, HYPRE_MEMORY_HOST);
+         ids    = hypre_TReAlloc(ids, HYPRE_Int, alloc_points, HYPRE_MEMORY_HOST);
+      }
+
+      for (ll = 0; ll < num_values; ll++)
+      {
+         if (order[ll] < 0)
+         {
+            continue;
+         }
+         base = hypre_CommEntryTypeOffset(comm_entry) + order[ll] * stride_array[ndim];
+         for (i2 = 0; i2 < n[2]; i2++)
+         {
+            for (i1 = 0; i1 < n[1]; i1++)
+            {
+               for (i0 = 0; i0 < n[0]; i0++)
+               {
+                  points[num_points] = base + i0 * st[0] + i1 * st[1] + i2 * st[2];
+                  ids[num_points]    = id;
+                  num_points++;
+               }
+            }
+         }
+      }
+   }
+
+   *points_ptr       = points;
+   *ids_ptr          = ids;
+   *num_points_ptr   = num_points;
+   *alloc_points_ptr = alloc_points;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets up the MPI datatypes of the recv types after the first communication,
+ * when their entries are known.
+ *
+ * Sends are always packed: callers may compute on the send data while the
+ * communication is pending (e.g., in red-black Gauss-Seidel), and MPI does
+ * not allow a send buffer to be modified before the send has completed.
+ *
+ * Receiving in place changes the order of the data accesses: a typed receive
+ * may write its data before the local copy or in any order with respect to
+ * the other receives.  So, to give the same results as with buffers, a recv
+ * type is only received in place if no other recv type or the local copy
+ * writes the same data.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgSetDatatypes( hypre_CommPkg *comm_pkg )
+{
+   HYPRE_Int        ndim       = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int        num_values = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int        num_recvs  = hypre_CommPkgNumRecvs(comm_pkg);
+   hypre_CommType  *comm_type;
+
+   HYPRE_Int       *points = NULL, *ids = NULL, *conflict;
+   HYPRE_Int        num_points = 0, alloc_points = 0;
+   HYPRE_Int        num_typed;
+   HYPRE_Int        i, m, m0;
+
+   num_typed = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_CommTypeSetDatatype(comm_type, ndim, num_values);
+      num_typed += hypre_CommTypeUseDatatype(comm_type);
+   }
+   if (num_typed == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* ids: recvs, then the local copy */
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_CommTypeGetPoints(hypre_CommPkgRecvType(comm_pkg, i), ndim, num_values,
+                              i, &points, &ids, &num_points, &alloc_points);
+   }
+   hypre_CommTypeGetPoints(hypre_CommPkgCopyToType(comm_pkg), ndim, num_values,
+                           num_recvs, &points, &ids, &num_points, &alloc_points);
+
+   /* find the data locations written more than once */
+   conflict = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   hypre_qsort2i(points, ids, 0, num_points - 1);
+   for (m0 = 0; m0 < num_points; m0 = m)
+   {
+      for (m = m0; m < num_points && points[m] == points[m0]; m++);
+      if (m - m0 > 1)
+      {
+         for (i = m0; i < m; i++)
+         {
+            conflict[ids[i]] = 1;
+         }
+      }
+   }
+
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      if (conflict[i] && hypre_CommTypeUseDatatype(comm_type))
+      {
+         hypre_MPI_Type_free(&hypre_CommTypeDatatype(comm_type));
+         hypre_CommTypeUseDatatype(comm_type) = 0;
+      }
+   }
+
+   hypre_TFree(points, HYPRE_MEMORY_HOST);
+   hypre_TFree(ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(conflict, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -933,6 +1343,10 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * pack send buffers
     *--------------------------------------------------------------------*/
 
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
    for (i = 0; i < num_sends; i++)
    {
       comm_type = hypre_CommPkgSendType(comm_pkg, i);
@@ -991,6 +1405,10 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
       }
    }
 
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
    /* Copy buffer data from Device to Host */
    if (num_sends > 0 && alloc_dev_buffer)
    {
@@ -1033,31 +1451,52 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    for (i = 0; i < num_recvs; i++)
    {
       comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
       if ( hypre_CommPkgFirstComm(comm_pkg) )
       {
+         hypre_MPI_Irecv(recv_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
          size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
          hypre_CommTypeBufsize(comm_type)   -= size;
          hypre_CommPkgRecvBufsize(comm_pkg) -= size;
       }
+      else if (hypre_CommTypeUseDatatype(comm_type) && !alloc_dev_buffer && action == 0)
+      {
+         /* receive directly into the data array */
+         hypre_MPI_Irecv(recv_data, 1, hypre_CommTypeDatatype(comm_type),
+                         hypre_CommTypeProc(comm_type), tag, comm, &requests[j++]);
+         hypre_HandleStructCommNumTypedMsgs(hypre_handle())++;
+      }
+      else
+      {
+         hypre_MPI_Irecv(recv_buffers[i], hypre_CommTypeBufsize(comm_type),
+                         HYPRE_MPI_COMPLEX, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         hypre_HandleStructCommNumPackedMsgs(hypre_handle())++;
+      }
    }
 
    for (i = 0; i < num_sends; i++)
    {
       comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
       if ( hypre_CommPkgFirstComm(comm_pkg) )
       {
+         hypre_MPI_Isend(send_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
          size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
          hypre_CommTypeBufsize(comm_type)   -= size;
          hypre_CommPkgSendBufsize(comm_pkg) -= size;
       }
+      else
+      {
+         hypre_MPI_Isend(send_buffers[i], hypre_CommTypeBufsize(comm_type),
+                         HYPRE_MPI_COMPLEX, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         hypre_HandleStructCommNumPackedMsgs(hypre_handle())++;
+      }
    }
 
    /*--------------------------------------------------------------------
@@ -1244,11 +1683,22 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
       }
    }
 
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
    for (i = 0; i < num_recvs; i++)
    {
       comm_type = hypre_CommPkgRecvType(comm_pkg, i);
       num_entries = hypre_CommTypeNumEntries(comm_type);
 
+      if (!hypre_CommPkgFirstComm(comm_pkg) &&
+          hypre_CommTypeUseDatatype(comm_type) && !alloc_dev_buffer && action == 0)
+      {
+         /* already received in place */
+         continue;
+      }
+
       dptr = (HYPRE_Complex *) recv_buffers_device[i];
 
       if ( hypre_CommPkgFirstComm(comm_pkg) )
@@ -1295,10 +1745,20 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
       }
    }
 
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
    /*--------------------------------------------------------------------
-    * turn off first communication indicator
+    * turn off first communication indicator and, now that all entries are
+    * known, set up the MPI datatypes
     *--------------------------------------------------------------------*/
 
+   if ( hypre_CommPkgFirstComm(comm_pkg) && hypre_HandleStructCommDatatypes(hypre_handle()) && !alloc_dev_buffer )
+   {
+      hypre_CommPkgSetDatatypes(comm_pkg);
+   }
+
    hypre_CommPkgFirstComm(comm_pkg) = 0;
 
    /*--------------------------------------------------------------------
@@ -1437,6 +1897,15 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+      for (i = 0; i < hypre_CommPkgNumRecvs(comm_pkg); i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         if (hypre_CommTypeUseDatatype(comm_type))
+         {
+            hypre_MPI_Type_free(&hypre_CommTypeDatatype(comm_type));
+         }
+      }
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
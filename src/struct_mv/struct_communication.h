@@ -70,6 +70,11 @@ typedef struct hypre_CommType_struct
    HYPRE_Int            *rem_boxnums; /* entry remote box numbers */
    hypre_Box            *rem_boxes;   /* entry remote boxes */
 
+   /* MPI datatype describing the entries in place in the data array, used
+      instead of a packed buffer when 'use_datatype' is set */
+   HYPRE_Int             use_datatype;
+   hypre_MPI_Datatype    datatype;
+
 } hypre_CommType;
 
 /*--------------------------------------------------------------------------
@@ -196,6 +201,9 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommTypeRemBoxes(type)      (type -> rem_boxes)
 #define hypre_CommTypeRemBox(type, i)   (&(type -> rem_boxes[i]))
 
+#define hypre_CommTypeUseDatatype(type)   (type -> use_datatype)
+#define hypre_CommTypeDatatype(type)      (type -> datatype)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommPkg
  *--------------------------------------------------------------------------*/
@@ -51,6 +51,10 @@ hypre_StructGridCreate( MPI_Comm           comm,
    hypre_StructGridRefCount(grid)     = 1;
    hypre_StructGridBoxMan(grid)       = NULL;
 
+   hypre_StructGridCommCacheSize(grid)  = 0;
+   hypre_StructGridCommCacheKeys(grid)  = NULL;
+   hypre_StructGridCommCacheInfos(grid) = NULL;
+
    hypre_StructGridNumPeriods(grid)   = 1;
    hypre_StructGridPShifts(grid)     = NULL;
 
@@ -89,6 +93,8 @@ hypre_StructGridRef( hypre_StructGrid  *grid,
 HYPRE_Int
 hypre_StructGridDestroy( hypre_StructGrid *grid )
 {
+   HYPRE_Int  i;
+
    if (grid)
    {
       hypre_StructGridRefCount(grid) --;
@@ -101,6 +107,13 @@ hypre_StructGridDestroy( hypre_StructGrid *grid )
          hypre_BoxManDestroy(hypre_StructGridBoxMan(grid));
          hypre_TFree( hypre_StructGridPShifts(grid), HYPRE_MEMORY_HOST);
 
+         for (i = 0; i < hypre_StructGridCommCacheSize(grid); i++)
+         {
+            hypre_CommInfoDestroy(hypre_StructGridCommCacheInfos(grid)[i]);
+         }
+         hypre_TFree(hypre_StructGridCommCacheKeys(grid), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructGridCommCacheInfos(grid), HYPRE_MEMORY_HOST);
+
          hypre_TFree(grid, HYPRE_MEMORY_HOST);
       }
    }
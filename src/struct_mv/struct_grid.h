@@ -46,6 +46,12 @@ typedef struct hypre_StructGrid_struct
    HYPRE_Int            num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
    hypre_BoxManager    *boxman;
+
+   /* Communication info computed from this grid, cached by stencil pattern
+      (see hypre_CreateCommInfoFromStencil) */
+   HYPRE_Int            comm_cache_size;
+   HYPRE_Int           *comm_cache_keys;
+   struct hypre_CommInfo_struct **comm_cache_infos;
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_MemoryLocation data_location;
 #endif
@@ -71,6 +77,9 @@ typedef struct hypre_StructGrid_struct
 #define hypre_StructGridGhlocalSize(grid)   ((grid) -> ghlocal_size)
 #define hypre_StructGridNumGhost(grid)      ((grid) -> num_ghost)
 #define hypre_StructGridBoxMan(grid)        ((grid) -> boxman)
+#define hypre_StructGridCommCacheSize(grid) ((grid) -> comm_cache_size)
+#define hypre_StructGridCommCacheKeys(grid) ((grid) -> comm_cache_keys)
+#define hypre_StructGridCommCacheInfos(grid) ((grid) -> comm_cache_infos)
 
 #define hypre_StructGridBox(grid, i)        (hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i))
 #define hypre_StructGridNumBoxes(grid)      (hypre_BoxArraySize(hypre_StructGridBoxes(grid)))
@@ -112,6 +112,7 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
          hypre_TFree(hypre_StructMatrixDataIndices(matrix), HYPRE_MEMORY_HOST);
          hypre_BoxArrayDestroy(hypre_StructMatrixDataSpace(matrix));
          hypre_TFree(hypre_StructMatrixSymmElements(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_StructMatrixEntryTypes(matrix), HYPRE_MEMORY_HOST);
          hypre_StructStencilDestroy(hypre_StructMatrixUserStencil(matrix));
          hypre_StructStencilDestroy(hypre_StructMatrixStencil(matrix));
          hypre_StructGridDestroy(hypre_StructMatrixGrid(matrix));
@@ -139,6 +140,7 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
    HYPRE_Complex       **stencil_data;
    HYPRE_Int             num_values;
    HYPRE_Int            *symm_elements;
+   HYPRE_Int            *entry_types;
    HYPRE_Int             constant_coefficient;
 
    HYPRE_Int            *num_ghost;
@@ -169,6 +171,15 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
     * stored as the transpose coefficient at a neighboring grid point.
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixMatrixFree(matrix) &&
+       (hypre_StructMatrixSymmetric(matrix) ||
+        hypre_StructMatrixConstantCoefficient(matrix) != 0))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "A matrix-free matrix must be nonsymmetric with variable coefficients");
+      return hypre_error_flag;
+   }
+
    if (hypre_StructMatrixStencil(matrix) == NULL)
    {
       user_stencil = hypre_StructMatrixUserStencil(matrix);
@@ -236,6 +247,33 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
       num_ghost[2 * d + 1] += extra_ghost[2 * d + 1];
    }
 
+   /*-----------------------------------------------------------------------
+    * Set up the storage descriptor of the stencil entries
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_StructMatrixEntryTypes(matrix) == NULL)
+   {
+      constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
+      entry_types = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < stencil_size; i++)
+      {
+         if ( constant_coefficient == 1 ||
+              (constant_coefficient == 2 && !hypre_IndexEqual(stencil_shape[i], 0, ndim)) )
+         {
+            entry_types[i] = HYPRE_STRUCT_ENTRY_CONSTANT;
+         }
+         else if (symm_elements[i] >= 0)
+         {
+            entry_types[i] = HYPRE_STRUCT_ENTRY_MIRRORED;
+         }
+         else
+         {
+            entry_types[i] = HYPRE_STRUCT_ENTRY_VARIABLE;
+         }
+      }
+      hypre_StructMatrixEntryTypes(matrix) = entry_types;
+   }
+
    /*-----------------------------------------------------------------------
     * Set up data_space
     *-----------------------------------------------------------------------*/
@@ -410,6 +448,11 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
          data_size       = 0;
       }
 #endif
+      /* a matrix-free matrix has no coefficient data */
+      if (hypre_StructMatrixMatrixFree(matrix))
+      {
+         data_size = 0;
+      }
       hypre_StructMatrixDataSize(matrix)      = data_size;
       hypre_StructMatrixDataConstSize(matrix) = data_const_size;
 
@@ -578,6 +621,12 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "A matrix-free matrix has no stored values");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -730,6 +779,12 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "A matrix-free matrix has no stored values");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -916,6 +971,12 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "A matrix-free matrix has no stored values");
+      return hypre_error_flag;
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1079,6 +1140,12 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "A matrix-free matrix has no stored values");
+      return hypre_error_flag;
+   }
+
    if (outside > 0)
    {
       grid_boxes = hypre_StructMatrixDataSpace(matrix);
@@ -1266,16 +1333,23 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
    HYPRE_Complex         *datap;
    HYPRE_Int              i, j, ei;
    HYPRE_Int              num_entries;
+   HYPRE_Int             *entry_offsets;
    /* End - variables for ghost layer identity code below */
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
+   /* a matrix-free matrix has no data to assemble */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set ghost zones along the domain boundary to the identity to enable code
     * simplifications elsewhere in hypre (e.g., CyclicReduction).
     *
-    * Intersect each data box with the BoxMan to get neighbors, then subtract
-    * the neighbors from the box to get the boundary boxes.
+    * Intersect all data boxes with the BoxMan to get neighbors, then subtract
+    * the neighbors from each box to get the boundary boxes.
     *-----------------------------------------------------------------------*/
 
    if ( constant_coefficient != 1 )
@@ -1284,6 +1358,8 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
       grid       = hypre_StructMatrixGrid(matrix);
       boxman     = hypre_StructGridBoxMan(grid);
 
+      hypre_BoxManIntersectBoxArray(boxman, data_space, &entries, &entry_offsets);
+
       boundary_boxes = hypre_BoxArrayArrayCreate(
                           hypre_BoxArraySize(data_space), ndim);
       entry_box_a    = hypre_BoxArrayCreate(0, ndim);
@@ -1296,25 +1372,22 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
          boundary_box = hypre_BoxArrayBox(boundary_box_a, 0);
          hypre_CopyBox(hypre_BoxArrayBox(data_space, i), boundary_box);
 
-         hypre_BoxManIntersect(boxman,
-                               hypre_BoxIMin(boundary_box),
-                               hypre_BoxIMax(boundary_box),
-                               &entries, &num_entries);
-
          /* put neighbor boxes into entry_box_a */
+         num_entries = entry_offsets[i + 1] - entry_offsets[i];
          hypre_BoxArraySetSize(entry_box_a, num_entries);
          for (ei = 0; ei < num_entries; ei++)
          {
             entry_box = hypre_BoxArrayBox(entry_box_a, ei);
-            hypre_BoxManEntryGetExtents(entries[ei],
+            hypre_BoxManEntryGetExtents(entries[entry_offsets[i] + ei],
                                         hypre_BoxIMin(entry_box),
                                         hypre_BoxIMax(entry_box));
          }
-         hypre_TFree(entries, HYPRE_MEMORY_HOST);
 
          /* subtract neighbor boxes (entry_box_a) from data box (boundary_box_a) */
          hypre_SubtractBoxArrays(boundary_box_a, entry_box_a, tmp_box_a);
       }
+      hypre_TFree(entries, HYPRE_MEMORY_HOST);
+      hypre_TFree(entry_offsets, HYPRE_MEMORY_HOST);
       hypre_BoxArrayDestroy(entry_box_a);
       hypre_BoxArrayDestroy(tmp_box_a);
 
@@ -1646,6 +1719,17 @@ hypre_StructMatrixPrint( const char         *filename,
    HYPRE_Int             center_rank;
    HYPRE_Int             myid;
 
+   /* print the coefficients of a matrix-free matrix */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_StructMatrix *stored = hypre_StructMatrixMaterialize(matrix);
+
+      hypre_StructMatrixPrint(filename, stored, all);
+      hypre_StructMatrixDestroy(stored);
+
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
    /*----------------------------------------
@@ -2041,3 +2125,101 @@ hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffFunction
+ *
+ * Makes the matrix matrix-free: no coefficient data is stored, and the
+ * coefficients are evaluated by coeff_fcn.  Must be called before the matrix
+ * is initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffFunction( hypre_StructMatrix         *matrix,
+                                    HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                                    void                       *coeff_data )
+{
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix-free struct matrices are host only");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_StructMatrixDataIndices(matrix) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "The coefficient function must be set before initialization");
+      return hypre_error_flag;
+   }
+
+   hypre_StructMatrixCoeffFcn(matrix)  = coeff_fcn;
+   hypre_StructMatrixCoeffData(matrix) = coeff_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixMaterialize
+ *
+ * Returns a new, assembled matrix that stores the coefficients of the
+ * matrix-free matrix 'matrix', with the same grid, stencil and ghost layers.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixMaterialize( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int                    ndim         = hypre_StructMatrixNDim(matrix);
+   hypre_BoxArray              *boxes        = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   HYPRE_Int                    stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_StructMatrixCoeffFcn   coeff_fcn    = hypre_StructMatrixCoeffFcn(matrix);
+   void                        *coeff_data   = hypre_StructMatrixCoeffData(matrix);
+
+   hypre_StructMatrix          *stored;
+   hypre_Box                   *box, *data_box;
+   HYPRE_Complex               *values, *datap;
+   hypre_Index                  loop_size, start, index;
+   HYPRE_Int                    i, n, r, s, ii, datai;
+
+   stored = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix),
+                                     hypre_StructMatrixGrid(matrix),
+                                     hypre_StructMatrixUserStencil(matrix));
+   hypre_StructMatrixSetNumGhost(stored, hypre_StructMatrixNumGhost(matrix));
+   hypre_StructMatrixInitialize(stored);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box      = hypre_BoxArrayBox(boxes, i);
+      data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(stored), i);
+      hypre_SetIndex(loop_size, 1);
+      hypre_BoxGetSize(box, loop_size);
+      n = loop_size[0];
+      if (hypre_BoxVolume(box) == 0)
+      {
+         continue;
+      }
+
+      /* evaluate the coefficients one grid row at a time */
+      values = hypre_TAlloc(HYPRE_Complex, stencil_size * n, HYPRE_MEMORY_HOST);
+      hypre_CopyToCleanIndex(hypre_BoxIMin(box), ndim, start);
+      hypre_CopyIndex(start, index);
+      for (r = 0; r < loop_size[1] * loop_size[2]; r++)
+      {
+         index[1] = start[1] + r % loop_size[1];
+         index[2] = start[2] + r / loop_size[1];
+         coeff_fcn(coeff_data, index, n, values);
+
+         datai = hypre_BoxIndexRank(data_box, index);
+         for (s = 0; s < stencil_size; s++)
+         {
+            datap = hypre_StructMatrixBoxData(stored, i, s) + datai;
+            for (ii = 0; ii < n; ii++)
+            {
+               datap[ii] = values[s * n + ii];
+            }
+         }
+      }
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_StructMatrixAssemble(stored);
+
+   return stored;
+}
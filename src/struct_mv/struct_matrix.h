@@ -47,16 +47,35 @@ typedef struct hypre_StructMatrix_struct
 
    HYPRE_Int             symmetric;                 /* Is the matrix symmetric */
    HYPRE_Int            *symm_elements;             /* Which elements are "symmetric" */
+   HYPRE_Int            *entry_types;               /* How each stencil entry is stored
+                                                       (HYPRE_STRUCT_ENTRY_*) */
    HYPRE_Int             num_ghost[2 * HYPRE_MAXDIM]; /* Num ghost layers in each direction */
 
    HYPRE_BigInt          global_size;               /* Total number of nonzero coeffs */
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn;           /* Coefficient function of a
+                                                       matrix-free matrix (or NULL) */
+   void                 *coeff_data;                /* Data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
 
+/*--------------------------------------------------------------------------
+ * Storage of a stencil entry of hypre_StructMatrix (entry_types):
+ *
+ * VARIABLE - one coefficient per grid point
+ * CONSTANT - one coefficient for all grid points
+ * MIRRORED - one coefficient per grid point, not stored, but taken from the
+ *            transpose coefficient at a neighboring point (symmetric storage)
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_STRUCT_ENTRY_VARIABLE 0
+#define HYPRE_STRUCT_ENTRY_CONSTANT 1
+#define HYPRE_STRUCT_ENTRY_MIRRORED 2
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_StructMatrix
  *--------------------------------------------------------------------------*/
@@ -77,10 +96,17 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixConstantCoefficient(matrix) ((matrix) -> constant_coefficient)
 #define hypre_StructMatrixSymmetric(matrix)           ((matrix) -> symmetric)
 #define hypre_StructMatrixSymmElements(matrix)        ((matrix) -> symm_elements)
+#define hypre_StructMatrixEntryTypes(matrix)          ((matrix) -> entry_types)
+#define hypre_StructMatrixEntryType(matrix, s)        ((matrix) -> entry_types[s])
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
+
+#define hypre_StructMatrixMatrixFree(matrix) \
+(hypre_StructMatrixCoeffFcn(matrix) != NULL)
 
 #define hypre_StructMatrixNDim(matrix) \
 hypre_StructGridNDim(hypre_StructMatrixGrid(matrix))
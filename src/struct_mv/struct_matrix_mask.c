@@ -125,6 +125,13 @@ hypre_StructMatrixCreateMask( hypre_StructMatrix *matrix,
          hypre_StructMatrixSymmElements(matrix)[i];
    }
 
+   hypre_StructMatrixEntryTypes(mask) = hypre_TAlloc(HYPRE_Int, mask_stencil_size, HYPRE_MEMORY_HOST);
+   for (i = 0; i < mask_stencil_size; i++)
+   {
+      hypre_StructMatrixEntryType(mask, i) =
+         hypre_StructMatrixEntryType(matrix, stencil_indices[i]);
+   }
+
    for (i = 0; i < 2 * ndim; i++)
    {
       hypre_StructMatrixNumGhost(mask)[i] =
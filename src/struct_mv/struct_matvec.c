@@ -29,6 +29,7 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            stencil_kernel; /* see hypre_StructMatvecStencilKernel */
 
 } hypre_StructMatvecData;
 
@@ -81,6 +82,12 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
 
+   /*----------------------------------------------------------
+    * Select a stencil-specialized kernel, if there is one
+    *----------------------------------------------------------*/
+
+   (matvec_data -> stencil_kernel) = hypre_StructMatvecStencilKernel(A);
+
    return hypre_error_flag;
 }
 
@@ -115,6 +122,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    hypre_IndexRef           stride;
 
    HYPRE_Int                constant_coefficient;
+   HYPRE_Int                stencil_kernel;
 
    HYPRE_Complex            temp;
    HYPRE_Int                compute_i, i;
@@ -128,7 +136,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
 
-   compute_pkg = (matvec_data -> compute_pkg);
+   compute_pkg    = (matvec_data -> compute_pkg);
+   stencil_kernel = (matvec_data -> stencil_kernel);
 
    stride = hypre_ComputePkgStride(compute_pkg);
 
@@ -184,10 +193,13 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             /*--------------------------------------------------------------
              * initialize y= (beta/alpha)*y normally (where everything
              * is multiplied by alpha at the end),
-             * beta*y for constant coefficient (where only Ax gets multiplied by alpha)
+             * beta*y for constant coefficient, for the stencil-specialized
+             * kernels and for matrix-free A (where only Ax gets multiplied
+             * by alpha)
              *--------------------------------------------------------------*/
 
-            if ( constant_coefficient == 1 )
+            if ( constant_coefficient == 1 || stencil_kernel ||
+                 hypre_StructMatrixMatrixFree(A) )
             {
                temp = beta;
             }
@@ -248,25 +260,39 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
-      switch ( constant_coefficient )
+      if (stencil_kernel)
       {
-         case 0:
-         {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
-            break;
-         }
-         case 1:
-         {
-            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
-            break;
-         }
-         case 2:
+         hypre_StructMatvecStencil( alpha, A, x, y, compute_box_aa, stride,
+                                    stencil_kernel );
+      }
+      else
+      {
+         switch ( constant_coefficient )
          {
-            hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
-            break;
+            case 0:
+            {
+               if (hypre_StructMatrixMatrixFree(A))
+               {
+                  hypre_StructMatvecMatrixFree( alpha, A, x, y, compute_box_aa, stride );
+               }
+               else
+               {
+                  hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+               }
+               break;
+            }
+            case 1:
+            {
+               hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+               break;
+            }
+            case 2:
+            {
+               hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
+               break;
+            }
          }
       }
-
    }
 
    if (x_tmp)
@@ -378,10 +404,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 6]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -392,7 +418,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap5[Ai] * xp[xi + xoff5] +
                         Ap6[Ai] * xp[xi + xoff6];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -419,10 +445,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 5]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -432,7 +458,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap4[Ai] * xp[xi + xoff4] +
                         Ap5[Ai] * xp[xi + xoff5];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -456,10 +482,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 4]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -468,7 +494,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap3[Ai] * xp[xi + xoff3] +
                         Ap4[Ai] * xp[xi + xoff4];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -489,10 +515,10 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 3]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
@@ -500,7 +526,7 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                         Ap2[Ai] * xp[xi + xoff2] +
                         Ap3[Ai] * xp[xi + xoff3];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -518,17 +544,17 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 2]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1] +
                         Ap2[Ai] * xp[xi + xoff2];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -543,16 +569,16 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 1]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0] +
                         Ap1[Ai] * xp[xi + xoff1];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -564,15 +590,15 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                                   stencil_shape[si + 0]);
 
 #define DEVICE_VAR is_device_ptr(yp,Ap0,xp)
-                  hypre_BoxLoop3Begin(ndim, loop_size,
-                                      A_data_box, start, stride, Ai,
-                                      x_data_box, start, stride, xi,
-                                      y_data_box, start, stride, yi);
+                  hypre_BoxLoop3TiledBegin(ndim, loop_size,
+                                           A_data_box, start, stride, Ai,
+                                           x_data_box, start, stride, xi,
+                                           y_data_box, start, stride, yi);
                   {
                      yp[yi] +=
                         Ap0[Ai] * xp[xi + xoff0];
                   }
-                  hypre_BoxLoop3End(Ai, xi, yi);
+                  hypre_BoxLoop3TiledEnd(Ai, xi, yi);
 #undef DEVICE_VAR
 
                   break;
@@ -597,6 +623,301 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * Stencil-specialized kernels
+ *
+ * For compact stencils (all offsets in {-1,0,1}) with 5, 7, 9, 19, or 27
+ * entries, y += alpha*A*x is computed in a single pass over y, with the sum
+ * over the stencil entries fully unrolled.  The box loop runs over the rows
+ * of a compute box, and the unit-stride x direction is an inner loop that is
+ * vectorized.  These kernels are only used with the host box loops.
+ *
+ * Each stencil entry may be stored in any way (see the entry types of
+ * hypre_StructMatrix), so that mixed constant and variable stencils also take
+ * a single pass.  A constant entry is read from a row of copies of its value,
+ * which keeps the inner loop the same for all entries.
+ *--------------------------------------------------------------------------*/
+
+#if !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_RAJA) && \
+    !defined(HYPRE_USING_KOKKOS) && !defined(HYPRE_USING_CUDA) && \
+    !defined(HYPRE_USING_HIP) && !defined(HYPRE_USING_SYCL)
+#define HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+#endif
+
+#define HYPRE_STRUCT_MATVEC_STENCIL_MAX 27
+
+#if defined(HYPRE_USING_OPENMP)
+#define hypre_StencilSimd _Pragma("omp simd")
+#elif defined(__clang__)
+#define hypre_StencilSimd _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define hypre_StencilSimd _Pragma("GCC ivdep")
+#else
+#define hypre_StencilSimd
+#endif
+
+#define hypre_StencilTerm(k, ii) (Arow[k][ii] * xp[k][xi + ii])
+
+#define hypre_StencilSum5(ii)                                    \
+   (hypre_StencilTerm(0, ii) + hypre_StencilTerm(1, ii) +        \
+    hypre_StencilTerm(2, ii) + hypre_StencilTerm(3, ii) +        \
+    hypre_StencilTerm(4, ii))
+
+#define hypre_StencilSum7(ii)                                    \
+   (hypre_StencilSum5(ii) +                                      \
+    hypre_StencilTerm(5, ii) + hypre_StencilTerm(6, ii))
+
+#define hypre_StencilSum9(ii)                                    \
+   (hypre_StencilSum7(ii) +                                      \
+    hypre_StencilTerm(7, ii) + hypre_StencilTerm(8, ii))
+
+#define hypre_StencilSum19(ii)                                   \
+   (hypre_StencilSum9(ii) +                                      \
+    hypre_StencilTerm( 9, ii) + hypre_StencilTerm(10, ii) +      \
+    hypre_StencilTerm(11, ii) + hypre_StencilTerm(12, ii) +      \
+    hypre_StencilTerm(13, ii) + hypre_StencilTerm(14, ii) +      \
+    hypre_StencilTerm(15, ii) + hypre_StencilTerm(16, ii) +      \
+    hypre_StencilTerm(17, ii) + hypre_StencilTerm(18, ii))
+
+#define hypre_StencilSum27(ii)                                   \
+   (hypre_StencilSum19(ii) +                                     \
+    hypre_StencilTerm(19, ii) + hypre_StencilTerm(20, ii) +      \
+    hypre_StencilTerm(21, ii) + hypre_StencilTerm(22, ii) +      \
+    hypre_StencilTerm(23, ii) + hypre_StencilTerm(24, ii) +      \
+    hypre_StencilTerm(25, ii) + hypre_StencilTerm(26, ii))
+
+/* y += alpha*A*x on the row segments of the tiles of the current compute box */
+#define hypre_StructMatvecStencilLoop(SUM)                                   \
+   hypre_BoxLoop3TiledRowsBegin(ndim, loop_size,                             \
+                                A_data_box, start, stride, Ai,               \
+                                x_data_box, start, stride, xi,               \
+                                y_data_box, start, stride, yi, nx);          \
+   {                                                                         \
+      HYPRE_Complex *Arow[HYPRE_STRUCT_MATVEC_STENCIL_MAX];                  \
+      HYPRE_Int      ii, k;                                                  \
+                                                                             \
+      for (k = 0; k < kernel; k++)                                           \
+      {                                                                      \
+         Arow[k] = Avar[k] ? (Ap[k] + Ai) : Ap[k];                           \
+      }                                                                      \
+      if (sx == 1)                                                           \
+      {                                                                      \
+         hypre_StencilSimd                                                   \
+         for (ii = 0; ii < nx; ii++)                                         \
+         {                                                                   \
+            yp[yi + ii] += alpha * SUM(ii);                                  \
+         }                                                                   \
+      }                                                                      \
+      else                                                                   \
+      {                                                                      \
+         for (ii = 0; ii < nx * sx; ii += sx)                                \
+         {                                                                   \
+            yp[yi + ii] += alpha * SUM(ii);                                  \
+         }                                                                   \
+      }                                                                      \
+   }                                                                         \
+   hypre_BoxLoop3TiledRowsEnd(Ai, xi, yi)
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencilKernel
+ *
+ * Returns the stencil size if A can use one of the stencil-specialized
+ * kernels in hypre_StructMatvecStencil, and 0 otherwise.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecStencilKernel( hypre_StructMatrix *A )
+{
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             si, d;
+
+   /* with all entries constant, hypre_StructMatvecCC1 keeps them in registers */
+   if (hypre_StructMatrixConstantCoefficient(A) == 1 ||
+       hypre_StructMatrixMatrixFree(A))
+   {
+      return 0;
+   }
+
+   switch (stencil_size)
+   {
+      case 5:
+      case 7:
+      case 9:
+      case 19:
+      case 27:
+         break;
+
+      default:
+         return 0;
+   }
+
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < HYPRE_MAXDIM; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            return 0;
+         }
+      }
+   }
+
+   return stencil_size;
+#else
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecStencil
+ *
+ * Computes y += alpha*A*x on the boxes of compute_box_aa, using the kernel
+ * for 'kernel' stencil entries (as returned by
+ * hypre_StructMatvecStencilKernel).  Unlike hypre_StructMatvecCC0 and
+ * hypre_StructMatvecCC2, y is not scaled by alpha afterwards.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecStencil( HYPRE_Complex        alpha,
+                           hypre_StructMatrix  *A,
+                           hypre_StructVector  *x,
+                           hypre_StructVector  *y,
+                           hypre_BoxArrayArray *compute_box_aa,
+                           hypre_IndexRef       stride,
+                           HYPRE_Int            kernel )
+{
+#ifdef HYPRE_STRUCT_MATVEC_STENCIL_KERNELS
+   HYPRE_Int                i, j, si, ii, c, nc, row_size;
+   HYPRE_Complex           *Ap[HYPRE_STRUCT_MATVEC_STENCIL_MAX];
+   HYPRE_Complex           *xp[HYPRE_STRUCT_MATVEC_STENCIL_MAX];
+   HYPRE_Int                Avar[HYPRE_STRUCT_MATVEC_STENCIL_MAX];
+   HYPRE_Complex           *const_rows;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim, sx;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+   sx            = hypre_IndexD(stride, 0);
+
+   if (kernel != hypre_StructStencilSize(stencil))
+   {
+      hypre_error_in_arg(7);
+      return hypre_error_flag;
+   }
+
+   /* count the constant entries */
+   nc = 0;
+   for (si = 0; si < kernel; si++)
+   {
+      Avar[si] = (hypre_StructMatrixEntryType(A, si) != HYPRE_STRUCT_ENTRY_CONSTANT);
+      if (!Avar[si])
+      {
+         nc++;
+      }
+   }
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      yp = hypre_StructVectorBoxData(y, i);
+      for (si = 0; si < kernel; si++)
+      {
+         xp[si] = hypre_StructVectorBoxData(x, i) +
+                  hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         /* a row of copies of the value of each constant entry */
+         row_size   = hypre_IndexD(loop_size, 0) * sx;
+         const_rows = NULL;
+         if (nc > 0 && row_size > 0)
+         {
+            const_rows = hypre_TAlloc(HYPRE_Complex, nc * row_size, HYPRE_MEMORY_HOST);
+         }
+         c = 0;
+         for (si = 0; si < kernel; si++)
+         {
+            Ap[si] = hypre_StructMatrixBoxData(A, i, si);
+            if (!Avar[si] && const_rows != NULL)
+            {
+               for (ii = 0; ii < row_size; ii++)
+               {
+                  const_rows[c * row_size + ii] = Ap[si][0];
+               }
+               Ap[si] = const_rows + c * row_size;
+               c++;
+            }
+         }
+
+         switch (kernel)
+         {
+            case 5:
+               hypre_StructMatvecStencilLoop(hypre_StencilSum5);
+               break;
+
+            case 7:
+               hypre_StructMatvecStencilLoop(hypre_StencilSum7);
+               break;
+
+            case 9:
+               hypre_StructMatvecStencilLoop(hypre_StencilSum9);
+               break;
+
+            case 19:
+               hypre_StructMatvecStencilLoop(hypre_StencilSum19);
+               break;
+
+            case 27:
+               hypre_StructMatvecStencilLoop(hypre_StencilSum27);
+               break;
+         }
+
+         hypre_TFree(const_rows, HYPRE_MEMORY_HOST);
+      }
+   }
+#else
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Stencil kernels require the host box loops");
+#endif
+
+   return hypre_error_flag;
+}
+
+#undef hypre_StructMatvecStencilLoop
+#undef hypre_StencilSum27
+#undef hypre_StencilSum19
+#undef hypre_StencilSum9
+#undef hypre_StencilSum7
+#undef hypre_StencilSum5
+#undef hypre_StencilTerm
+#undef hypre_StencilSimd
+
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC1
  * core of struct matvec computation, for the case constant_coefficient==1
@@ -1373,6 +1694,126 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecMatrixFree
+ *
+ * Computes y += alpha*A*x on the boxes of compute_box_aa for a matrix-free A.
+ * The coefficients are evaluated one grid row at a time into a per-thread
+ * buffer.  As in hypre_StructMatvecStencil, y is not scaled by alpha
+ * afterwards.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecMatrixFree( HYPRE_Complex        alpha,
+                              hypre_StructMatrix  *A,
+                              hypre_StructVector  *x,
+                              hypre_StructVector  *y,
+                              hypre_BoxArrayArray *compute_box_aa,
+                              hypre_IndexRef       stride )
+{
+   HYPRE_Int                    ndim          = hypre_StructVectorNDim(x);
+   hypre_StructStencil         *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index                 *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                    stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_StructMatrixCoeffFcn   coeff_fcn     = hypre_StructMatrixCoeffFcn(A);
+   void                        *coeff_data    = hypre_StructMatrixCoeffData(A);
+   HYPRE_Int                    num_threads   = hypre_NumThreads();
+
+   hypre_BoxArray              *compute_box_a;
+   hypre_Box                   *compute_box;
+   hypre_Box                   *x_data_box;
+   hypre_Box                   *y_data_box;
+   HYPRE_Complex               *xp, *yp, *buffer;
+   HYPRE_Int                   *xoff;
+   hypre_Index                  loop_size, start;
+   HYPRE_Int                    i, j, d, si, n, r, num_rows, buffer_size;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if (hypre_IndexD(stride, d) != 1)
+      {
+         hypre_error_in_arg(6);
+         return hypre_error_flag;
+      }
+   }
+
+   xoff = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         hypre_SetIndex(loop_size, 1);
+         hypre_BoxGetSize(compute_box, loop_size);
+         hypre_CopyToCleanIndex(hypre_BoxIMin(compute_box), ndim, start);
+         n           = loop_size[0];
+         num_rows    = loop_size[1] * loop_size[2];
+         buffer_size = (stencil_size + 1) * n;
+         buffer      = hypre_TAlloc(HYPRE_Complex, buffer_size * num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(r) HYPRE_SMP_SCHEDULE
+#endif
+         for (r = 0; r < num_rows; r++)
+         {
+            HYPRE_Complex *values = buffer + hypre_GetThreadNum() * buffer_size;
+            HYPRE_Complex *sum    = values + stencil_size * n;
+            HYPRE_Complex *vp, *xsp;
+            hypre_Index    index;
+            HYPRE_Int      xi, yi, s, ii;
+
+            hypre_CopyIndex(start, index);
+            index[1] += r % loop_size[1];
+            index[2] += r / loop_size[1];
+            coeff_fcn(coeff_data, index, n, values);
+
+            xi = hypre_BoxIndexRank(x_data_box, index);
+            yi = hypre_BoxIndexRank(y_data_box, index);
+            for (ii = 0; ii < n; ii++)
+            {
+               sum[ii] = 0.0;
+            }
+            for (s = 0; s < stencil_size; s++)
+            {
+               vp  = values + s * n;
+               xsp = xp + xi + xoff[s];
+               for (ii = 0; ii < n; ii++)
+               {
+                  sum[ii] += vp[ii] * xsp[ii];
+               }
+            }
+            for (ii = 0; ii < n; ii++)
+            {
+               yp[yi + ii] += alpha * sum[ii];
+            }
+         }
+
+         hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
@@ -18,6 +18,9 @@ diff -bI"time" solvers.out.4 solvers.out.5 >&2
 diff -bI"time" solvers.out.6 solvers.out.7 >&2
 diff -bI"time" solvers.out.8 solvers.out.9 >&2
 diff -bI"time" solvers.out.10 solvers.out.11 >&2
+diff -bI"time" solvers.out.13 solvers.out.14 >&2
+diff -bI"time" solvers.out.15 solvers.out.16 >&2
+diff -bI"time" solvers.out.17 solvers.out.18 >&2
 
 #=============================================================================
 # compare with baseline case
@@ -81,6 +84,42 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+FILES="\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+"
+for i in $FILES
+do
+  echo "# Output file: $i"
+  grep -E "^(Sweep|Iterations|Final)" $i
+done > ${TNAME}.out.d
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Sweep s = 3" ${TNAME}.out.d | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
+FILES="\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
+ ${TNAME}.out.18\
+"
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -4 $i
+done > ${TNAME}.out.e
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Iterations" ${TNAME}.out.e | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
@@ -45,6 +45,12 @@ tail -3 ${TNAME}.out.10 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.11 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+
+tail -3 ${TNAME}.out.12 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -58,6 +64,8 @@ FILES="\
  ${TNAME}.out.7\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
+ ${TNAME}.out.12\
+ ${TNAME}.out.13\
 "
 #  ${TNAME}.out.2\
 #  ${TNAME}.out.3\
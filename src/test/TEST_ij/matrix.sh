@@ -57,6 +57,24 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
 fi
 
+FILES="\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -2 $i
+done >> ${TNAME}.out
+
+# Make sure that the output file is reasonable
+RUNCOUNT=`echo $FILES | wc -w`
+OUTCOUNT=`grep "Updated" ${TNAME}.out | wc -l`
+if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
+   echo "Incorrect number of runs in ${TNAME}.out" >&2
+fi
+
 #=============================================================================
 # remove temporary files
 #=============================================================================
@@ -49,6 +49,13 @@ tail -3 ${TNAME}.out.403.p | head -2 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.403.n | head -2 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+for i in 404 405
+do
+  grep -A 1000 "^Iters" ${TNAME}.out.$i.t1 | grep -v "time" > ${TNAME}.testdata
+  grep -A 1000 "^Iters" ${TNAME}.out.$i.t4 | grep -v "time" > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -146,6 +153,21 @@ FILES="\
  ${TNAME}.out.121\
  ${TNAME}.out.122\
  ${TNAME}.out.120\
+ ${TNAME}.out.123\
+ ${TNAME}.out.124\
+ ${TNAME}.out.125\
+ ${TNAME}.out.126\
+ ${TNAME}.out.127\
+ ${TNAME}.out.128\
+ ${TNAME}.out.129\
+ ${TNAME}.out.130\
+ ${TNAME}.out.131\
+ ${TNAME}.out.132\
+ ${TNAME}.out.133\
+ ${TNAME}.out.134\
+ ${TNAME}.out.135\
+ ${TNAME}.out.136\
+ ${TNAME}.out.137\
 "
 
 for i in $FILES
@@ -26,6 +26,17 @@ tail -3 ${TNAME}.out.10 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.11 > ${TNAME}.testdata.temp
 (../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
 
+#=============================================================================
+#=============================================================================
+
+tail -3 ${TNAME}.out.20 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.21 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
+tail -3 ${TNAME}.out.22 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.23 > ${TNAME}.testdata.temp
+(../runcheck.sh ${TNAME}.testdata ${TNAME}.testdata.temp $RTOL $ATOL) >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -37,6 +48,10 @@ FILES="\
  ${TNAME}.out.3\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
+ ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
+ ${TNAME}.out.23\
  ${TNAME}.out.50\
  ${TNAME}.out.51\
  ${TNAME}.out.52\
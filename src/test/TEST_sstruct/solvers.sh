@@ -8,6 +8,30 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# shared ParCSR vector data must give the same results as the SStruct vectors
+#=============================================================================
+
+tail -3 ${TNAME}.out.21 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.22 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.23 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.24 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# the nodal relaxation must not depend on the processor layout
+#=============================================================================
+
+tail -3 ${TNAME}.out.26 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.27 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.28 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.29 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -30,6 +54,11 @@ FILES="\
  ${TNAME}.out.18\
  ${TNAME}.out.19\
  ${TNAME}.out.20\
+ ${TNAME}.out.22\
+ ${TNAME}.out.24\
+ ${TNAME}.out.25\
+ ${TNAME}.out.27\
+ ${TNAME}.out.29\
 "
 # ${TNAME}.out.5\
 # ${TNAME}.out.6\
@@ -8,6 +8,73 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# datatype receives must give the same results as packed receives
+#=============================================================================
+
+for i in 7 8
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# temporal blocking must not change the iterates
+#=============================================================================
+
+for i in 9 10 11
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# matrix-free matrices must give the same results as stored ones
+#=============================================================================
+
+for i in 12 13
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# mirrored and constant stencil entries must not change the results
+#=============================================================================
+
+for i in 14 15
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# the box layout must not change the results
+#=============================================================================
+
+for i in 16 17
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+#=============================================================================
+# local line solves must give the same results as the cyclic reduction
+# across processes
+#=============================================================================
+
+for i in 19 20 21
+do
+  tail -3 ${TNAME}.out.$i.t0 > ${TNAME}.testdata
+  tail -3 ${TNAME}.out.$i.t1 > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -18,6 +85,22 @@ FILES="\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
+ ${TNAME}.out.5\
+ ${TNAME}.out.6\
+ ${TNAME}.out.7.t1\
+ ${TNAME}.out.8.t1\
+ ${TNAME}.out.9.t1\
+ ${TNAME}.out.10.t1\
+ ${TNAME}.out.11.t1\
+ ${TNAME}.out.12.t1\
+ ${TNAME}.out.13.t1\
+ ${TNAME}.out.14.t1\
+ ${TNAME}.out.15.t1\
+ ${TNAME}.out.16.t1\
+ ${TNAME}.out.17.t1\
+ ${TNAME}.out.19.t1\
+ ${TNAME}.out.20.t1\
+ ${TNAME}.out.21.t1\
 "
 
 for i in $FILES
@@ -26,8 +109,13 @@ do
   tail -3 $i
 done > ${TNAME}.out
 
+# the statistics follow the results, so pick out the lines to compare
+echo "# Output file: ${TNAME}.out.18" >> ${TNAME}.out
+grep -e "^Iterations" -e "^Final" -e "^CommInfo" ${TNAME}.out.18 >> ${TNAME}.out
+echo "" >> ${TNAME}.out
+
 # Make sure that the output file is reasonable
-RUNCOUNT=`echo $FILES | wc -w`
+RUNCOUNT=`echo $FILES ${TNAME}.out.18 | wc -w`
 OUTCOUNT=`grep "Iterations" ${TNAME}.out | wc -l`
 if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out" >&2
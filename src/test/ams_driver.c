@@ -109,6 +109,7 @@ hypre_int main (hypre_int argc, char *argv[])
    HYPRE_Real rtol;
    HYPRE_Int rr;
    HYPRE_Int zero_cond;
+   HYPRE_Int sweep;
    HYPRE_Int blockSize;
    HYPRE_Solver solver, precond;
 
@@ -173,6 +174,7 @@ hypre_int main (hypre_int argc, char *argv[])
    rtol = 0;
    rr = 0;
    zero_cond = 0;
+   sweep = 0;
 
    /* Parse command line */
    {
@@ -296,6 +298,11 @@ hypre_int main (hypre_int argc, char *argv[])
             arg_index++;
             zero_cond = 1;
          }
+         else if ( strcmp(argv[arg_index], "-sweep") == 0 )
+         {
+            arg_index++;
+            sweep = atoi(argv[arg_index++]);
+         }
          else if ( strcmp(argv[arg_index], "-help") == 0 )
          {
             print_usage = 1;
@@ -327,6 +334,7 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("                           5  - AME eigensolver                \n");
          hypre_printf("    -maxit <num>         : maximum number of iterations (100)  \n");
          hypre_printf("    -tol <num>           : convergence tolerance (1e-6)        \n");
+         hypre_printf("    -sweep <num>         : re-setup and solve A + s M, s=1..num\n");
          hypre_printf("\n");
          hypre_printf("  AMS solver options:                                          \n");
          hypre_printf("    -dim <num>           : space dimension                     \n");
@@ -718,6 +726,62 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("\n");
       }
 
+      /* Coefficient sweep: set up and solve again with A + s M for s = 1, ...,
+         sweep.  These matrices have the sparsity pattern of A, so the
+         preconditioner is re-set up numerically, keeping its structure. */
+      if (sweep > 0)
+      {
+         HYPRE_ParCSRMatrix A_s;
+         HYPRE_Int          s;
+
+         AMSDriverMatrixRead("mfem.M", &M);
+         hypre_ParCSRMatrixMigrate(M, hypre_HandleMemoryLocation(hypre_handle()));
+
+         if (solver_id == 1)
+         {
+            HYPRE_PCGSetPrecond(solver,
+                                (HYPRE_PtrToSolverFcn) HYPRE_BoomerAMGSolve,
+                                (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSetupNumeric,
+                                precond);
+         }
+         else if (solver_id == 3)
+         {
+            HYPRE_AMSSetReuse(precond, 1);
+         }
+
+         for (s = 1; s <= sweep; s++)
+         {
+            hypre_ParCSRMatrixAdd(1.0, (hypre_ParCSRMatrix *) A, (HYPRE_Complex) s,
+                                  (hypre_ParCSRMatrix *) M, (hypre_ParCSRMatrix **) &A_s);
+            HYPRE_ParVectorSetConstantValues(x0, 0.0);
+
+            time_index = hypre_InitializeTiming("PCG Re-setup");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_ParCSRPCGSetup(solver, A_s, b, x0);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_ParCSRPCGSolve(solver, A_s, b, x0);
+
+            HYPRE_PCGGetNumIterations(solver, &num_iterations);
+            HYPRE_PCGGetFinalRelativeResidualNorm(solver, &final_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("Sweep s = %d\n", s);
+               hypre_printf("Iterations = %d\n", num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+
+            HYPRE_ParCSRMatrixDestroy(A_s);
+         }
+      }
+
       /* Destroy solver and preconditioner */
       HYPRE_ParCSRPCGDestroy(solver);
       if (solver_id == 1)
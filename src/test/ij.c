@@ -97,6 +97,9 @@ extern HYPRE_Int hypre_FlexGMRESModifyPCAMGExample(void *precond_data, HYPRE_Int
 
 extern HYPRE_Int hypre_FlexGMRESModifyPCDefault(void *precond_data, HYPRE_Int iteration,
                                                 HYPRE_Real rel_residual_norm);
+
+extern HYPRE_Int hypre_BoomerAMGSetupNumeric(void *amg_vdata, hypre_ParCSRMatrix *A,
+                                             hypre_ParVector *f, hypre_ParVector *u);
 #ifdef __cplusplus
 }
 #endif
@@ -160,6 +163,17 @@ main( hypre_int argc,
    HYPRE_ParVector     *interp_vecs = NULL;
    HYPRE_ParVector     residual = NULL;
    HYPRE_ParVector     x0_save = NULL;
+   hypre_ParCSRMatrix *A_s = NULL;  /* numeric AMG re-setups */
+
+   /* load-balancing repartitioning of the system */
+   HYPRE_Int           repartition = 0;
+   hypre_ParCSRMatrix *parcsr_Q = NULL;
+   HYPRE_ParCSRMatrix  parcsr_A_orig = NULL;
+   HYPRE_ParVector     b_orig = NULL;
+   HYPRE_ParVector     x_orig = NULL;
+   HYPRE_Int           repart_coord_dim = 0;
+   float              *repart_coordinates = NULL;
+   HYPRE_Int           local_reordering = 0;
 
    HYPRE_Solver        amg_solver;
    HYPRE_Solver        amgdd_solver;
@@ -226,6 +240,10 @@ main( hypre_int argc,
    HYPRE_Int      P_max_elmts = 4;
    HYPRE_Int      cycle_type;
    HYPRE_Int      fcycle;
+   HYPRE_Int      kcycle = 0;
+   HYPRE_Real     kcycle_tol = 0.25;
+   HYPRE_Int      kcycle_num_levels = 0;
+   HYPRE_Int     *kcycle_levels = NULL;
    HYPRE_Int      coarsen_type = 10;
    HYPRE_Int      measure_type = 0;
    HYPRE_Int      num_sweeps = 1;
@@ -249,6 +267,9 @@ main( hypre_int argc,
    /* redundant coarse grid solve */
    HYPRE_Int      seq_threshold = 0;
    HYPRE_Int      redundant = 0;
+   HYPRE_Int      agglom_threshold = 0;
+   HYPRE_Int      agglom_factor = 8;
+   HYPRE_Real     repart_threshold = 0.0;
    /* additive versions */
    HYPRE_Int    additive = -1;
    HYPRE_Int    mult_add = -1;
@@ -259,6 +280,7 @@ main( hypre_int argc,
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    fuse_residual = 0;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -341,6 +363,9 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    repro_sums = 0;
+   HYPRE_Int    nthreads = 0;
+   HYPRE_Int    num_resetups = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -1409,6 +1434,21 @@ main( hypre_int argc,
          arg_index++;
          redundant  = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-agglom_th") == 0 )
+      {
+         arg_index++;
+         agglom_threshold  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-agglom_factor") == 0 )
+      {
+         arg_index++;
+         agglom_factor  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-repart_th") == 0 )
+      {
+         arg_index++;
+         repart_threshold  = atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cutf") == 0 )
       {
          arg_index++;
@@ -1608,6 +1648,26 @@ main( hypre_int argc,
          arg_index++;
          fcycle  = 1;
       }
+      else if ( strcmp(argv[arg_index], "-kcycle") == 0 )
+      {
+         arg_index++;
+         kcycle  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-kcycle_tol") == 0 )
+      {
+         arg_index++;
+         kcycle_tol  = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-kcycle_levels") == 0 )
+      {
+         arg_index++;
+         kcycle_num_levels = atoi(argv[arg_index++]);
+         kcycle_levels = hypre_CTAlloc(HYPRE_Int, hypre_max(kcycle_num_levels, 1), HYPRE_MEMORY_HOST);
+         for (i = 0; i < kcycle_num_levels; i++)
+         {
+            kcycle_levels[i] = atoi(argv[arg_index++]);
+         }
+      }
       else if ( strcmp(argv[arg_index], "-numsamp") == 0 )
       {
          arg_index++;
@@ -1748,6 +1808,11 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fuse_res") == 0 )
+      {
+         arg_index++;
+         fuse_residual  = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1770,6 +1835,31 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-repro_sums") == 0 )
+      {
+         arg_index++;
+         repro_sums = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         nthreads = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup") == 0 )
+      {
+         arg_index++;
+         num_resetups = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-repartition") == 0 )
+      {
+         arg_index++;
+         repartition = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-reorder") == 0 )
+      {
+         arg_index++;
+         local_reordering = atoi(argv[arg_index++]);
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1963,6 +2053,7 @@ main( hypre_int argc,
          hypre_printf("       80=ILU      81=ILU-GMRES  \n");
          hypre_printf("       82=ILU-FlexGMRES  \n");
          hypre_printf("       90=AMG-DD          91=AMG-DD-GMRES  \n");
+         hypre_printf("       -1=matvec test     -2=transpose plan test\n");
          hypre_printf("\n");
          hypre_printf("  -cljp                 : CLJP coarsening \n");
          hypre_printf("  -cljp1                : CLJP coarsening, fixed random \n");
@@ -2058,6 +2149,9 @@ main( hypre_int argc,
          hypre_printf("  -ns_up      <val>       : set no. of sweeps for up cycle\n");
          hypre_printf("\n");
          hypre_printf("  -mu   <val>            : set AMG cycles (1=V, 2=W, etc.)\n");
+         hypre_printf("  -kcycle <val>          : K-cycle acceleration (0=none, 1=FCG, 2=GCR)\n");
+         hypre_printf("  -kcycle_tol <val>      : K-cycle tolerance (default 0.25)\n");
+         hypre_printf("  -kcycle_levels <n> <l1> ... <ln> : K-cycle accelerated levels\n");
          hypre_printf("  -cutf <val>            : set coarsening cut factor for dense rows\n");
          hypre_printf("  -th   <val>            : set AMG threshold Theta = val \n");
          hypre_printf("  -tr   <val>            : set AMG interpolation truncation factor = val \n");
@@ -2087,6 +2181,10 @@ main( hypre_int argc,
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -fuse_res <val>        : fused residual and restriction in AMG cycle (default:0)\n");
+         hypre_printf("  -agglom_th <val>       : agglomerate coarse levels below val rows per proc (default:0)\n");
+         hypre_printf("  -agglom_factor <val>   : reduction of active procs per agglomeration (default:8)\n");
+         hypre_printf("  -repart_th <val>       : repartition coarse levels with max/avg nnz above val (default:0)\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2109,6 +2207,15 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -repro_sums            : reproducible inner products and norms\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (default: environment)\n");
+         hypre_printf("  -resetup <val>         : AMG only: re-setup numerically and solve again\n");
+         hypre_printf("                           with the diagonal of A scaled by 1 + s/4, s=1..val\n");
+         hypre_printf("  -repartition           : solve on a row partitioning balanced in nonzeros\n");
+         hypre_printf("                           (along a space-filling curve for laplacians)\n");
+         hypre_printf("  -reorder <val>         : reorder the local rows for cache locality\n");
+         hypre_printf("                           1=RCM, 2=space-filling curve for laplacians;\n");
+         hypre_printf("                           coarse AMG levels use RCM (default: 0=none)\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2305,6 +2412,14 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* bitwise reproducible inner products */
+   HYPRE_SetReproducibleSums(repro_sums);
+
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+
 #if defined(HYPRE_USING_GPU)
    /* use cuSPARSE for SpGEMM */
    ierr = HYPRE_SetSpGemmUseCusparse(spgemm_use_cusparse); hypre_assert(ierr == 0);
@@ -3374,6 +3489,103 @@ main( hypre_int argc,
    hypre_ParVectorMigrate(b, hypre_HandleMemoryLocation(hypre_handle()));
    hypre_ParVectorMigrate(x, hypre_HandleMemoryLocation(hypre_handle()));
 
+   /*-----------------------------------------------------------
+    * Repartition or reorder the system; the solution is moved back below
+    *-----------------------------------------------------------*/
+
+   if (repartition && (num_functions > 1 || plot_grids))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: -repartition is ignored with systems and -plot_grids\n");
+      }
+      repartition = 0;
+   }
+
+   if (repartition)
+   {
+      if (build_matrix_type > 1 && build_matrix_type < 8)
+      {
+         BuildParCoordinates(argc, argv, build_matrix_arg_index,
+                             &repart_coord_dim, &repart_coordinates);
+      }
+
+      time_index = hypre_InitializeTiming("Repartition");
+      hypre_BeginTiming(time_index);
+
+      parcsr_A_orig = parcsr_A;
+      b_orig = b;
+      x_orig = x;
+      hypre_ParCSRMatrixRepartition(parcsr_A_orig, repart_coord_dim, repart_coordinates,
+                                    &parcsr_Q, &parcsr_A);
+      if (parcsr_Q)
+      {
+         hypre_ParVectorRepartition(parcsr_Q, b_orig, &b);
+         hypre_ParVectorRepartition(parcsr_Q, x_orig, &x);
+      }
+      else
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Warning: the repartitioning failed and is ignored\n");
+         }
+         parcsr_A = parcsr_A_orig;
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Repartition times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      hypre_TFree(repart_coordinates, HYPRE_MEMORY_HOST);
+   }
+
+   if (local_reordering && (repartition || num_functions > 1 || plot_grids))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: -reorder of the fine level is ignored with -repartition,\n");
+         hypre_printf("         systems and -plot_grids\n");
+      }
+   }
+   else if (local_reordering)
+   {
+      if (local_reordering == 2 && build_matrix_type > 1 && build_matrix_type < 8)
+      {
+         BuildParCoordinates(argc, argv, build_matrix_arg_index,
+                             &repart_coord_dim, &repart_coordinates);
+      }
+
+      time_index = hypre_InitializeTiming("Local reordering");
+      hypre_BeginTiming(time_index);
+
+      parcsr_A_orig = parcsr_A;
+      b_orig = b;
+      x_orig = x;
+      hypre_ParCSRMatrixReorderLocal(parcsr_A_orig, repart_coord_dim, repart_coordinates,
+                                     &parcsr_Q, &parcsr_A);
+      if (parcsr_Q)
+      {
+         hypre_ParVectorRepartition(parcsr_Q, b_orig, &b);
+         hypre_ParVectorRepartition(parcsr_Q, x_orig, &x);
+      }
+      else
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Warning: the local reordering failed and is ignored\n");
+         }
+         parcsr_A = parcsr_A_orig;
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Local reordering times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      hypre_TFree(repart_coordinates, HYPRE_MEMORY_HOST);
+   }
+
    /* save the initial guess for the 2nd time */
 #if SECOND_TIME
    x0_save = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
@@ -3383,6 +3595,84 @@ main( hypre_int argc,
     * Solve the system using the hybrid solver
     *-----------------------------------------------------------*/
 
+   /*-----------------------------------------------------------
+    * Check a transpose plan against the plain transpose, when it
+    * is built and after the values of A have changed
+    *-----------------------------------------------------------*/
+
+   if (solver_id == -2)
+   {
+      hypre_ParCSRMatrix        *A = (hypre_ParCSRMatrix *) parcsr_A;
+      hypre_ParCSRMatrix        *AT_plan, *AT;
+      hypre_ParCSRTransposePlan *plan;
+      hypre_ParVector           *xt, *y, *y_plan;
+      HYPRE_Complex             *data;
+      HYPRE_Real                 diff[2];
+      HYPRE_Int                  nnz, k, pass;
+
+      if (myid == 0)
+      {
+         hypre_printf("Transpose plan test\n");
+      }
+
+      hypre_ParCSRTransposePlanCreate(A, &AT_plan, &plan);
+
+      xt = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParCSRMatrixGlobalNumRows(A),
+                                 hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(xt);
+      hypre_ParVectorSetRandomValues(xt, 775);
+      y = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParCSRMatrixGlobalNumCols(A),
+                                hypre_ParCSRMatrixColStarts(A));
+      hypre_ParVectorInitialize(y);
+      y_plan = hypre_ParVectorCreate(hypre_MPI_COMM_WORLD, hypre_ParCSRMatrixGlobalNumCols(A),
+                                     hypre_ParCSRMatrixColStarts(A));
+      hypre_ParVectorInitialize(y_plan);
+
+      for (pass = 0; pass < 2; pass++)
+      {
+         /* second pass: new values with the same pattern */
+         if (pass == 1)
+         {
+            data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(A));
+            nnz  = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+            for (k = 0; k < nnz; k++)
+            {
+               data[k] *= 1.0 + 0.1 * (k % 7);
+            }
+            data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(A));
+            nnz  = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+            for (k = 0; k < nnz; k++)
+            {
+               data[k] *= 2.0 - 0.1 * (k % 5);
+            }
+            hypre_ParCSRTransposePlanUpdate(plan, A, AT_plan);
+         }
+
+         hypre_ParCSRMatrixTranspose(A, &AT, 1);
+         hypre_ParCSRMatrixMatvec(1.0, AT, xt, 0.0, y);
+         hypre_ParCSRMatrixMatvec(1.0, AT_plan, xt, 0.0, y_plan);
+         hypre_ParCSRMatrixDestroy(AT);
+
+         hypre_ParVectorAxpy(-1.0, y, y_plan);
+         diff[pass] = sqrt(hypre_ParVectorInnerProd(y_plan, y_plan) /
+                           hypre_ParVectorInnerProd(y, y));
+      }
+
+      if (myid == 0)
+      {
+         hypre_printf("Created: relative difference = %e\n", diff[0]);
+         hypre_printf("Updated: relative difference = %e\n", diff[1]);
+      }
+
+      hypre_ParVectorDestroy(xt);
+      hypre_ParVectorDestroy(y);
+      hypre_ParVectorDestroy(y_plan);
+      hypre_ParCSRMatrixDestroy(AT_plan);
+      hypre_ParCSRTransposePlanDestroy(plan);
+
+      goto final;
+   }
+
    if (solver_id == -1)
    {
       HYPRE_Int nmv = 100;
@@ -3612,6 +3902,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
+      HYPRE_BoomerAMGSetAgglomFactor(amg_solver, agglom_factor);
+      HYPRE_BoomerAMGSetRepartThreshold(amg_solver, repart_threshold);
+      HYPRE_BoomerAMGSetLocalReordering(amg_solver, local_reordering > 0);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
       HYPRE_BoomerAMGSetTruncFactor(amg_solver, trunc_factor);
@@ -3624,6 +3918,12 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetPrintFileName(amg_solver, "driver.out.log");
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+      HYPRE_BoomerAMGSetKCycleTol(amg_solver, kcycle_tol);
+      if (kcycle_levels)
+      {
+         HYPRE_BoomerAMGSetKCycleLevels(amg_solver, kcycle_num_levels, kcycle_levels);
+      }
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       HYPRE_BoomerAMGSetISType(amg_solver, IS_type);
       HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_solver, num_CR_relax_steps);
@@ -3718,6 +4018,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFuseResidual(amg_solver, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3838,6 +4139,59 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      /* Numeric re-setups for matrices with the sparsity pattern of A, which
+         keep the coarsening and interpolation of the first setup */
+      if (solver_id == 0 && num_resetups > 0)
+      {
+         hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(parcsr_A);
+         hypre_CSRMatrix    *A_s_diag;
+         HYPRE_Int           s, jj;
+
+         /* destroyed with amg_solver, whose hierarchy references it */
+         A_s      = hypre_ParCSRMatrixClone(parcsr_A, 1);
+         A_s_diag = hypre_ParCSRMatrixDiag(A_s);
+
+         for (s = 1; s <= num_resetups; s++)
+         {
+            for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+            {
+               for (jj = hypre_CSRMatrixI(A_diag)[i]; jj < hypre_CSRMatrixI(A_diag)[i + 1]; jj++)
+               {
+                  if (hypre_CSRMatrixJ(A_diag)[jj] == i)
+                  {
+                     hypre_CSRMatrixData(A_s_diag)[jj] =
+                        (1.0 + 0.25 * s) * hypre_CSRMatrixData(A_diag)[jj];
+                  }
+               }
+            }
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+
+            time_index = hypre_InitializeTiming("BoomerAMG Re-setup");
+            hypre_BeginTiming(time_index);
+
+            hypre_BoomerAMGSetupNumeric(amg_solver, A_s, (hypre_ParVector *) b,
+                                        (hypre_ParVector *) x);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_BoomerAMGSolve(amg_solver, A_s, b, x);
+
+            HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+            HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("Re-setup s = %d\n", s);
+               hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       //HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3917,6 +4271,7 @@ main( hypre_int argc,
       if (solver_id == 0)
       {
          HYPRE_BoomerAMGDestroy(amg_solver);
+         hypre_ParCSRMatrixDestroy(A_s);
       }
       else if (solver_id == 90)
       {
@@ -3955,6 +4310,10 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
+      HYPRE_BoomerAMGSetAgglomFactor(amg_solver, agglom_factor);
+      HYPRE_BoomerAMGSetRepartThreshold(amg_solver, repart_threshold);
+      HYPRE_BoomerAMGSetLocalReordering(amg_solver, local_reordering > 0);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
       HYPRE_BoomerAMGSetTruncFactor(amg_solver, trunc_factor);
@@ -3967,6 +4326,12 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMaxIter(amg_solver, mg_max_iter);
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+      HYPRE_BoomerAMGSetKCycleTol(amg_solver, kcycle_tol);
+      if (kcycle_levels)
+      {
+         HYPRE_BoomerAMGSetKCycleLevels(amg_solver, kcycle_num_levels, kcycle_levels);
+      }
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(amg_solver, relax_type); }
       if (relax_down > -1)
@@ -4037,6 +4402,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetFuseResidual(amg_solver, fuse_residual);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol - 1]);
@@ -4140,6 +4506,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -4151,6 +4521,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -4228,6 +4604,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4322,6 +4699,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -4333,6 +4714,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -4408,6 +4795,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4517,6 +4905,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetPrintLevel(amg_solver, 1);
          HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+         HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(amg_solver, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(amg_solver, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
          HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
          if (relax_down > -1)
@@ -4663,6 +5057,11 @@ main( hypre_int argc,
 
       if (myid == 0)
       {
+         if (repro_sums)
+         {
+            /* all digits, to check bitwise reproducibility */
+            hypre_printf("\nRelative residual norm digits = %.16e\n", final_res_norm);
+         }
          hypre_printf("\n");
          hypre_printf("Iterations = %d\n", num_iterations);
          hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
@@ -4843,6 +5242,12 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+            if (kcycle_levels)
+            {
+               HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+            }
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
             if (relax_down > -1)
@@ -4960,6 +5365,12 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+            if (kcycle_levels)
+            {
+               HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+            }
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
             HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -5269,6 +5680,12 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+            if (kcycle_levels)
+            {
+               HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+            }
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
             if (relax_down > -1)
@@ -5397,6 +5814,12 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
             HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
             HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+            HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+            HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+            if (kcycle_levels)
+            {
+               HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+            }
             HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
             HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
             HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
@@ -5734,6 +6157,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(amg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(amg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(amg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(amg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(amg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(amg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(amg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(amg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(amg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(amg_precond, trunc_factor);
@@ -5745,6 +6172,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(amg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(amg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(amg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(amg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(amg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(amg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(amg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(amg_precond, num_CR_relax_steps);
@@ -5829,6 +6262,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(amg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -5925,6 +6359,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -5936,6 +6374,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6012,6 +6456,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6261,6 +6706,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -6272,6 +6721,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6348,6 +6803,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6462,6 +6918,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -6473,6 +6933,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6549,6 +7015,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6634,6 +7101,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetPrintLevel(amg_solver, 1);
          HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
          HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+         HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(amg_solver, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(amg_solver, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
          HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
          if (relax_down > -1)
@@ -6857,6 +7330,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -6868,6 +7345,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -6945,6 +7428,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7232,6 +7716,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -7243,6 +7731,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          HYPRE_BoomerAMGSetISType(pcg_precond, IS_type);
          HYPRE_BoomerAMGSetNumCRRelaxSteps(pcg_precond, num_CR_relax_steps);
@@ -7320,6 +7814,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7570,6 +8065,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
+         HYPRE_BoomerAMGSetRepartThreshold(pcg_precond, repart_threshold);
+         HYPRE_BoomerAMGSetLocalReordering(pcg_precond, local_reordering > 0);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
          HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
@@ -7581,6 +8080,12 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
          HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
          HYPRE_BoomerAMGSetFCycle(pcg_precond, fcycle);
+         HYPRE_BoomerAMGSetKCycle(pcg_precond, kcycle);
+         HYPRE_BoomerAMGSetKCycleTol(pcg_precond, kcycle_tol);
+         if (kcycle_levels)
+         {
+            HYPRE_BoomerAMGSetKCycleLevels(pcg_precond, kcycle_num_levels, kcycle_levels);
+         }
          HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
          if (relax_type > -1) { HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type); }
          if (relax_down > -1)
@@ -7645,6 +8150,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetFuseResidual(pcg_precond, fuse_residual);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7807,6 +8313,12 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetPMaxElmts(amg_solver, 0);
       HYPRE_BoomerAMGSetCycleType(amg_solver, cycle_type);
       HYPRE_BoomerAMGSetFCycle(amg_solver, fcycle);
+      HYPRE_BoomerAMGSetKCycle(amg_solver, kcycle);
+      HYPRE_BoomerAMGSetKCycleTol(amg_solver, kcycle_tol);
+      if (kcycle_levels)
+      {
+         HYPRE_BoomerAMGSetKCycleLevels(amg_solver, kcycle_num_levels, kcycle_levels);
+      }
       HYPRE_BoomerAMGSetNumSweeps(amg_solver, num_sweeps);
       HYPRE_BoomerAMGSetRelaxType(amg_solver, 3);
       if (relax_down > -1)
@@ -7987,6 +8499,11 @@ main( hypre_int argc,
     * Print the solution and other info
     *-----------------------------------------------------------*/
 
+   if (parcsr_Q)
+   {
+      hypre_ParCSRMatrixMatvec(1.0, parcsr_Q, x, 0.0, x_orig);
+   }
+
    if (print_system)
    {
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
@@ -8000,6 +8517,17 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
+   if (parcsr_Q)
+   {
+      HYPRE_ParCSRMatrixDestroy(parcsr_A);
+      HYPRE_ParVectorDestroy(b);
+      HYPRE_ParVectorDestroy(x);
+      hypre_ParCSRMatrixDestroy(parcsr_Q);
+      parcsr_A = parcsr_A_orig;
+      b = b_orig;
+      x = x_orig;
+   }
+
    if (test_ij || build_matrix_type == -1)
    {
       HYPRE_IJMatrixDestroy(ij_A);
@@ -8047,6 +8575,7 @@ final:
    {
       hypre_TFree(isolated_fpt_index, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(kcycle_levels, HYPRE_MEMORY_HOST);
 
    /*
       hypre_FinalizeMemoryDebug();
@@ -1252,6 +1252,7 @@ main( hypre_int argc,
    Index                *block;
    HYPRE_Int                   solver_id;
    HYPRE_Int                   print_system;
+   HYPRE_Int                   num_resetups;
 
    HYPRE_SStructGrid     grid;
    HYPRE_SStructStencil *stencils;
@@ -1351,6 +1352,7 @@ main( hypre_int argc,
 
    solver_id = 39;
    print_system = 0;
+   num_resetups = 0;
 
    /*-----------------------------------------------------------
     * Parse command line
@@ -1419,6 +1421,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-reuse") == 0 )
+      {
+         arg_index++;
+         num_resetups = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-v") == 0 )
       {
          arg_index++;
@@ -2013,6 +2020,7 @@ main( hypre_int argc,
       HYPRE_SStructFACSetNumPostRelax(solver, n_post);
       HYPRE_SStructFACSetCoarseSolverType(solver, 2);
       HYPRE_SStructFACSetLogging(solver, 1);
+      HYPRE_SStructFACSetReuse(solver, (num_resetups > 0));
       HYPRE_SStructFACSetup2(solver, A, b, x);
 
       hypre_EndTiming(time_index);
@@ -2037,6 +2045,70 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      /* repeated setups with the same composite grid, as in time stepping:
+         before re-setup k, the diagonal is scaled to (1 + k/4) times its
+         original value, and each solve starts from the previous solution */
+      if (num_resetups > 0)
+      {
+         time_index = hypre_InitializeTiming("FAC Re-setup");
+         values = hypre_TAlloc(HYPRE_Real,  data.max_boxsize, HYPRE_MEMORY_HOST);
+
+         for (k = 1; k <= num_resetups; k++)
+         {
+            for (part = 0; part < data.nparts; part++)
+            {
+               pdata = data.pdata[part];
+               for (var = 0; var < pdata.nvars; var++)
+               {
+                  s = pdata.stencil_num[var];
+                  for (i = 0; i < data.stencil_sizes[s]; i++)
+                  {
+                     if (data.stencil_vars[s][i] == var &&
+                         data.stencil_offsets[s][i][0] == 0 &&
+                         data.stencil_offsets[s][i][1] == 0 &&
+                         data.stencil_offsets[s][i][2] == 0)
+                     {
+                        break;
+                     }
+                  }
+                  for (box = 0; box < pdata.nboxes && i < data.stencil_sizes[s]; box++)
+                  {
+                     GetVariableBox(pdata.ilowers[box], pdata.iuppers[box],
+                                    pdata.vartypes[var], ilower, iupper);
+                     HYPRE_SStructMatrixGetBoxValues(A, part, ilower, iupper,
+                                                     var, 1, &i, values);
+                     for (j = 0; j < data.max_boxsize; j++)
+                     {
+                        values[j] *= (4.0 + k) / (3.0 + k);
+                     }
+                     HYPRE_SStructMatrixSetBoxValues(A, part, ilower, iupper,
+                                                     var, 1, &i, values);
+                  }
+               }
+            }
+            HYPRE_SStructMatrixAssemble(A);
+
+            hypre_BeginTiming(time_index);
+            HYPRE_SStructFACSetup2(solver, A, b, x);
+            hypre_EndTiming(time_index);
+
+            HYPRE_SStructFACSolve3(solver, A, b, x);
+
+            HYPRE_SStructFACGetNumIterations(solver, &num_iterations);
+            HYPRE_SStructFACGetFinalRelativeResidualNorm(solver, &final_res_norm);
+            if (myid == 0)
+            {
+               hypre_printf("Re-setup %d: Iterations = %d, Final Relative Residual Norm = %e\n",
+                            k, num_iterations, final_res_norm);
+            }
+         }
+
+         hypre_TFree(values, HYPRE_MEMORY_HOST);
+         hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
       HYPRE_SStructFACGetNumIterations(solver, &num_iterations);
       HYPRE_SStructFACGetFinalRelativeResidualNorm(
          solver, &final_res_norm);
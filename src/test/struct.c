@@ -12,6 +12,7 @@
 #include "_hypre_utilities.h"
 #include "HYPRE_struct_ls.h"
 #include "HYPRE_krylov.h"
+#include "HYPRE_seq_mv.h"
 
 #define HYPRE_MFLOPS 0
 #if HYPRE_MFLOPS
@@ -46,6 +47,26 @@ HYPRE_Int  AddValuesMatrix(HYPRE_StructMatrix A, HYPRE_StructGrid gridmatrix,
                            HYPRE_Real        cony,
                            HYPRE_Real        conz) ;
 
+/* coefficients of the matrix-free convection-diffusion matrix (option -mf) */
+typedef struct
+{
+   HYPRE_Int   dim;
+   HYPRE_Real  lower[3];     /* west, south, bottom */
+   HYPRE_Real  center;
+   HYPRE_Real  upper[3];     /* east, north, top */
+   HYPRE_Int   istart[3];
+   HYPRE_Int   iend[3];
+   HYPRE_Int   period[3];
+} MatrixFreeData;
+
+HYPRE_Int  SetMatrixFreeData(MatrixFreeData *mf_data, HYPRE_StructGrid gridmatrix,
+                             HYPRE_Int *period,
+                             HYPRE_Real cx, HYPRE_Real cy, HYPRE_Real cz,
+                             HYPRE_Real conx, HYPRE_Real cony, HYPRE_Real conz);
+
+HYPRE_Int  MatrixFreeCoeffs(void *coeff_data, HYPRE_Int *index, HYPRE_Int n,
+                            HYPRE_Complex *values);
+
 HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            hypre_StructVector *zvector,
                            HYPRE_Int          *period,
@@ -100,6 +121,11 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tb_depth;
+   HYPRE_Int           matrix_free;
+   MatrixFreeData      mf_data;
+   HYPRE_Int           comm_stats;
+   HYPRE_Int           comm_types;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -210,6 +236,10 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tb_depth = 0;
+   matrix_free = 0;
+   comm_stats = 0;
+   comm_types = 1;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -404,6 +434,26 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tb") == 0 )
+      {
+         arg_index++;
+         tb_depth = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mf") == 0 )
+      {
+         arg_index++;
+         matrix_free = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-commstats") == 0 )
+      {
+         arg_index++;
+         comm_stats = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-commtypes") == 0 )
+      {
+         arg_index++;
+         comm_types = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -593,8 +643,14 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Zebra line Gauss-Seidel (PFMG)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tb <k>             : PFMG temporal blocking depth (0 = off)\n");
+      hypre_printf("  -mf                 : matrix-free matrix (coefficients from a callback)\n");
+      hypre_printf("  -commstats          : print communication cache and pack/unpack statistics\n");
+      hypre_printf("  -commtypes <b>      : send/recv with MPI datatypes where profitable (1, default)\n");
+      hypre_printf("                        or always pack buffers (0)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -681,6 +737,30 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   /* only PFMG with variable coefficients and the Krylov solvers without or
+    * with a PFMG preconditioner take matrix-free matrices */
+   if (matrix_free && !(solver_id == 1 ||
+                        (solver_id > 10 && solver_id != 21 &&
+                         (solver_id % 10 == 1 || solver_id % 10 == 9))))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: Matrix-free matrices are not supported by this solver\n");
+      }
+      matrix_free = 0;
+   }
+
+   if (matrix_free && sym == 1)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: Matrix-free matrices use non-symmetric storage\n");
+      }
+      sym = 0;
+   }
+
+   hypre_CommSetUseDatatypes(comm_types);
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1090,20 +1170,28 @@ main( hypre_int argc,
          }
 
          HYPRE_StructMatrixSetSymmetric(A, sym);
+         if (matrix_free)
+         {
+            SetMatrixFreeData(&mf_data, grid, periodic, cx, cy, cz, conx, cony, conz);
+            HYPRE_StructMatrixSetCoeffFunction(A, MatrixFreeCoeffs, &mf_data);
+         }
          HYPRE_StructMatrixInitialize(A);
 
          /*-----------------------------------------------------------
           * Fill in the matrix elements
           *-----------------------------------------------------------*/
 
-         AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
+         if (!matrix_free)
+         {
+            AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
 
-         /* Zero out stencils reaching to real boundary */
-         /* But in constant coefficient case, no special stencils! */
+            /* Zero out stencils reaching to real boundary */
+            /* But in constant coefficient case, no special stencils! */
 
-         if ( constant_coefficient == 0 )
-         {
-            SetStencilBndry(A, grid, periodic);
+            if ( constant_coefficient == 0 )
+            {
+               SetStencilBndry(A, grid, periodic);
+            }
          }
          HYPRE_StructMatrixAssemble(A);
          /*-----------------------------------------------------------
@@ -1462,6 +1550,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlocking(solver, tb_depth);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1644,6 +1733,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1813,6 +1903,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2064,6 +2155,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2327,6 +2419,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2451,6 +2544,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2602,6 +2696,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2753,6 +2848,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2851,6 +2947,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tb_depth);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2916,6 +3013,21 @@ main( hypre_int argc,
 
 #endif
 
+      if (comm_stats && myid == 0 && rep == reps - 1)
+      {
+         HYPRE_Int  cache_hits, cache_misses;
+         HYPRE_Int  typed_msgs, packed_msgs;
+
+         hypre_CommInfoCacheGetStats(&cache_hits, &cache_misses);
+         hypre_CommGetPackStats(&typed_msgs, &packed_msgs);
+         hypre_printf("CommInfo cache hits = %d, misses = %d\n", cache_hits, cache_misses);
+         hypre_printf("Typed messages = %d, packed messages = %d\n", typed_msgs, packed_msgs);
+#ifdef HYPRE_PROFILE
+         hypre_printf("Pack/unpack time = %e\n", hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]);
+#endif
+         hypre_printf("\n");
+      }
+
       /*-----------------------------------------------------------
        * Compute MFLOPs for Matvec
        *-----------------------------------------------------------*/
@@ -3697,3 +3809,125 @@ SetStencilBndry(HYPRE_StructMatrix A, HYPRE_StructGrid gridmatrix, HYPRE_Int* pe
    return ierr;
 }
 
+
+/*********************************************************************************
+ * this function sets up the data of the matrix-free version of the matrix that
+ * AddValuesMatrix and SetStencilBndry produce for a non-symmetric variable
+ * coefficient matrix.
+ *********************************************************************************/
+
+HYPRE_Int
+SetMatrixFreeData(MatrixFreeData    *mf_data,
+                  HYPRE_StructGrid   gridmatrix,
+                  HYPRE_Int         *period,
+                  HYPRE_Real         cx,
+                  HYPRE_Real         cy,
+                  HYPRE_Real         cz,
+                  HYPRE_Real         conx,
+                  HYPRE_Real         cony,
+                  HYPRE_Real         conz)
+{
+   hypre_Box   *boundingbox = hypre_StructGridBoundingBox(gridmatrix);
+   HYPRE_Real   c[3], con[3];
+   HYPRE_Int    d, dim;
+
+   dim = hypre_StructGridNDim(gridmatrix);
+   c[0] = cx;     c[1] = cy;     c[2] = cz;
+   con[0] = conx; con[1] = cony; con[2] = conz;
+
+   mf_data -> dim    = dim;
+   mf_data -> center = 0.0;
+   for (d = 0; d < dim; d++)
+   {
+      mf_data -> lower[d] = -c[d];
+      mf_data -> upper[d] = -c[d];
+      mf_data -> center  += 2.0 * c[d];
+   }
+   for (d = 0; d < dim; d++)
+   {
+      if (con[d] > 0.0)
+      {
+         mf_data -> lower[d] -= con[d];
+         mf_data -> center   += con[d];
+      }
+      else if (con[d] < 0.0)
+      {
+         mf_data -> upper[d] += con[d];
+         mf_data -> center   -= con[d];
+      }
+      mf_data -> istart[d] = hypre_BoxIMinD(boundingbox, d);
+      mf_data -> iend[d]   = hypre_BoxIMaxD(boundingbox, d);
+      mf_data -> period[d] = period[d];
+   }
+
+   return 0;
+}
+
+/*********************************************************************************
+ * coefficient function of the matrix-free matrix (see SetMatrixFreeData).  The
+ * stencil is west, (south, (bottom,)) center, east, (north, (top)), and the
+ * entries that reach to a non-periodic boundary are zero.
+ *********************************************************************************/
+
+HYPRE_Int
+MatrixFreeCoeffs(void          *coeff_data,
+                 HYPRE_Int     *index,
+                 HYPRE_Int      n,
+                 HYPRE_Complex *values)
+{
+   MatrixFreeData *mf_data = (MatrixFreeData *) coeff_data;
+   HYPRE_Int       dim     = (mf_data -> dim);
+   HYPRE_Complex  *lp, *up, *cp;
+   HYPRE_Int       d, i;
+
+   cp = values + dim * n;
+   for (i = 0; i < n; i++)
+   {
+      cp[i] = (mf_data -> center);
+   }
+
+   for (d = 0; d < dim; d++)
+   {
+      lp = values + d * n;
+      up = values + (dim + 1 + d) * n;
+      for (i = 0; i < n; i++)
+      {
+         lp[i] = (mf_data -> lower[d]);
+         up[i] = (mf_data -> upper[d]);
+      }
+
+      if ((mf_data -> period[d]) == 0)
+      {
+         if (d == 0)
+         {
+            for (i = 0; i < n; i++)
+            {
+               if (index[0] + i == (mf_data -> istart[0]))
+               {
+                  lp[i] = 0.0;
+               }
+               if (index[0] + i == (mf_data -> iend[0]))
+               {
+                  up[i] = 0.0;
+               }
+            }
+         }
+         else
+         {
+            for (i = 0; i < n; i++)
+            {
+               if (index[d] == (mf_data -> istart[d]))
+               {
+                  lp[i] = 0.0;
+               }
+               if (index[d] == (mf_data -> iend[d]))
+               {
+                  up[i] = 0.0;
+               }
+            }
+         }
+      }
+   }
+
+   return 0;
+}
@@ -419,6 +419,54 @@ main( hypre_int argc,
    hypre_FinalizeTiming(time_index);
    hypre_ClearTiming();
 
+   /*-----------------------------------------------------------
+    * Time untiled and tiled 7-point stencil sweeps
+    *-----------------------------------------------------------*/
+
+   {
+      HYPRE_Int  ox = 1;
+      HYPRE_Int  oy = nx + 2;
+      HYPRE_Int  oz = (nx + 2) * (ny + 2);
+
+      /* Time BoxLoop2 */
+      time_index = hypre_InitializeTiming("BoxLoop2 stencil");
+      hypre_BeginTiming(time_index);
+      for (rep = 0; rep < reps; rep++)
+      {
+         hypre_BoxLoop2Begin(3, loop_size,
+                             x1_data_box, start, unit_stride, xi1,
+                             x2_data_box, start, unit_stride, xi2);
+         {
+            xp1[xi1] = 6.0 * xp2[xi2] - xp2[xi2 - ox] - xp2[xi2 + ox] -
+                       xp2[xi2 - oy] - xp2[xi2 + oy] - xp2[xi2 - oz] - xp2[xi2 + oz];
+         }
+         hypre_BoxLoop2End(xi1, xi2);
+      }
+      hypre_EndTiming(time_index);
+
+      /* Time BoxLoop2Tiled (tiling is off by default) */
+      HYPRE_SetStructTiling(1);
+      time_index = hypre_InitializeTiming("BoxLoop2Tiled stencil");
+      hypre_BeginTiming(time_index);
+      for (rep = 0; rep < reps; rep++)
+      {
+         hypre_BoxLoop2TiledBegin(3, loop_size,
+                                  x1_data_box, start, unit_stride, xi1,
+                                  x2_data_box, start, unit_stride, xi2);
+         {
+            xp1[xi1] = 6.0 * xp2[xi2] - xp2[xi2 - ox] - xp2[xi2 + ox] -
+                       xp2[xi2 - oy] - xp2[xi2 + oy] - xp2[xi2 - oz] - xp2[xi2 + oz];
+         }
+         hypre_BoxLoop2TiledEnd(xi1, xi2);
+      }
+      hypre_EndTiming(time_index);
+      HYPRE_SetStructTiling(0);
+
+      hypre_PrintTiming("Untiled and tiled stencil times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
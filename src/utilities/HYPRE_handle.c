@@ -22,6 +22,43 @@ HYPRE_SetSpGemmUseCusparse( HYPRE_Int use_cusparse )
    return hypre_SetSpGemmUseCusparse(use_cusparse);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetReproducibleSums
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetReproducibleSums( HYPRE_Int reproducible )
+{
+   return hypre_SetReproducibleSums(reproducible);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructTiling
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructTiling( HYPRE_Int tiling )
+{
+   return hypre_SetStructTiling(tiling);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructTileSize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructTileSize( HYPRE_Int tile_x,
+                         HYPRE_Int tile_y )
+{
+   return hypre_SetStructTileSize(tile_x, tile_y);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructTileCacheSize
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructTileCacheSize( HYPRE_Int cache_size )
+{
+   return hypre_SetStructTileCacheSize(cache_size);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetUseGpuRand
  *--------------------------------------------------------------------------*/
@@ -232,6 +232,22 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 HYPRE_Int HYPRE_SetSpGemmUseCusparse( HYPRE_Int use_cusparse );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
+/* Compute inner products (and hence norms) of ParCSR vectors with exact,
+ * order-independent summation, so that results are bitwise reproducible for
+ * any number of threads and MPI tasks.  Host memory only. Default is 0. */
+HYPRE_Int HYPRE_SetReproducibleSums( HYPRE_Int reproducible );
+
+/* Tiled execution of the struct kernels that support it (host only).  The
+ * iteration space of a box is cut into tiles across all but the slowest
+ * dimension, which is streamed through, so that neighboring planes stay in
+ * cache.  Tiling is off by default (0); 1 turns it on.  Tile sizes (in grid
+ * points, for the x and y directions) are chosen from the cache size unless
+ * they are set; a value of 0 means automatic.  The cache size (in bytes)
+ * defaults to the L2 cache size, if it can be determined. */
+HYPRE_Int HYPRE_SetStructTiling( HYPRE_Int tiling );
+HYPRE_Int HYPRE_SetStructTileSize( HYPRE_Int tile_x, HYPRE_Int tile_y );
+HYPRE_Int HYPRE_SetStructTileCacheSize( HYPRE_Int cache_size );
+
 #ifdef __cplusplus
 }
 #endif
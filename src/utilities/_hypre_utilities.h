@@ -35,6 +35,7 @@ typedef int                    hypre_int;
 typedef long int               hypre_longint;
 typedef unsigned int           hypre_uint;
 typedef unsigned long int      hypre_ulongint;
+typedef long long int          hypre_longlongint;
 typedef unsigned long long int hypre_ulonglongint;
 
 /* This allows us to consistently avoid 'double' throughout hypre */
@@ -362,6 +363,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_INT     HYPRE_MPI_INT
 #define  hypre_MPI_CHAR    MPI_CHAR
 #define  hypre_MPI_LONG    MPI_LONG
+#define  hypre_MPI_LONG_LONG_INT MPI_LONG_LONG_INT
 #define  hypre_MPI_BYTE    MPI_BYTE
 /* HYPRE_MPI_REAL is defined in HYPRE_utilities.h */
 #define  hypre_MPI_REAL    HYPRE_MPI_REAL
@@ -1303,6 +1305,16 @@ typedef struct
    HYPRE_Int              own_umpire_pinned_pool;
    umpire_resourcemanager umpire_rm;
 #endif
+   /* reproducible (order independent) inner products */
+   HYPRE_Int              reproducible_sums;
+   /* tiled execution of the host struct BoxLoops */
+   HYPRE_Int              struct_tiling;
+   HYPRE_Int              struct_tile_size[2];
+   HYPRE_Int              struct_tile_cache_size;
+   /* struct communication with MPI datatypes, and its message counts */
+   HYPRE_Int              struct_comm_datatypes;
+   HYPRE_Int              struct_comm_num_typed_msgs;
+   HYPRE_Int              struct_comm_num_packed_msgs;
    /* user malloc/free function pointers */
    GPUMallocFunc          user_device_malloc;
    GPUMfreeFunc           user_device_free;
@@ -1314,6 +1326,13 @@ typedef struct
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
+#define hypre_HandleReproducibleSums(hypre_handle)               ((hypre_handle) -> reproducible_sums)
+#define hypre_HandleStructTiling(hypre_handle)                   ((hypre_handle) -> struct_tiling)
+#define hypre_HandleStructTileSize(hypre_handle)                 ((hypre_handle) -> struct_tile_size)
+#define hypre_HandleStructTileCacheSize(hypre_handle)            ((hypre_handle) -> struct_tile_cache_size)
+#define hypre_HandleStructCommDatatypes(hypre_handle)            ((hypre_handle) -> struct_comm_datatypes)
+#define hypre_HandleStructCommNumTypedMsgs(hypre_handle)         ((hypre_handle) -> struct_comm_num_typed_msgs)
+#define hypre_HandleStructCommNumPackedMsgs(hypre_handle)        ((hypre_handle) -> struct_comm_num_packed_msgs)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_DeviceDataCurandGenerator(hypre_HandleDeviceData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_DeviceDataCublasHandle(hypre_HandleDeviceData(hypre_handle))
@@ -1468,6 +1487,57 @@ typedef struct
 #define hypre_IntArraySize(array)                  ((array) -> size)
 #define hypre_IntArrayMemoryLocation(array)        ((array) -> memory_location)
 
+#endif
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the reproducible (order independent) summation accumulator
+ *
+ *****************************************************************************/
+
+#ifndef hypre_REPRO_SUM_HEADER
+#define hypre_REPRO_SUM_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSum
+ *
+ * Exact fixed-point accumulator spanning the whole range of hypre_double.
+ * Limb i holds a signed integer multiple of 2^(32*i - 1074).  Since every
+ * addition is exact, the accumulated value does not depend on the order in
+ * which terms are added, i.e., on the number of threads or MPI ranks.
+ *
+ * A deposit adds less than 2^53 in magnitude to a limb, so carries must be
+ * propagated (hypre_ReproSumNormalize) at least every 2^10 deposits.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_SUM_NUM_LIMBS   68
+#define hypre_REPRO_SUM_LIMB_BITS   32
+#define hypre_REPRO_SUM_MAX_ADDS    1024
+
+typedef struct
+{
+   hypre_longlongint  limbs[hypre_REPRO_SUM_NUM_LIMBS];
+   HYPRE_Int          num_adds;  /* deposits since the last normalization */
+   hypre_double       special;   /* sum of Inf/NaN terms */
+   HYPRE_Int          has_special;
+
+} hypre_ReproSum;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the hypre_ReproSum structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ReproSumLimbs(acc)         ((acc) -> limbs)
+#define hypre_ReproSumNumAdds(acc)       ((acc) -> num_adds)
+#define hypre_ReproSumSpecial(acc)       ((acc) -> special)
+#define hypre_ReproSumHasSpecial(acc)    ((acc) -> has_special)
+
 #endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
@@ -1788,6 +1858,22 @@ HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
+HYPRE_Int hypre_SetReproducibleSums( HYPRE_Int reproducible );
+HYPRE_Int hypre_GetReproducibleSums( void );
+HYPRE_Int hypre_SetStructTiling( HYPRE_Int tiling );
+HYPRE_Int hypre_SetStructTileSize( HYPRE_Int tile_x, HYPRE_Int tile_y );
+HYPRE_Int hypre_SetStructTileCacheSize( HYPRE_Int cache_size );
+HYPRE_Int hypre_GetStructTileCacheSize( void );
+
+/* repro_sum.c */
+HYPRE_Int hypre_ReproSumInit( hypre_ReproSum *acc );
+HYPRE_Int hypre_ReproSumNormalize( hypre_ReproSum *acc );
+HYPRE_Int hypre_ReproSumAdd( hypre_ReproSum *acc, HYPRE_Real value );
+HYPRE_Int hypre_ReproSumDot( hypre_ReproSum *acc, HYPRE_Complex *x, HYPRE_Complex *y,
+                             HYPRE_Int n );
+HYPRE_Int hypre_ReproSumMerge( hypre_ReproSum *acc, hypre_ReproSum *other );
+HYPRE_Int hypre_ReproSumAllreduce( hypre_ReproSum *acc, HYPRE_Int k, MPI_Comm comm );
+HYPRE_Real hypre_ReproSumValue( hypre_ReproSum *acc );
 
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
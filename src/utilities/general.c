@@ -48,6 +48,12 @@ hypre_HandleCreate()
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
 
+   /* tiled host BoxLoops are off: they run as the regular BoxLoops */
+   hypre_HandleStructTiling(hypre_handle_) = 0;
+
+   /* struct communication sends/receives in place where profitable */
+   hypre_HandleStructCommDatatypes(hypre_handle_) = 1;
+
 #if defined(HYPRE_USING_GPU)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
    hypre_HandleStructExecPolicy(hypre_handle_) = HYPRE_EXEC_DEVICE;
@@ -19,6 +19,7 @@ typedef int                    hypre_int;
 typedef long int               hypre_longint;
 typedef unsigned int           hypre_uint;
 typedef unsigned long int      hypre_ulongint;
+typedef long long int          hypre_longlongint;
 typedef unsigned long long int hypre_ulonglongint;
 
 /* This allows us to consistently avoid 'double' throughout hypre */
@@ -14,6 +14,10 @@
 #include "_hypre_utilities.h"
 #include "_hypre_utilities.hpp"
 
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
 /* GPU SpGemm */
 HYPRE_Int
 hypre_SetSpGemmUseCusparse( HYPRE_Int use_cusparse )
@@ -116,6 +120,92 @@ hypre_SetGaussSeidelMethod( HYPRE_Int gs_method )
    return hypre_error_flag;
 }
 
+/* Reproducible inner products */
+HYPRE_Int
+hypre_SetReproducibleSums( HYPRE_Int reproducible )
+{
+   hypre_HandleReproducibleSums(hypre_handle()) = reproducible;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GetReproducibleSums( void )
+{
+   return hypre_HandleReproducibleSums(hypre_handle());
+}
+
+/* Tiled struct BoxLoops */
+HYPRE_Int
+hypre_SetStructTiling( HYPRE_Int tiling )
+{
+   hypre_HandleStructTiling(hypre_handle()) = tiling;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetStructTileSize( HYPRE_Int tile_x,
+                         HYPRE_Int tile_y )
+{
+   if (tile_x < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (tile_y < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleStructTileSize(hypre_handle())[0] = tile_x;
+   hypre_HandleStructTileSize(hypre_handle())[1] = tile_y;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetStructTileCacheSize( HYPRE_Int cache_size )
+{
+   if (cache_size < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleStructTileCacheSize(hypre_handle()) = cache_size;
+
+   return hypre_error_flag;
+}
+
+/* Returns the cache size (in bytes) targeted by the tiles.  If it has not
+ * been set, the L2 cache size is used, or 256 KB if that is not known. */
+HYPRE_Int
+hypre_GetStructTileCacheSize( void )
+{
+   HYPRE_Int cache_size = hypre_HandleStructTileCacheSize(hypre_handle());
+
+   if (cache_size <= 0)
+   {
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+      long l2_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+
+      if (l2_size > 0 && l2_size < (1L << 30))
+      {
+         cache_size = (HYPRE_Int) l2_size;
+      }
+#endif
+      if (cache_size <= 0)
+      {
+         cache_size = 256 * 1024;
+      }
+      hypre_HandleStructTileCacheSize(hypre_handle()) = cache_size;
+   }
+
+   return cache_size;
+}
+
 HYPRE_Int
 hypre_SetUserDeviceMalloc(GPUMallocFunc func)
 {
@@ -44,6 +44,16 @@ typedef struct
    HYPRE_Int              own_umpire_pinned_pool;
    umpire_resourcemanager umpire_rm;
 #endif
+   /* reproducible (order independent) inner products */
+   HYPRE_Int              reproducible_sums;
+   /* tiled execution of the host struct BoxLoops */
+   HYPRE_Int              struct_tiling;
+   HYPRE_Int              struct_tile_size[2];
+   HYPRE_Int              struct_tile_cache_size;
+   /* struct communication with MPI datatypes, and its message counts */
+   HYPRE_Int              struct_comm_datatypes;
+   HYPRE_Int              struct_comm_num_typed_msgs;
+   HYPRE_Int              struct_comm_num_packed_msgs;
    /* user malloc/free function pointers */
    GPUMallocFunc          user_device_malloc;
    GPUMfreeFunc           user_device_free;
@@ -55,6 +65,13 @@ typedef struct
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
 #define hypre_HandleDeviceData(hypre_handle)                     ((hypre_handle) -> device_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
+#define hypre_HandleReproducibleSums(hypre_handle)               ((hypre_handle) -> reproducible_sums)
+#define hypre_HandleStructTiling(hypre_handle)                   ((hypre_handle) -> struct_tiling)
+#define hypre_HandleStructTileSize(hypre_handle)                 ((hypre_handle) -> struct_tile_size)
+#define hypre_HandleStructTileCacheSize(hypre_handle)            ((hypre_handle) -> struct_tile_cache_size)
+#define hypre_HandleStructCommDatatypes(hypre_handle)            ((hypre_handle) -> struct_comm_datatypes)
+#define hypre_HandleStructCommNumTypedMsgs(hypre_handle)         ((hypre_handle) -> struct_comm_num_typed_msgs)
+#define hypre_HandleStructCommNumPackedMsgs(hypre_handle)        ((hypre_handle) -> struct_comm_num_packed_msgs)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_DeviceDataCurandGenerator(hypre_HandleDeviceData(hypre_handle))
 #define hypre_HandleCublasHandle(hypre_handle)                   hypre_DeviceDataCublasHandle(hypre_HandleDeviceData(hypre_handle))
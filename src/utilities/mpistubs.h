@@ -213,6 +213,7 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_INT     HYPRE_MPI_INT
 #define  hypre_MPI_CHAR    MPI_CHAR
 #define  hypre_MPI_LONG    MPI_LONG
+#define  hypre_MPI_LONG_LONG_INT MPI_LONG_LONG_INT
 #define  hypre_MPI_BYTE    MPI_BYTE
 /* HYPRE_MPI_REAL is defined in HYPRE_utilities.h */
 #define  hypre_MPI_REAL    HYPRE_MPI_REAL
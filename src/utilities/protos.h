@@ -317,6 +317,22 @@ HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
 HYPRE_Int hypre_SetUserDeviceMalloc(GPUMallocFunc func);
 HYPRE_Int hypre_SetUserDeviceMfree(GPUMfreeFunc func);
+HYPRE_Int hypre_SetReproducibleSums( HYPRE_Int reproducible );
+HYPRE_Int hypre_GetReproducibleSums( void );
+HYPRE_Int hypre_SetStructTiling( HYPRE_Int tiling );
+HYPRE_Int hypre_SetStructTileSize( HYPRE_Int tile_x, HYPRE_Int tile_y );
+HYPRE_Int hypre_SetStructTileCacheSize( HYPRE_Int cache_size );
+HYPRE_Int hypre_GetStructTileCacheSize( void );
+
+/* repro_sum.c */
+HYPRE_Int hypre_ReproSumInit( hypre_ReproSum *acc );
+HYPRE_Int hypre_ReproSumNormalize( hypre_ReproSum *acc );
+HYPRE_Int hypre_ReproSumAdd( hypre_ReproSum *acc, HYPRE_Real value );
+HYPRE_Int hypre_ReproSumDot( hypre_ReproSum *acc, HYPRE_Complex *x, HYPRE_Complex *y,
+                             HYPRE_Int n );
+HYPRE_Int hypre_ReproSumMerge( hypre_ReproSum *acc, hypre_ReproSum *other );
+HYPRE_Int hypre_ReproSumAllreduce( hypre_ReproSum *acc, HYPRE_Int k, MPI_Comm comm );
+HYPRE_Real hypre_ReproSumValue( hypre_ReproSum *acc );
 
 /* int_array.c */
 hypre_IntArray* hypre_IntArrayCreate( HYPRE_Int size );
@@ -0,0 +1,427 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Reproducible summation.
+ *
+ * Terms are deposited exactly into a fixed-point accumulator (see
+ * repro_sum.h), so that local, threaded, and global (MPI) sums are bitwise
+ * identical independent of the decomposition and of the reduction order.
+ * Each deposit splits the 53-bit significand over two consecutive limbs.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define hypre_REPRO_SUM_LIMB_MASK  0xFFFFFFFFULL
+#define hypre_REPRO_SUM_LIMB_BASE  4294967296LL
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumDeposit
+ *
+ * Adds the double precision value to the limbs without rounding.  Inf and
+ * NaN cannot be represented in fixed point and are accumulated separately.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_ReproSumDeposit( hypre_ReproSum *acc,
+                       hypre_double    value )
+{
+   hypre_longlongint  *limbs = hypre_ReproSumLimbs(acc);
+   hypre_ulonglongint  bits, mant, t, neg;
+   HYPRE_Int           expo, pos, limb, shift;
+
+   memcpy(&bits, &value, sizeof(hypre_double));
+   expo = (HYPRE_Int) ((bits >> 52) & 0x7FF);
+   mant = bits & 0xFFFFFFFFFFFFFULL;
+
+   if (expo == 0x7FF)
+   {
+      hypre_ReproSumSpecial(acc) += value;
+      hypre_ReproSumHasSpecial(acc) = 1;
+      return;
+   }
+
+   if (expo == 0)
+   {
+      /* zero or subnormal: value = mant * 2^(-1074) */
+      expo = 1;
+   }
+   else
+   {
+      mant |= (1ULL << 52);
+   }
+
+   /* value = mant * 2^(pos - 1074) */
+   pos   = expo - 1;
+   limb  = pos / hypre_REPRO_SUM_LIMB_BITS;
+   shift = pos % hypre_REPRO_SUM_LIMB_BITS;
+   t     = mant >> (hypre_REPRO_SUM_LIMB_BITS - shift);
+
+   /* branch-free conditional negation: (v ^ neg) - neg = sign * v */
+   neg   = 0 - (bits >> 63);
+
+   limbs[limb]     += (hypre_longlongint) ((((mant << shift) & hypre_REPRO_SUM_LIMB_MASK) ^ neg) - neg);
+   limbs[limb + 1] += (hypre_longlongint) ((t ^ neg) - neg);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumInit
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReproSumInit( hypre_ReproSum *acc )
+{
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS; i++)
+   {
+      hypre_ReproSumLimbs(acc)[i] = 0;
+   }
+   hypre_ReproSumNumAdds(acc)    = 0;
+   hypre_ReproSumSpecial(acc)    = 0.0;
+   hypre_ReproSumHasSpecial(acc) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumNormalize
+ *
+ * Propagates carries so that all limbs but the last one lie in [0, 2^32).
+ * The representation is canonical afterwards.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReproSumNormalize( hypre_ReproSum *acc )
+{
+   hypre_longlongint *limbs = hypre_ReproSumLimbs(acc);
+   hypre_longlongint  carry;
+   HYPRE_Int          i;
+
+   for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS - 1; i++)
+   {
+      /* floor division, valid for negative limbs as well */
+      carry = limbs[i] / hypre_REPRO_SUM_LIMB_BASE;
+      if (limbs[i] - carry * hypre_REPRO_SUM_LIMB_BASE < 0)
+      {
+         carry--;
+      }
+      limbs[i]     -= carry * hypre_REPRO_SUM_LIMB_BASE;
+      limbs[i + 1] += carry;
+   }
+   hypre_ReproSumNumAdds(acc) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumAdd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReproSumAdd( hypre_ReproSum *acc,
+                   HYPRE_Real      value )
+{
+   hypre_ReproSumDeposit(acc, (hypre_double) value);
+   if (++hypre_ReproSumNumAdds(acc) == hypre_REPRO_SUM_MAX_ADDS)
+   {
+      hypre_ReproSumNormalize(acc);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumDot
+ *
+ * Adds x[i]*y[i], i = 0, ..., n-1, to acc.  The products are rounded once
+ * to hypre_double, which is deterministic; only their sum needs care.
+ *
+ * Depositing every term into the limbs is comparatively slow, so terms are
+ * processed in blocks of at most hypre_REPRO_SUM_BLOCK_SIZE.  Within a block,
+ * each product is split exactly into two parts aligned to boundaries derived
+ * from the block maximum, by adding it to running sums that start at
+ * S = 1.5*2^m and therefore keep a fixed ulp.  The parts are integer
+ * multiples of ulp(S) and small enough, so their block sums are exact in
+ * floating point and are then deposited into the limbs.  In the rare case
+ * that some remainder is nonzero, the block is deposited term by term
+ * instead, so the overall sum stays exact and hence independent of the
+ * blocking.
+ *
+ * The loops run over hypre_REPRO_SUM_LANES independent partial sums with no
+ * branches, so that they vectorize and are not bound by the latency of a
+ * single accumulation chain.  Still, with two passes and about five times the
+ * flops of a plain dot product, this is about 3x slower than hypre's plain
+ * inner product when the vectors are cache resident, and about 2x slower
+ * when memory bandwidth dominates.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_SUM_BLOCK_SIZE  1024  /* 2^10, see the choice of m below */
+#define hypre_REPRO_SUM_LANES       8
+
+HYPRE_Int
+hypre_ReproSumDot( hypre_ReproSum *acc,
+                   HYPRE_Complex  *x,
+                   HYPRE_Complex  *y,
+                   HYPRE_Int       n )
+{
+#if defined(HYPRE_COMPLEX) || defined(HYPRE_LONG_DOUBLE)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Reproducible sums are only available for float and double!\n");
+#else
+   hypre_double  pm[hypre_REPRO_SUM_LANES];
+   hypre_double  a[hypre_REPRO_SUM_LANES], b[hypre_REPRO_SUM_LANES];
+   hypre_double  c[hypre_REPRO_SUM_LANES];
+   hypre_double  pmax, S1, S2, s, t, r, sa, sb, rem;
+   HYPRE_Int     i, l, nb, ne, nl, e;
+
+   for (nb = 0; nb < n; nb += hypre_REPRO_SUM_BLOCK_SIZE)
+   {
+      ne = hypre_min(n - nb, hypre_REPRO_SUM_BLOCK_SIZE);
+      nl = ne - ne % hypre_REPRO_SUM_LANES;
+
+      for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+      {
+         pm[l] = 0.0;
+      }
+      for (i = 0; i < nl; i += hypre_REPRO_SUM_LANES)
+      {
+         for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+         {
+            t     = fabs((hypre_double) x[nb + i + l] * (hypre_double) y[nb + i + l]);
+            pm[l] = (t > pm[l]) ? t : pm[l];
+         }
+      }
+      for (i = nl; i < ne; i++)
+      {
+         t     = fabs((hypre_double) x[nb + i] * (hypre_double) y[nb + i]);
+         pm[0] = (t > pm[0]) ? t : pm[0];
+      }
+      pmax = 0.0;
+      for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+      {
+         pmax = (pm[l] > pmax) ? pm[l] : pmax;
+      }
+
+      if (pmax == 0.0)
+      {
+         continue;
+      }
+
+      /* |x[i]*y[i]| < 2^e; fall back to plain deposits for Inf and extreme ranges */
+      frexp(pmax, &e);
+      if (!(pmax <= DBL_MAX) || e < -887 || e > 1011)
+      {
+         for (i = 0; i < ne; i++)
+         {
+            hypre_ReproSumAdd(acc, (hypre_double) x[nb + i] * (hypre_double) y[nb + i]);
+         }
+         continue;
+      }
+
+      /* With m = e + 11, the first parts are multiples of 2^(m-52) bounded by
+       * 2^(m-11), so that a sum of up to 2^10 of them stays in [2^m, 2^(m+1))
+       * and is exact.  The second parts pick up the next 42 bits in the same
+       * way.  c collects the magnitudes of whatever is left. */
+      S1 = ldexp(1.5, e + 11);
+      S2 = ldexp(1.5, e - 31);
+
+      for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+      {
+         a[l] = S1;
+         b[l] = S2;
+         c[l] = 0.0;
+      }
+      for (i = 0; i < nl; i += hypre_REPRO_SUM_LANES)
+      {
+         for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+         {
+            t    = (hypre_double) x[nb + i + l] * (hypre_double) y[nb + i + l];
+            s    = a[l] + t;
+            r    = t - (s - a[l]);
+            a[l] = s;
+            s    = b[l] + r;
+            r   -= s - b[l];
+            b[l] = s;
+            c[l] += fabs(r);
+         }
+      }
+      for (i = nl; i < ne; i++)
+      {
+         t    = (hypre_double) x[nb + i] * (hypre_double) y[nb + i];
+         s    = a[0] + t;
+         r    = t - (s - a[0]);
+         a[0] = s;
+         s    = b[0] + r;
+         r   -= s - b[0];
+         b[0] = s;
+         c[0] += fabs(r);
+      }
+
+      /* a[l] - S1 and b[l] - S2 are exact, and so are their sums */
+      sa = sb = rem = 0.0;
+      for (l = 0; l < hypre_REPRO_SUM_LANES; l++)
+      {
+         sa  += a[l] - S1;
+         sb  += b[l] - S2;
+         rem += c[l];
+      }
+      if (rem == 0.0)
+      {
+         hypre_ReproSumAdd(acc, sa);
+         hypre_ReproSumAdd(acc, sb);
+      }
+      else
+      {
+         /* some terms span more than 84 bits below the block maximum */
+         for (i = 0; i < ne; i++)
+         {
+            hypre_ReproSumAdd(acc, (hypre_double) x[nb + i] * (hypre_double) y[nb + i]);
+         }
+      }
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumMerge
+ *
+ * acc += other.  Both accumulators are normalized first to avoid overflow.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReproSumMerge( hypre_ReproSum *acc,
+                     hypre_ReproSum *other )
+{
+   HYPRE_Int i;
+
+   hypre_ReproSumNormalize(acc);
+   hypre_ReproSumNormalize(other);
+   for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS; i++)
+   {
+      hypre_ReproSumLimbs(acc)[i] += hypre_ReproSumLimbs(other)[i];
+   }
+   if (hypre_ReproSumHasSpecial(other))
+   {
+      hypre_ReproSumSpecial(acc)   += hypre_ReproSumSpecial(other);
+      hypre_ReproSumHasSpecial(acc) = 1;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumAllreduce
+ *
+ * Global sum of k accumulators in a single reduction.  Normalized limbs are
+ * below 2^32 in magnitude, so their sum over fewer than 2^21 ranks is an
+ * integer exactly representable in hypre_double.  The MPI reduction order
+ * therefore does not matter.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReproSumAllreduce( hypre_ReproSum *acc,
+                         HYPRE_Int       k,
+                         MPI_Comm        comm )
+{
+   HYPRE_Int     stride = hypre_REPRO_SUM_NUM_LIMBS + 2;
+   hypre_double *send_buf, *recv_buf;
+   HYPRE_Int     i, j;
+
+   send_buf = hypre_TAlloc(hypre_double, 2 * k * stride, HYPRE_MEMORY_HOST);
+   recv_buf = send_buf + k * stride;
+
+   for (j = 0; j < k; j++)
+   {
+      hypre_ReproSumNormalize(&acc[j]);
+      for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS; i++)
+      {
+         send_buf[j * stride + i] = (hypre_double) hypre_ReproSumLimbs(&acc[j])[i];
+      }
+      send_buf[j * stride + hypre_REPRO_SUM_NUM_LIMBS]     = hypre_ReproSumSpecial(&acc[j]);
+      send_buf[j * stride + hypre_REPRO_SUM_NUM_LIMBS + 1] =
+         (hypre_double) hypre_ReproSumHasSpecial(&acc[j]);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(send_buf, recv_buf, k * stride, hypre_MPI_DOUBLE,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   for (j = 0; j < k; j++)
+   {
+      for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS; i++)
+      {
+         hypre_ReproSumLimbs(&acc[j])[i] = (hypre_longlongint) recv_buf[j * stride + i];
+      }
+      hypre_ReproSumSpecial(&acc[j])    = recv_buf[j * stride + hypre_REPRO_SUM_NUM_LIMBS];
+      hypre_ReproSumHasSpecial(&acc[j]) = (recv_buf[j * stride + hypre_REPRO_SUM_NUM_LIMBS + 1] > 0.0);
+      hypre_ReproSumNormalize(&acc[j]);
+   }
+
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSumValue
+ *
+ * Rounds the accumulated value to HYPRE_Real.  The accumulator is brought
+ * into canonical sign-magnitude form first, so the result depends only on
+ * the exact sum.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ReproSumValue( hypre_ReproSum *acc )
+{
+   hypre_ReproSum      tmp;
+   hypre_longlongint  *limbs = hypre_ReproSumLimbs(&tmp);
+   hypre_double        result = 0.0;
+   HYPRE_Int           negative, i;
+
+   tmp = *acc;
+   hypre_ReproSumNormalize(&tmp);
+
+   negative = (limbs[hypre_REPRO_SUM_NUM_LIMBS - 1] < 0);
+   if (negative)
+   {
+      for (i = 0; i < hypre_REPRO_SUM_NUM_LIMBS; i++)
+      {
+         limbs[i] = -limbs[i];
+      }
+      hypre_ReproSumNormalize(&tmp);
+   }
+
+   /* all limbs are nonnegative now; add from the most significant one down */
+   for (i = hypre_REPRO_SUM_NUM_LIMBS - 1; i >= 0; i--)
+   {
+      if (limbs[i])
+      {
+         result += ldexp((hypre_double) limbs[i], hypre_REPRO_SUM_LIMB_BITS * i - 1074);
+      }
+   }
+   if (negative)
+   {
+      result = -result;
+   }
+
+   if (hypre_ReproSumHasSpecial(acc))
+   {
+      result += hypre_ReproSumSpecial(acc);
+   }
+
+   return (HYPRE_Real) result;
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Header file for the reproducible (order independent) summation accumulator
+ *
+ *****************************************************************************/
+
+#ifndef hypre_REPRO_SUM_HEADER
+#define hypre_REPRO_SUM_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ReproSum
+ *
+ * Exact fixed-point accumulator spanning the whole range of hypre_double.
+ * Limb i holds a signed integer multiple of 2^(32*i - 1074).  Since every
+ * addition is exact, the accumulated value does not depend on the order in
+ * which terms are added, i.e., on the number of threads or MPI ranks.
+ *
+ * A deposit adds less than 2^53 in magnitude to a limb, so carries must be
+ * propagated (hypre_ReproSumNormalize) at least every 2^10 deposits.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_SUM_NUM_LIMBS   68
+#define hypre_REPRO_SUM_LIMB_BITS   32
+#define hypre_REPRO_SUM_MAX_ADDS    1024
+
+typedef struct
+{
+   hypre_longlongint  limbs[hypre_REPRO_SUM_NUM_LIMBS];
+   HYPRE_Int          num_adds;  /* deposits since the last normalization */
+   hypre_double       special;   /* sum of Inf/NaN terms */
+   HYPRE_Int          has_special;
+
+} hypre_ReproSum;
+
+/*--------------------------------------------------------------------------
+ * Accessor functions for the hypre_ReproSum structure
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ReproSumLimbs(acc)         ((acc) -> limbs)
+#define hypre_ReproSumNumAdds(acc)       ((acc) -> num_adds)
+#define hypre_ReproSumSpecial(acc)       ((acc) -> special)
+#define hypre_ReproSumHasSpecial(acc)    ((acc) -> has_special)
+
+#endif